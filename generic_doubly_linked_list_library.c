@@ -19,19 +19,641 @@
  * Email: amitchoudhary0523 AT gmail DOT com
  */
 
+// MAP_ANONYMOUS and syscall() (used by arena mode) and clock_gettime() (used
+// by the budgeted functions) are not declared by the system headers when
+// compiling with -std=c99/c11/c17 unless a feature-test macro is defined
+// before the first include.
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include "generic_doubly_linked_list_library.h"
 
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-
-static struct element *gdlll_create_standalone_element(void *data_ptr,
-                                                       long data_size);
+#include <time.h>
+
+// Asynchronous deletion (see gdlll_enable_async_deletion()) uses a POSIX
+// thread. Define GDLLL_NO_THREADS to build without pthreads (then
+// gdlll_enable_async_deletion() always fails).
+#if !defined(GDLLL_NO_THREADS)
+#include <pthread.h>
+#endif
+
+// The regions of arena mode (see gdlll_enable_arena_mode()) are mapped with
+// mmap() and bound to a NUMA node with the mbind() system call on Linux (so
+// libnuma is not needed). On other systems they are allocated with
+// aligned_alloc() and can't be bound to a NUMA node.
+#if defined(__linux__)
+#define GDLLL_ARENA_USES_MMAP 1
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// The node caches (see gdlll_enable_node_cache()) are per thread.
+#if defined(GDLLL_NO_THREADS)
+#define GDLLL_THREAD_LOCAL
+#else
+#define GDLLL_THREAD_LOCAL __thread
+#endif
+
+// The integer key index is searched with AVX2/SSE4.2 on x86-64 (chosen at
+// runtime). Define GDLLL_NO_SIMD to always use the scalar code.
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(GDLLL_NO_SIMD)
+#define GDLLL_X86_64_SIMD 1
+#include <immintrin.h>
+#endif
+
+// Every payload in the data pool of a compact container starts at an offset
+// that is a multiple of this value.
+#define GDLLL_COMPACT_DATA_ALIGNMENT 8
+
+// Initial number of elements in the 'elements' array of a compact container.
+#define GDLLL_COMPACT_INITIAL_CAPACITY 16
+
+// Maximum number of bytes in the data pool of a compact container (data
+// offsets are 32-bit).
+#define GDLLL_COMPACT_MAX_DATA_POOL_SIZE 0xFFFFFFFFUL
+
+// Every element is allocated as one memory block of GDLLL_ELEMENT_HEADER_SIZE
+// bytes, followed by the extension of the element if the container needs one
+// (see GDLLL_ELEMENT_HAS_EXTENSION_AREA) and by an inline data area of
+// GDLLL_INLINE_DATA_SIZE bytes if the payload of the element is stored in it
+// (see GDLLL_ELEMENT_HAS_INLINE_DATA_AREA). GDLLL_ELEMENT_HEADER_SIZE is
+// 'struct element' rounded up to 16 bytes (and so is the extension area) so
+// that the inline data is suitably aligned for any type.
+#define GDLLL_ELEMENT_HEADER_SIZE                                              \
+        ((sizeof(struct element) + 15) & ~((size_t)(15)))
+
+#define GDLLL_ELEMENT_EXTENSION_AREA_SIZE                                      \
+        ((sizeof(struct gdll_element_extension) + 15) & ~((size_t)(15)))
+
+#define GDLLL_ELEMENT_EXTENSION_AREA_PTR(elem_ptr)                             \
+        ((struct gdll_element_extension *)(((char *)(elem_ptr)) +              \
+                                           GDLLL_ELEMENT_HEADER_SIZE))
+
+#define GDLLL_ELEMENT_INLINE_DATA_PTR(elem_ptr)                                \
+        ((void *)(((char *)(elem_ptr)) + GDLLL_ELEMENT_HEADER_SIZE +           \
+                  (((elem_ptr)->flags & GDLLL_ELEMENT_HAS_EXTENSION_AREA) ?    \
+                                    GDLLL_ELEMENT_EXTENSION_AREA_SIZE : 0)))
+
+// 1 if the payload of the element is stored in its inline data area.
+#define GDLLL_ELEMENT_DATA_IS_INLINE(elem_ptr)                                 \
+        ((((elem_ptr)->flags & GDLLL_ELEMENT_HAS_INLINE_DATA_AREA) != 0) &&    \
+         ((elem_ptr)->data_ptr == GDLLL_ELEMENT_INLINE_DATA_PTR(elem_ptr)))
+
+// The header of every element is 48 bytes with 64-bit pointers: 'flags' and
+// 'snapshot_version' fit after the links, and the state that only some
+// features need is in the extension of the element (see struct
+// gdll_element_extension). The build fails here if a field added to struct
+// element makes it bigger.
+typedef char gdlll_element_header_is_not_bigger_than_48_bytes[
+        ((sizeof(void *) != 8) || (GDLLL_ELEMENT_HEADER_SIZE <= 48)) ? 1 : -1];
+
+// Hint to the CPU to start loading the memory at 'addr' into the cache.
+#if defined(__GNUC__)
+#define GDLLL_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+#define GDLLL_PREFETCH(addr)
+#endif
+
+// Bits of the 'flags' of an element.
+#define GDLLL_ELEMENT_IS_TOMBSTONE 0x1U
+#define GDLLL_ELEMENT_IS_IN_RING 0x2U
+#define GDLLL_ELEMENT_IS_IN_ARENA 0x4U
+// the payload block is as big as its node cache class (see
+// GDLLL_NODE_CACHE_MAX_PAYLOAD_SIZE)
+#define GDLLL_ELEMENT_PAYLOAD_IS_CLASS_SIZED 0x8U
+#define GDLLL_ELEMENT_PAYLOAD_IS_IN_ARENA 0x10U
+// the memory block of the element has an inline data area (a slot of a ring
+// always has one)
+#define GDLLL_ELEMENT_HAS_INLINE_DATA_AREA 0x20U
+// the extension of the element is in the memory block of the element
+#define GDLLL_ELEMENT_HAS_EXTENSION_AREA 0x40U
+
+// The blocks of an arena (element blocks and payload blocks) are multiples of
+// 16 bytes (a class for every multiple).
+#define GDLLL_ARENA_BLOCK_CLASS_INDEX(block_size) (((block_size) + 15) / 16)
+#define GDLLL_ARENA_NUM_BLOCK_CLASSES                                          \
+        (GDLLL_ARENA_BLOCK_CLASS_INDEX(GDLLL_ARENA_MAX_PAYLOAD_SIZE) + 1)
+
+#define GDLLL_IS_TOMBSTONE(elem_ptr)                                           \
+        (((elem_ptr)->flags & GDLLL_ELEMENT_IS_TOMBSTONE) != 0)
+
+// Atomic accesses used by epoch based reclamation. An element is published to
+// the readers by storing its pointer with release semantics (after the element
+// has been fully built), and the readers load the links with acquire
+// semantics.
+#if defined(__GNUC__)
+#define GDLLL_LOAD_ACQUIRE(lvalue) __atomic_load_n(&(lvalue), __ATOMIC_ACQUIRE)
+#define GDLLL_STORE_RELEASE(lvalue, value)                                     \
+        __atomic_store_n(&(lvalue), (value), __ATOMIC_RELEASE)
+#define GDLLL_LOAD_SEQ_CST(lvalue) __atomic_load_n(&(lvalue), __ATOMIC_SEQ_CST)
+#define GDLLL_STORE_SEQ_CST(lvalue, value)                                     \
+        __atomic_store_n(&(lvalue), (value), __ATOMIC_SEQ_CST)
+// ThreadSanitizer doesn't support fences (gcc warns with -Wtsan). The barrier
+// only follows sequentially consistent stores, so it can be left out there.
+#if defined(__SANITIZE_THREAD__)
+#define GDLLL_FULL_MEMORY_BARRIER()
+#else
+#define GDLLL_FULL_MEMORY_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+#else
+#define GDLLL_LOAD_ACQUIRE(lvalue) (lvalue)
+#define GDLLL_STORE_RELEASE(lvalue, value) ((lvalue) = (value))
+#define GDLLL_LOAD_SEQ_CST(lvalue) (lvalue)
+#define GDLLL_STORE_SEQ_CST(lvalue, value) ((lvalue) = (value))
+#define GDLLL_FULL_MEMORY_BARRIER()
+#endif
+
+// The process wide memory count is changed by all the threads (see
+// gdlll_count_memory()).
+#if defined(__GNUC__) && !defined(GDLLL_NO_THREADS)
+#define GDLLL_ADD_RELAXED(lvalue, value)                                       \
+        __atomic_add_fetch(&(lvalue), (value), __ATOMIC_RELAXED)
+#define GDLLL_LOAD_RELAXED(lvalue) __atomic_load_n(&(lvalue), __ATOMIC_RELAXED)
+#else
+#define GDLLL_ADD_RELAXED(lvalue, value) ((lvalue) = (lvalue) + (value))
+#define GDLLL_LOAD_RELAXED(lvalue) (lvalue)
+#endif
+
+// Number of bytes that an element with a payload of 'data_size' bytes is
+// counted as (see gdlll_set_memory_limit()).
+#define GDLLL_MEMORY_SIZE_OF_ELEMENT(data_size)                                \
+        ((long)(GDLLL_ELEMENT_HEADER_SIZE) +                                   \
+         (((data_size) > GDLLL_INLINE_DATA_SIZE) ? (data_size) :               \
+                                                   GDLLL_INLINE_DATA_SIZE))
+
+// Every thread adds its changes of the memory counts to the process wide count
+// when they reach these many bytes (64 KB).
+#define GDLLL_GLOBAL_MEMORY_BATCH_SIZE 65536L
+
+// The reader slots are this many 'unsigned long' apart (64 bytes), so that
+// every reader writes to its own cache line.
+#define GDLLL_EPOCH_READER_SLOT_STRIDE 8
+
+// The writer tries to free the retired elements after retiring these many
+// elements.
+#define GDLLL_EPOCH_RECLAIM_BATCH_SIZE 64
+
+// The writer tries to free the elements kept for the snapshots after keeping
+// these many elements.
+#define GDLLL_SNAPSHOT_RECLAIM_BATCH_SIZE 64
+
+// Number of children of a node of the heap used in priority queue mode. A
+// 4-ary heap is less deep than a binary heap and the children of a node are
+// next to each other in memory.
+#define GDLLL_HEAP_ARITY 4
+
+// A node of the order statistic index (see
+// gdlll_enable_order_statistic_index()). The index is a treap whose in-order
+// sequence is the list order of the elements: 'size' is the number of nodes in
+// the subtree of this node and 'priority' is random (the parent of a node has
+// a higher priority), so the treap has O(log n) expected depth.
+struct gdll_order_node
+{
+    struct gdll_order_node *parent;
+    struct gdll_order_node *left;
+    struct gdll_order_node *right;
+    struct element *elem_ptr;
+    long size;
+    unsigned long priority;
+};
+
+#define GDLLL_ORDER_NODE_SIZE(node_ptr) ((node_ptr) ? (node_ptr)->size : 0)
+
+// The state of an element that is needed only by some features (see
+// 'extension' in struct element). An element that is created for a container
+// that has one of these features enabled has it in its own memory block (see
+// GDLLL_ELEMENT_HAS_EXTENSION_AREA). Any other element gets it from malloc()
+// the first time that one of these features needs it (see
+// gdlll_get_element_extension()). It is freed with the element.
+struct gdll_element_extension
+{
+    // The position of the element in the integer key index of the container
+    // (-1 if the element is not in the index).
+    long integer_key_slot;
+    // The position of the element in the heap of the container when the
+    // container is in priority queue mode (-1 if the element is not in the
+    // heap).
+    long heap_index;
+    // The node of the element in the order statistic index of the container
+    // ('size' is 0 if the element is not in the index).
+    struct gdll_order_node order_node;
+    // The bucket of the timer wheel that has the element (-1 if the element
+    // is not an armed timer). A timer can also be in a container that has
+    // the indexes above (after it has expired), so it has its own fields.
+    long timer_bucket;
+    // The expiry time of the element when it is (or was) a timer.
+    long timer_expiry_time;
+};
+
+#define GDLLL_INTEGER_KEY_SLOT(elem_ptr)                                       \
+        (((elem_ptr)->extension) ? (elem_ptr)->extension->integer_key_slot : -1)
+
+#define GDLLL_HEAP_INDEX(elem_ptr)                                             \
+        (((elem_ptr)->extension) ? (elem_ptr)->extension->heap_index : -1)
+
+#define GDLLL_ORDER_NODE(elem_ptr)                                             \
+        ((((elem_ptr)->extension) &&                                           \
+          ((elem_ptr)->extension->order_node.size > 0)) ?                      \
+         &((elem_ptr)->extension->order_node) : NULL)
+
+#define GDLLL_TIMER_BUCKET(elem_ptr)                                           \
+        (((elem_ptr)->extension) ? (elem_ptr)->extension->timer_bucket : -1)
+
+// Size of the memory block of an element that is not in a ring and has the
+// 'block_flags' (in an arena, the blocks are one after another, so this is
+// rounded up to 16 bytes).
+#define GDLLL_ELEMENT_BLOCK_SIZE(block_flags)                                  \
+        ((GDLLL_ELEMENT_HEADER_SIZE +                                          \
+          (((block_flags) & GDLLL_ELEMENT_HAS_EXTENSION_AREA) ?                \
+                                    GDLLL_ELEMENT_EXTENSION_AREA_SIZE : 0) +   \
+          (((block_flags) & GDLLL_ELEMENT_HAS_INLINE_DATA_AREA) ?              \
+                                            GDLLL_INLINE_DATA_SIZE : 0) +      \
+          15) & ~((size_t)(15)))
+
+// The element blocks of a node cache are kept in a list for every size of
+// block (with or without an extension area and an inline data area).
+#define GDLLL_NODE_CACHE_NUM_BLOCK_KINDS 4
+#define GDLLL_NODE_CACHE_BLOCK_KIND(block_flags)                               \
+        ((((block_flags) & GDLLL_ELEMENT_HAS_INLINE_DATA_AREA) ? 1 : 0) +      \
+         (((block_flags) & GDLLL_ELEMENT_HAS_EXTENSION_AREA) ? 2 : 0))
+
+// A node cache keeps at most these many free element blocks of every kind (and
+// these many free payload blocks of every class) per thread. The rest are
+// freed.
+#define GDLLL_NODE_CACHE_MAX_BLOCKS 256
+
+// The payloads of up to these many bytes get a payload block whose size is a
+// power of 2 (a class) from the node cache: 32, 64, 128 and 256 bytes.
+#define GDLLL_NODE_CACHE_MAX_PAYLOAD_SIZE 256
+#define GDLLL_NODE_CACHE_NUM_PAYLOAD_CLASSES 4
+#define GDLLL_NODE_CACHE_MIN_PAYLOAD_CLASS_SIZE 32
+
+// The free blocks of the node cache of a thread (see
+// gdlll_enable_node_cache()). The element blocks are linked by 'next' and the
+// payload blocks are linked by their first pointer.
+struct gdll_node_cache
+{
+    struct element *element_blocks[GDLLL_NODE_CACHE_NUM_BLOCK_KINDS];
+    long number_of_element_blocks[GDLLL_NODE_CACHE_NUM_BLOCK_KINDS];
+    void *payload_blocks[GDLLL_NODE_CACHE_NUM_PAYLOAD_CLASSES];
+    long number_of_payload_blocks[GDLLL_NODE_CACHE_NUM_PAYLOAD_CLASSES];
+    // 1 if the cache is freed when the thread exits
+    int is_registered;
+};
+
+static GDLLL_THREAD_LOCAL struct gdll_node_cache gdlll_node_cache;
+
+// The number of bytes of the elements in the lists of all the containers, and
+// the change of it by this thread that has not been added to it yet.
+static long gdlll_global_memory_in_use;
+static GDLLL_THREAD_LOCAL long gdlll_global_memory_change_of_thread;
+
+// Allocation failure injection of this thread (see
+// gdlll_inject_allocation_failures()). 'allocations_to_fail' is negative if
+// all the allocations after the successful ones fail.
+#if defined(GDLLL_FAULT_INJECTION)
+static GDLLL_THREAD_LOCAL long gdlll_allocations_to_succeed;
+static GDLLL_THREAD_LOCAL long gdlll_allocations_to_fail;
+static GDLLL_THREAD_LOCAL long gdlll_number_of_injected_failures;
+#define GDLLL_ALLOCATION_MUST_FAIL() gdlll_allocation_must_fail()
+#else
+#define GDLLL_ALLOCATION_MUST_FAIL() 0
+#endif
+
+#if !defined(GDLLL_NO_THREADS)
+static pthread_key_t gdlll_node_cache_key;
+static pthread_once_t gdlll_node_cache_key_once = PTHREAD_ONCE_INIT;
+#endif
+
+// Every region of an arena is these many bytes (2 MB) and starts at an address
+// that is a multiple of it, so the region of an element is found by masking
+// the address of the element.
+#define GDLLL_ARENA_REGION_SIZE (2UL * 1024UL * 1024UL)
+
+// The element blocks of a region start after its header.
+#define GDLLL_ARENA_REGION_HEADER_SIZE 64
+
+#define GDLLL_ARENA_REGION_OF_BLOCK(block_ptr)                                 \
+        ((struct gdll_arena_region *)(((uintptr_t)(block_ptr)) &               \
+                                ~((uintptr_t)(GDLLL_ARENA_REGION_SIZE - 1))))
+
+// The regions are backed by 2 MB huge pages: from hugetlbfs if there are free
+// huge pages, otherwise transparent huge pages are asked for with madvise()
+// (the kernel uses normal pages if it can't give huge pages).
+#if defined(GDLLL_ARENA_USES_MMAP) && defined(MAP_HUGETLB)
+#if !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+#define GDLLL_ARENA_HUGETLB_FLAGS (MAP_HUGETLB | (21 << MAP_HUGE_SHIFT))
+#endif
+
+// mbind() takes a bit mask of NUMA nodes. Nodes 0 to
+// (GDLLL_MAX_NUMA_NODES - 1) can be used.
+#define GDLLL_MAX_NUMA_NODES 1024
+#define GDLLL_MPOL_BIND 2
+
+// The operations that a continuation can be used for (see struct
+// gdll_continuation).
+#define GDLLL_CONTINUATION_IS_UNUSED 0
+#define GDLLL_CONTINUATION_OF_SCAN 1
+#define GDLLL_CONTINUATION_OF_DELETE_ALL 2
+#define GDLLL_CONTINUATION_OF_SORT 3
+
+// The phases of the incremental operations. A sort finds the end of the first
+// run ('cursors[0]' is its first element and 'cursors[2]' is the last element
+// found so far), then the end of the second run ('cursors[1]' is its first
+// element), and then merges the second run into the first one ('cursors[0]'
+// and 'cursors[1]' are the next elements of the two runs and 'cursors[2]' is
+// the element after the second run).
+#define GDLLL_PHASE_STARTING 0
+#define GDLLL_PHASE_SCANNING 1
+#define GDLLL_PHASE_FREEING_REMOVED_ELEMENTS 2
+#define GDLLL_PHASE_DELETING_FRONT_ELEMENTS 3
+#define GDLLL_PHASE_FINDING_FIRST_RUN 4
+#define GDLLL_PHASE_FINDING_SECOND_RUN 5
+#define GDLLL_PHASE_MERGING_RUNS 6
+
+// An incremental operation with a time budget reads the clock once every these
+// many elements.
+#define GDLLL_ELEMENTS_PER_CLOCK_READ 64
+
+// The header of a region of an arena (see gdlll_enable_arena_mode()). The
+// regions of a container are linked by 'next'. 'number_of_blocks_in_use' tells
+// a relayout which regions can be freed.
+struct gdll_arena_region
+{
+    struct gdll_container *owner;
+    struct gdll_arena_region *next;
+    long number_of_blocks_in_use;
+};
+
+#if !defined(GDLLL_NO_THREADS)
+
+// The reclaimer thread of a container (see gdlll_enable_async_deletion()). The
+// writer pushes the elements to be freed on 'stack' (a lock-free Treiber
+// stack linked by 'next') and the reclaimer thread takes the whole stack at
+// once. 'mutex' and the condition variables are used only for waiting (when
+// there is nothing to do, and in gdlll_flush_async_deletion()).
+struct gdll_async_deleter
+{
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    struct element *stack;
+    int reclaimer_is_waiting;
+    int stop;
+    // written only by the writer
+    long number_of_queued_elements;
+    // written only by the reclaimer thread (with 'mutex' held)
+    long number_of_freed_elements;
+    void (*call_function_before_deleting_data)(void *data_ptr);
+};
+
+#endif
+
+#define GDLLL_TIMER_WHEEL_NUM_BUCKETS                                          \
+        (GDLLL_TIMER_WHEEL_LEVELS * GDLLL_TIMER_WHEEL_SLOTS)
+
+// Timers are never put more than these many ticks after the current time (the
+// range of the last level).
+#define GDLLL_TIMER_WHEEL_MAX_DELTA                                            \
+        ((1UL << (GDLLL_TIMER_WHEEL_SLOT_BITS * GDLLL_TIMER_WHEEL_LEVELS)) - 1)
+
+// Sorting orders used by the static functions of this library.
+#define GDLLL_ASCENDING_ORDER  1
+#define GDLLL_DESCENDING_ORDER 2
+
+#define GDLLL_COMPACT_ALIGNED_DATA_SIZE(size)                                  \
+        ((((unsigned long)(size)) + GDLLL_COMPACT_DATA_ALIGNMENT - 1) &        \
+         ~((unsigned long)(GDLLL_COMPACT_DATA_ALIGNMENT - 1)))
+
+static struct element *gdlll_create_standalone_element(
+                                            struct gdll_container *gdllc_ptr,
+                                            void *data_ptr, long data_size);
+static struct element *gdlll_create_element(struct gdll_container *gdllc_ptr,
+                                            void *data_ptr, long data_size,
+                                            int with_extension);
+static void gdlll_free_element_data(struct gdll_container *gdllc_ptr,
+                                    struct element *elem_ptr);
+static struct gdll_element_extension *gdlll_get_element_extension(
+                                                    struct element *elem_ptr);
+static void gdlll_init_element_extension(
+                                    struct gdll_element_extension *ext_ptr);
+static void gdlll_free_element_extension(struct element *elem_ptr);
+static int gdlll_container_needs_element_extension(
+                                            struct gdll_container *gdllc_ptr);
+static int gdlll_make_room_in_indexes(struct gdll_container *gdllc_ptr,
+                                      struct element *elem_ptr,
+                                      long num_elements);
+static void gdlll_release_element_memory(struct gdll_container *gdllc_ptr,
+                                         struct element *elem_ptr);
+static struct element *gdlll_allocate_element_block(
+                                            struct gdll_container *gdllc_ptr,
+                                            unsigned int block_flags);
+static void gdlll_release_element_block(struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr);
+static void *gdlll_allocate_payload_block(struct gdll_container *gdllc_ptr,
+                                          long data_size,
+                                          unsigned int *payload_flags_ptr);
+static int gdlll_node_cache_payload_class(long data_size);
+static void gdlll_node_cache_register(void);
+#if !defined(GDLLL_NO_THREADS)
+static void gdlll_node_cache_create_key(void);
+static void gdlll_node_cache_thread_exit(void *arg);
+#endif
+static int gdlll_arena_start(struct gdll_container *gdllc_ptr, int numa_node);
+static int gdlll_arena_add_region(struct gdll_container *gdllc_ptr);
+static void gdlll_arena_free_region(struct gdll_arena_region *region_ptr);
+static void gdlll_arena_free_all_regions(struct gdll_container *gdllc_ptr);
+static void *gdlll_arena_take_new_block(struct gdll_container *gdllc_ptr,
+                                        long block_size);
+static void gdlll_arena_delete_all_elements(struct gdll_container *gdllc_ptr);
+static void gdlll_arena_reset(struct gdll_container *gdllc_ptr);
+static void gdlll_arena_count_block(struct gdll_container *gdllc_ptr,
+                                    void *block_ptr, long change);
+static struct element *gdlll_relayout_element(struct gdll_container *gdllc_ptr,
+                                              struct element *old_elem_ptr);
+static void gdlll_arena_free_empty_regions(struct gdll_container *gdllc_ptr);
+static int gdlll_resume_continuation(struct gdll_container *gdllc_ptr,
+                                     struct gdll_continuation *cont_ptr,
+                                     int operation);
+static void gdlll_end_continuation(struct gdll_continuation *cont_ptr);
+static void gdlll_replace_element_in_continuations(
+                                            struct gdll_container *gdllc_ptr,
+                                            struct element *old_elem_ptr,
+                                            struct element *new_elem_ptr);
+static void gdlll_move_continuations(struct gdll_container *gdllc_ptr,
+                                     struct element *elem_ptr);
+static void gdlll_free_pending_elements(struct gdll_container *gdllc_ptr,
+                                        struct gdll_continuation *cont_ptr);
+static long gdlll_get_time_in_microseconds(void);
+static int gdlll_budget_is_used_up(long num_processed, long max_elements,
+                                   long max_microseconds, long start_time);
+static void gdlll_move_element_before_element(
+                                        struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr,
+                                        struct element *before_elem_ptr);
+static int gdlll_make_room_in_ring(struct gdll_container *gdllc_ptr,
+                                   long data_size, long num_elements);
+static void gdlll_count_memory(struct gdll_container *gdllc_ptr, long change);
+static int gdlll_make_room_under_memory_limit(struct gdll_container *gdllc_ptr,
+                                              long data_size,
+                                              long num_elements);
+#if defined(GDLLL_FAULT_INJECTION)
+static int gdlll_allocation_must_fail(void);
+#endif
+#if !defined(GDLLL_NO_THREADS)
+static void gdlll_async_deleter_push(struct gdll_async_deleter *deleter_ptr,
+                                     struct element *elem_ptr);
+static void *gdlll_async_deleter_thread(void *arg);
+#endif
+static int gdlll_add_element_sorted_near_hint(struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        struct element *hint_elem_ptr,
+                                        int sorting_order);
+static int gdlll_element_goes_after(int comp_result, int sorting_order);
+static int gdlll_is_valid_search_strategy(int search_strategy);
+static struct element *gdlll_find_matching_element(
+                                        struct gdll_container *gdllc_ptr,
+                                        struct element *key_elem_ptr,
+                                        compare_elements_function comp_func,
+                                        int search_strategy);
+static struct element *gdlll_find_lower_bound(struct gdll_container *gdllc_ptr,
+                                        struct element *key_elem_ptr,
+                                        compare_elements_function comp_func,
+                                        int sorting_order);
 static void gdlll_remove_element_from_list(struct gdll_container *gdllc_ptr,
                                            struct element *elem_ptr);
+static void gdlll_unlink_element(struct gdll_container *gdllc_ptr,
+                                 struct element *elem_ptr);
+static void gdlll_destroy_element(struct gdll_container *gdllc_ptr,
+                                  struct element *elem_ptr);
+static void gdlll_free_element(struct gdll_container *gdllc_ptr,
+                               struct element *elem_ptr);
+static void gdlll_delete_element_in_list(struct gdll_container *gdllc_ptr,
+                                         struct element *elem_ptr);
+static void gdlll_epoch_retire_element(struct gdll_container *gdllc_ptr,
+                                       struct element *elem_ptr);
+static long gdlll_epoch_try_to_advance(struct gdll_container *gdllc_ptr);
+static long gdlll_free_retired_list(struct gdll_container *gdllc_ptr,
+                                    struct element **list_ptr);
+static int gdlll_element_is_in_snapshot(struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr);
+static void gdlll_snapshot_retire_element(struct gdll_container *gdllc_ptr,
+                                          struct element *elem_ptr);
+static void gdlll_free_all_snapshots(struct gdll_container *gdllc_ptr);
+static void gdlll_purge_tombstones_if_needed(struct gdll_container *gdllc_ptr);
+static void gdlll_trim_tombstones(struct gdll_container *gdllc_ptr);
+static void gdlll_add_element_to_integer_key_index(
+                                            struct gdll_container *gdllc_ptr,
+                                            struct element *elem_ptr);
+static void gdlll_remove_element_from_integer_key_index(
+                                            struct gdll_container *gdllc_ptr,
+                                            struct element *elem_ptr);
+static int gdlll_rebuild_integer_key_index(struct gdll_container *gdllc_ptr);
+static int gdlll_reserve_integer_key_index(struct gdll_container *gdllc_ptr,
+                                           long min_capacity);
+static void gdlll_add_element_to_indexes(struct gdll_container *gdllc_ptr,
+                                         struct element *elem_ptr);
+static void gdlll_remove_element_from_indexes(struct gdll_container *gdllc_ptr,
+                                              struct element *elem_ptr);
+static void gdlll_add_element_to_heap(struct gdll_container *gdllc_ptr,
+                                      struct element *elem_ptr);
+static int gdlll_reserve_heap(struct gdll_container *gdllc_ptr,
+                              long min_capacity);
+static void gdlll_remove_element_from_heap(struct gdll_container *gdllc_ptr,
+                                           struct element *elem_ptr);
+static void gdlll_heap_sift_up(struct gdll_container *gdllc_ptr, long index);
+static void gdlll_heap_sift_down(struct gdll_container *gdllc_ptr, long index);
+static int gdlll_rebuild_heap(struct gdll_container *gdllc_ptr);
+static struct element *gdlll_find_min_element(
+                                            struct gdll_container *gdllc_ptr);
+static struct element *gdlll_find_element_at_position(
+                                            struct gdll_container *gdllc_ptr,
+                                            long position);
+static void gdlll_add_element_to_order_statistic_index(
+                                            struct gdll_container *gdllc_ptr,
+                                            struct element *elem_ptr);
+static void gdlll_remove_element_from_order_statistic_index(
+                                            struct gdll_container *gdllc_ptr,
+                                            struct element *elem_ptr);
+static void gdlll_order_statistic_rotate_up(struct gdll_container *gdllc_ptr,
+                                            struct gdll_order_node *node_ptr);
+static int gdlll_rebuild_order_statistic_index(
+                                            struct gdll_container *gdllc_ptr);
+static void gdlll_free_order_statistic_index(struct gdll_container *gdllc_ptr);
+static void gdlll_move_order_statistic_node(struct gdll_container *gdllc_ptr,
+                                        struct gdll_order_node *old_node_ptr,
+                                        struct element *elem_ptr);
+static int gdlll_order_statistic_index_is_usable(
+                                            struct gdll_container *gdllc_ptr);
+static struct element *gdlll_find_bound(struct gdll_container *gdllc_ptr,
+                                        struct element *key_elem_ptr,
+                                        compare_elements_function comp_func,
+                                        int sorting_order, int upper_bound);
+static long gdlll_peek_range_and_memory_size(struct gdll_container *gdllc_ptr,
+                                    void *from_data_ptr, long from_data_size,
+                                    void *to_data_ptr, long to_data_size,
+                                    compare_elements_function comp_func,
+                                    int search_strategy,
+                                    struct element **range_first_ptr,
+                                    struct element **range_last_ptr,
+                                    long *memory_size_ptr);
+static long gdlll_find_range(struct gdll_container *gdllc_ptr,
+                             struct element *from_key_elem_ptr,
+                             struct element *to_key_elem_ptr,
+                             compare_elements_function comp_func,
+                             int sorting_order,
+                             struct element **range_first_ptr,
+                             struct element **range_last_ptr,
+                             long *memory_size_ptr);
+static int gdlll_has_no_per_element_state(struct gdll_container *gdllc_ptr);
+static int gdlll_container_owns_element_memory(
+                                        struct gdll_container *gdllc_ptr);
+static long gdlll_find_integer_key(const long *keys, long num_keys, long key);
+static long gdlll_find_min_integer_key_not_less_than(const long *keys,
+                                                     long num_keys, long key);
+#ifdef GDLLL_X86_64_SIMD
+static long gdlll_find_integer_key_avx2(const long *keys, long num_keys,
+                                        long key);
+static long gdlll_find_integer_key_sse42(const long *keys, long num_keys,
+                                         long key);
+static long gdlll_find_min_integer_key_not_less_than_avx2(const long *keys,
+                                                          long num_keys,
+                                                          long key);
+static long gdlll_find_min_integer_key_not_less_than_sse42(const long *keys,
+                                                           long num_keys,
+                                                           long key);
+#endif
 static void gdlll_insert_element_before_element(
                             struct gdll_container *gdllc_ptr,
                             struct element *elem_to_insert_ptr,
                             struct element *elem_before_which_to_insert_ptr);
+static int gdlll_compact_is_valid_index(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    unsigned int index);
+static int gdlll_compact_reserve_data_pool_bytes(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    unsigned long num_bytes);
+static void gdlll_compact_compact_data_pool(
+                                    struct gdll_compact_container *gdllcc_ptr);
+static unsigned int gdlll_compact_create_standalone_element(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    void *data_ptr, long data_size);
+static void gdlll_timer_wheel_add_timer(struct gdll_timer_wheel *gdlltw_ptr,
+                                        struct element *elem_ptr,
+                                        long min_time);
+static void gdlll_timer_wheel_remove_timer(struct gdll_timer_wheel *gdlltw_ptr,
+                                           struct element *elem_ptr);
+static int gdlll_timer_wheel_is_armed(struct element *elem_ptr);
 
 struct gdll_container *gdlll_init_gdll_container(
                             void *function_ptr_to_call_before_deleting_data)
@@ -45,6 +667,68 @@ struct gdll_container *gdlll_init_gdll_container(
     gdllc_ptr->first = NULL;
     gdllc_ptr->last = NULL;
     gdllc_ptr->total_number_of_elements = 0;
+    gdllc_ptr->sorted_insertion_finger = NULL;
+    gdllc_ptr->integer_key_index_enabled = 0;
+    gdllc_ptr->integer_key_index_is_stale = 0;
+    gdllc_ptr->integer_keys = NULL;
+    gdllc_ptr->integer_key_elems = NULL;
+    gdllc_ptr->integer_key_index_size = 0;
+    gdllc_ptr->integer_key_index_capacity = 0;
+    gdllc_ptr->lazy_deletion_enabled = 0;
+    gdllc_ptr->tombstone_purge_threshold_percent = 0;
+    gdllc_ptr->number_of_tombstones = 0;
+    gdllc_ptr->tombstone_list = NULL;
+    gdllc_ptr->epoch_reclamation_enabled = 0;
+    gdllc_ptr->epoch_max_readers = 0;
+    gdllc_ptr->global_epoch = 0;
+    gdllc_ptr->epoch_reader_slots = NULL;
+    gdllc_ptr->epoch_retired_lists[0] = NULL;
+    gdllc_ptr->epoch_retired_lists[1] = NULL;
+    gdllc_ptr->epoch_retired_lists[2] = NULL;
+    gdllc_ptr->epoch_number_of_retired_elements = 0;
+    gdllc_ptr->epoch_retired_since_last_reclaim = 0;
+    gdllc_ptr->priority_queue_enabled = 0;
+    gdllc_ptr->heap_is_stale = 0;
+    gdllc_ptr->priority_queue_comp_func = NULL;
+    gdllc_ptr->heap = NULL;
+    gdllc_ptr->heap_size = 0;
+    gdllc_ptr->heap_capacity = 0;
+    gdllc_ptr->ring_capacity = 0;
+    gdllc_ptr->ring_max_data_size = 0;
+    gdllc_ptr->ring_slot_size = 0;
+    gdllc_ptr->ring_when_full = 0;
+    gdllc_ptr->ring_slots = NULL;
+    gdllc_ptr->ring_free_list = NULL;
+    gdllc_ptr->ring_number_of_free_slots = 0;
+    gdllc_ptr->ring_disabled_slots = NULL;
+    gdllc_ptr->ring_disabled_slots_size = 0;
+    gdllc_ptr->ring_disabled_number_of_slots_in_use = 0;
+    gdllc_ptr->order_statistic_index_enabled = 0;
+    gdllc_ptr->order_statistic_index_is_stale = 0;
+    gdllc_ptr->order_root = NULL;
+    gdllc_ptr->order_random_state = 0x9E3779B97F4A7C15UL;
+    gdllc_ptr->snapshots = NULL;
+    gdllc_ptr->snapshot_version = 0;
+    gdllc_ptr->oldest_snapshot_version_in_use = 1;
+    gdllc_ptr->snapshot_retired_list = NULL;
+    gdllc_ptr->snapshot_number_of_retired_elements = 0;
+    gdllc_ptr->snapshot_retired_since_last_reclaim = 0;
+    gdllc_ptr->async_deleter = NULL;
+    gdllc_ptr->node_cache_enabled = 0;
+    gdllc_ptr->arena_mode_enabled = 0;
+    gdllc_ptr->arena_numa_node = GDLLL_NO_NUMA_NODE;
+    gdllc_ptr->arena_regions = NULL;
+    gdllc_ptr->arena_number_of_regions = 0;
+    gdllc_ptr->arena_number_of_blocks_in_use = 0;
+    gdllc_ptr->arena_free_blocks = NULL;
+    gdllc_ptr->arena_next_free_block = NULL;
+    gdllc_ptr->arena_end = NULL;
+    gdllc_ptr->relayout_in_progress = 0;
+    gdllc_ptr->relayout_next_element = NULL;
+    gdllc_ptr->continuations = NULL;
+    gdllc_ptr->memory_in_use = 0;
+    gdllc_ptr->memory_limit = 0;
+    gdllc_ptr->choose_element_to_evict = NULL;
     gdllc_ptr->call_function_before_deleting_data =
                                     function_ptr_to_call_before_deleting_data;
 
@@ -69,6 +753,7 @@ int gdlll_add_element_to_front(struct gdll_container *gdllc_ptr, void *data_ptr,
 {
 
     struct element *elem_ptr = NULL;
+    int retval = GDLLL_ERROR_INIT_VALUE;
 
     if (!gdllc_ptr) {
         return GDLLL_GDLLC_PTR_IS_NULL;
@@ -82,20 +767,27 @@ int gdlll_add_element_to_front(struct gdll_container *gdllc_ptr, void *data_ptr,
         return GDLLL_DATA_SIZE_IS_INVALID;
     }
 
-    elem_ptr = gdlll_create_standalone_element(data_ptr, data_size);
+    if (gdllc_ptr->ring_capacity > 0) {
+        retval = gdlll_make_room_in_ring(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
+
+    if (gdllc_ptr->memory_limit > 0) {
+        retval = gdlll_make_room_under_memory_limit(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
+
+    elem_ptr = gdlll_create_standalone_element(gdllc_ptr, data_ptr, data_size);
 
     if (!elem_ptr) {
         return GDLLL_NO_MEMORY;
     }
 
-    if (gdllc_ptr->first == NULL) {
-        gdllc_ptr->first = elem_ptr;
-        gdllc_ptr->last = elem_ptr;
-    } else {
-        elem_ptr->next = gdllc_ptr->first;
-        elem_ptr->next->prev = elem_ptr;
-        gdllc_ptr->first = elem_ptr;
-    }
+    gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, gdllc_ptr->first);
 
     gdllc_ptr->total_number_of_elements =
                                     gdllc_ptr->total_number_of_elements + 1;
@@ -109,6 +801,7 @@ int gdlll_add_element_to_back(struct gdll_container *gdllc_ptr, void *data_ptr,
 {
 
     struct element *elem_ptr = NULL;
+    int retval = GDLLL_ERROR_INIT_VALUE;
 
     if (!gdllc_ptr) {
         return GDLLL_GDLLC_PTR_IS_NULL;
@@ -122,20 +815,27 @@ int gdlll_add_element_to_back(struct gdll_container *gdllc_ptr, void *data_ptr,
         return GDLLL_DATA_SIZE_IS_INVALID;
     }
 
-    elem_ptr = gdlll_create_standalone_element(data_ptr, data_size);
+    if (gdllc_ptr->ring_capacity > 0) {
+        retval = gdlll_make_room_in_ring(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
+
+    if (gdllc_ptr->memory_limit > 0) {
+        retval = gdlll_make_room_under_memory_limit(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
+
+    elem_ptr = gdlll_create_standalone_element(gdllc_ptr, data_ptr, data_size);
 
     if (!elem_ptr) {
         return GDLLL_NO_MEMORY;
     }
 
-    if (gdllc_ptr->first == NULL) {
-        gdllc_ptr->first = elem_ptr;
-        gdllc_ptr->last = elem_ptr;
-    } else {
-        gdllc_ptr->last->next = elem_ptr;
-        elem_ptr->prev = gdllc_ptr->last;
-        gdllc_ptr->last = elem_ptr;
-    }
+    gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, NULL);
 
     gdllc_ptr->total_number_of_elements =
                                     gdllc_ptr->total_number_of_elements + 1;
@@ -150,6 +850,7 @@ int gdlll_add_element_sorted_ascending(struct gdll_container *gdllc_ptr,
 {
 
     struct element *elem_ptr = NULL;
+    int retval = GDLLL_ERROR_INIT_VALUE;
 
     if (!gdllc_ptr) {
         return GDLLL_GDLLC_PTR_IS_NULL;
@@ -167,15 +868,28 @@ int gdlll_add_element_sorted_ascending(struct gdll_container *gdllc_ptr,
         return GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL;
     }
 
-    elem_ptr = gdlll_create_standalone_element(data_ptr, data_size);
+    if (gdllc_ptr->ring_capacity > 0) {
+        retval = gdlll_make_room_in_ring(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
+
+    if (gdllc_ptr->memory_limit > 0) {
+        retval = gdlll_make_room_under_memory_limit(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
+
+    elem_ptr = gdlll_create_standalone_element(gdllc_ptr, data_ptr, data_size);
 
     if (!elem_ptr) {
         return GDLLL_NO_MEMORY;
     }
 
     if (gdllc_ptr->first == NULL) {
-        gdllc_ptr->first = elem_ptr;
-        gdllc_ptr->last = elem_ptr;
+        gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, NULL);
     } else {
         struct element *temp = gdllc_ptr->first;
         while ((temp) && (comp_func(elem_ptr, temp) > 0)) {
@@ -185,6 +899,8 @@ int gdlll_add_element_sorted_ascending(struct gdll_container *gdllc_ptr,
         gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, temp);
     }
 
+    gdllc_ptr->sorted_insertion_finger = elem_ptr;
+
     gdllc_ptr->total_number_of_elements =
                                     gdllc_ptr->total_number_of_elements + 1;
 
@@ -192,12 +908,26 @@ int gdlll_add_element_sorted_ascending(struct gdll_container *gdllc_ptr,
 
 } // end of gdlll_add_element_sorted_ascending() function
 
+int gdlll_add_element_sorted_ascending_near_hint(
+                                        struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        struct element *hint_elem_ptr)
+{
+
+    return gdlll_add_element_sorted_near_hint(gdllc_ptr, data_ptr, data_size,
+                                              comp_func, hint_elem_ptr,
+                                              GDLLL_ASCENDING_ORDER);
+
+} // end of gdlll_add_element_sorted_ascending_near_hint() function
+
 int gdlll_add_element_sorted_descending(struct gdll_container *gdllc_ptr,
                                         void *data_ptr, long data_size,
                                         compare_elements_function comp_func)
 {
 
     struct element *elem_ptr = NULL;
+    int retval = GDLLL_ERROR_INIT_VALUE;
 
     if (!gdllc_ptr) {
         return GDLLL_GDLLC_PTR_IS_NULL;
@@ -215,15 +945,28 @@ int gdlll_add_element_sorted_descending(struct gdll_container *gdllc_ptr,
         return GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL;
     }
 
-    elem_ptr = gdlll_create_standalone_element(data_ptr, data_size);
+    if (gdllc_ptr->ring_capacity > 0) {
+        retval = gdlll_make_room_in_ring(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
+
+    if (gdllc_ptr->memory_limit > 0) {
+        retval = gdlll_make_room_under_memory_limit(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
+
+    elem_ptr = gdlll_create_standalone_element(gdllc_ptr, data_ptr, data_size);
 
     if (!elem_ptr) {
         return GDLLL_NO_MEMORY;
     }
 
     if (gdllc_ptr->first == NULL) {
-        gdllc_ptr->first = elem_ptr;
-        gdllc_ptr->last = elem_ptr;
+        gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, NULL);
     } else {
         struct element *temp = gdllc_ptr->first;
         while ((temp) && (comp_func(elem_ptr, temp) < 0)) {
@@ -233,6 +976,8 @@ int gdlll_add_element_sorted_descending(struct gdll_container *gdllc_ptr,
         gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, temp);
     }
 
+    gdllc_ptr->sorted_insertion_finger = elem_ptr;
+
     gdllc_ptr->total_number_of_elements =
                                     gdllc_ptr->total_number_of_elements + 1;
 
@@ -240,488 +985,7653 @@ int gdlll_add_element_sorted_descending(struct gdll_container *gdllc_ptr,
 
 } // end of gdlll_add_element_sorted_descending() function
 
-struct element *gdlll_get_front_element(struct gdll_container *gdllc_ptr)
+int gdlll_add_element_sorted_descending_near_hint(
+                                        struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        struct element *hint_elem_ptr)
+{
+
+    return gdlll_add_element_sorted_near_hint(gdllc_ptr, data_ptr, data_size,
+                                              comp_func, hint_elem_ptr,
+                                              GDLLL_DESCENDING_ORDER);
+
+} // end of gdlll_add_element_sorted_descending_near_hint() function
+
+// This function is used by gdlll_add_element_sorted_ascending_near_hint() and
+// gdlll_add_element_sorted_descending_near_hint(). The new element is inserted
+// before the first element that it doesn't go after (as in
+// gdlll_add_element_sorted_ascending() and
+// gdlll_add_element_sorted_descending()), but the scan starts from the 'last'
+// element and then from the hint (or the finger) instead of the first element.
+static int gdlll_add_element_sorted_near_hint(struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        struct element *hint_elem_ptr,
+                                        int sorting_order)
 {
 
+    struct element *elem_ptr = NULL;
+    int retval = GDLLL_ERROR_INIT_VALUE;
     struct element *temp = NULL;
 
     if (!gdllc_ptr) {
-        return NULL;
+        return GDLLL_GDLLC_PTR_IS_NULL;
     }
 
-    if (gdllc_ptr->total_number_of_elements == 0) {
-        return NULL;
+    if (!data_ptr) {
+        return GDLLL_DATA_PTR_IS_NULL;
     }
 
-    temp = gdllc_ptr->first;
-
-    gdlll_remove_element_from_list(gdllc_ptr, gdllc_ptr->first);
+    if (data_size <= 0) {
+        return GDLLL_DATA_SIZE_IS_INVALID;
+    }
 
-    gdllc_ptr->total_number_of_elements =
-                                    gdllc_ptr->total_number_of_elements - 1;
+    if (!comp_func) {
+        return GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL;
+    }
 
-    return temp;
+    // The hint may be deleted to make room for the new element (by ring mode
+    // or by the memory limit), so it becomes the finger (which is moved to a
+    // neighbor of its element when the element is removed from the list).
+    if ((hint_elem_ptr) &&
+        ((gdllc_ptr->ring_capacity > 0) || (gdllc_ptr->memory_limit > 0))) {
+        gdllc_ptr->sorted_insertion_finger = hint_elem_ptr;
+        hint_elem_ptr = NULL;
+    }
 
-} // end of gdlll_get_front_element() function
+    if (gdllc_ptr->ring_capacity > 0) {
+        retval = gdlll_make_room_in_ring(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
 
-struct element *gdlll_get_last_element(struct gdll_container *gdllc_ptr)
-{
+    if (gdllc_ptr->memory_limit > 0) {
+        retval = gdlll_make_room_under_memory_limit(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
 
-    struct element *temp = NULL;
+    elem_ptr = gdlll_create_standalone_element(gdllc_ptr, data_ptr, data_size);
 
-    if (!gdllc_ptr) {
-        return NULL;
+    if (!elem_ptr) {
+        return GDLLL_NO_MEMORY;
     }
 
-    if (gdllc_ptr->total_number_of_elements == 0) {
-        return NULL;
-    }
+    if (gdllc_ptr->first == NULL) {
+        gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, NULL);
+    } else if (gdlll_element_goes_after(comp_func(elem_ptr, gdllc_ptr->last),
+                                        sorting_order)) {
+        // add elem_ptr to back
+        gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, NULL);
+    } else {
 
-    temp = gdllc_ptr->last;
+        temp = hint_elem_ptr;
+        if (!temp) {
+            temp = gdllc_ptr->sorted_insertion_finger;
+        }
+        if (!temp) {
+            temp = gdllc_ptr->last;
+        }
 
-    gdlll_remove_element_from_list(gdllc_ptr, gdllc_ptr->last);
+        if (gdlll_element_goes_after(comp_func(elem_ptr, temp),
+                                     sorting_order)) {
+            // scan forward
+            temp = temp->next;
+            while ((temp) && (gdlll_element_goes_after(
+                                comp_func(elem_ptr, temp), sorting_order))) {
+                temp = temp->next;
+            }
+        } else {
+            // scan backward
+            while ((temp->prev) && (!gdlll_element_goes_after(
+                            comp_func(elem_ptr, temp->prev), sorting_order))) {
+                temp = temp->prev;
+            }
+        }
+
+        // insert elem_ptr before temp
+        gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, temp);
+
+    }
+
+    gdllc_ptr->sorted_insertion_finger = elem_ptr;
 
     gdllc_ptr->total_number_of_elements =
-                                    gdllc_ptr->total_number_of_elements - 1;
+                                    gdllc_ptr->total_number_of_elements + 1;
 
-    return temp;
+    return GDLLL_SUCCESS;
 
-} // end of gdlll_get_last_element() function
+} // end of gdlll_add_element_sorted_near_hint() function
 
-struct element *gdlll_get_matching_element(struct gdll_container *gdllc_ptr,
-                                           void *data_ptr, long data_size,
-                                           compare_elements_function comp_func)
+// This function returns 1 if an element whose comparison result (as returned
+// by the user's comparator) with another element is 'comp_result' has to be
+// placed after that element in a list sorted in 'sorting_order', otherwise it
+// returns 0.
+static int gdlll_element_goes_after(int comp_result, int sorting_order)
 {
 
-    struct element *matching_elem_ptr = NULL;
-
-    if (!gdllc_ptr) {
-        return NULL;
+    if (sorting_order == GDLLL_ASCENDING_ORDER) {
+        return (comp_result > 0);
     }
 
-    if (!data_ptr) {
-        return NULL;
-    }
+    return (comp_result < 0);
 
-    if (data_size <= 0) {
+} // end of gdlll_element_goes_after() function
+
+struct element *gdlll_allocate_standalone_element(
+                                            struct gdll_container *gdllc_ptr,
+                                            long data_size)
+{
+
+    if (!gdllc_ptr) {
         return NULL;
     }
 
-    if (!comp_func) {
+    if (data_size <= 0) {
         return NULL;
     }
 
-    if (gdllc_ptr->total_number_of_elements == 0) {
+    if ((gdllc_ptr->ring_capacity > 0) &&
+        (gdlll_make_room_in_ring(gdllc_ptr, data_size, 1) != GDLLL_SUCCESS)) {
         return NULL;
     }
 
-    matching_elem_ptr = gdlll_peek_matching_element(gdllc_ptr, data_ptr,
-                                                    data_size, comp_func);
-
-    if (matching_elem_ptr == NULL) {
+    if ((gdllc_ptr->memory_limit > 0) &&
+        (gdlll_make_room_under_memory_limit(gdllc_ptr, data_size, 1) !=
+                                                            GDLLL_SUCCESS)) {
         return NULL;
     }
 
-    gdlll_remove_element_from_list(gdllc_ptr, matching_elem_ptr);
-
-    gdllc_ptr->total_number_of_elements =
-                                    gdllc_ptr->total_number_of_elements - 1;
-
-    return matching_elem_ptr;
+    return gdlll_create_standalone_element(gdllc_ptr, NULL, data_size);
 
-} // end of gdlll_get_matching_element() function
+} // end of gdlll_allocate_standalone_element() function
 
-// This function doesn't check the validity of its arguments. It is the
-// responsibility of the calling function to check the arguments it is passing
-// to this function.
-static struct element *gdlll_create_standalone_element(void *data_ptr,
-                                                       long data_size)
+int gdlll_insert_standalone_element_before_element(
+                                struct gdll_container *gdllc_ptr,
+                                struct element *elem_to_insert_ptr,
+                                struct element *elem_before_which_to_insert_ptr)
 {
-    struct element *elem_ptr = NULL;
 
-    elem_ptr = calloc(sizeof(*elem_ptr), 1);
-    if (!elem_ptr) {
-        return NULL;
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
     }
 
-    elem_ptr->data_ptr = calloc((size_t)(data_size), 1);
-    if (!(elem_ptr->data_ptr)) {
-        free(elem_ptr);
-        return NULL;
+    if (!elem_to_insert_ptr) {
+        return GDLLL_ELEMENT_PTR_IS_NULL;
     }
 
-    memmove(elem_ptr->data_ptr, data_ptr, (size_t)(data_size));
-    elem_ptr->data_size = data_size;
-
-    elem_ptr->prev = NULL;
-    elem_ptr->next = NULL;
-
-    return elem_ptr;
-
-} // end of gdlll_create_standalone_element() function
-
-// This function doesn't check the validity of its arguments. It is the
-// responsibility of the calling function to check the arguments it is passing
-// to this function. This function just removes the element from the list,
-// it doesn't decrement total_number_of_elements by 1. Decrementing has to be
-// done in the calling function. This function should not be called if the
-// number of elements in the container is 0. The calling function should first
-// check whether the number of elements in the container is 0 or not.
-static void gdlll_remove_element_from_list(struct gdll_container *gdllc_ptr,
-                                           struct element *elem_ptr)
-{
-
-    if (elem_ptr == gdllc_ptr->first) {
-        gdllc_ptr->first = elem_ptr->next;
-        if (gdllc_ptr->first == NULL) {
-            gdllc_ptr->last = NULL;
-        } else {
-            gdllc_ptr->first->prev = NULL;
-        }
-    } else if (elem_ptr == gdllc_ptr->last) {
-        gdllc_ptr->last = elem_ptr->prev;
-        if (gdllc_ptr->last == NULL) {
-            gdllc_ptr->first = NULL;
-        } else {
-            gdllc_ptr->last->next = NULL;
-        }
-    } else {
-        elem_ptr->prev->next = elem_ptr->next;
-        elem_ptr->next->prev = elem_ptr->prev;
+    // 'elem_to_insert_ptr' must not be in a list already
+    if ((elem_to_insert_ptr->prev) || (elem_to_insert_ptr->next) ||
+        (elem_to_insert_ptr == gdllc_ptr->first)) {
+        return GDLLL_ELEMENT_IS_NOT_STANDALONE;
     }
 
-    elem_ptr->prev = NULL;
-    elem_ptr->next = NULL;
+    if (gdlll_make_room_in_indexes(gdllc_ptr, elem_to_insert_ptr, 1) !=
+                                                            GDLLL_SUCCESS) {
+        return GDLLL_NO_MEMORY;
+    }
 
-} // end of gdlll_remove_element_from_list() function
+    gdlll_insert_element_before_element(gdllc_ptr, elem_to_insert_ptr,
+                                        elem_before_which_to_insert_ptr);
 
-// This function doesn't check the validity of its arguments. It is the
-// responsibility of the calling function to check the arguments it is passing
-// to this function. This function just inserts the element in the list at the
-// appropriate place, it doesn't increment total_number_of_elements by 1.
-// Incrementing has to be done in the calling function. This function should not
-// be called if the number of elements in the container is 0. The calling
-// function should first check whether the number of elements in the container
-// is 0 or not.
-static void gdlll_insert_element_before_element(
-                                            struct gdll_container *gdllc_ptr,
-                                          struct element *elem_to_insert_ptr,
-                             struct element *elem_before_which_to_insert_ptr)
-{
+    gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements + 1;
 
-    if (elem_before_which_to_insert_ptr == NULL) {
+    return GDLLL_SUCCESS;
 
-        // add elem_to_insert_ptr to back
-        gdllc_ptr->last->next = elem_to_insert_ptr;
-        elem_to_insert_ptr->prev = gdllc_ptr->last;
-        gdllc_ptr->last = elem_to_insert_ptr;
+} // end of gdlll_insert_standalone_element_before_element() function
 
-    } else if (elem_before_which_to_insert_ptr == gdllc_ptr->first) {
+void *gdlll_emplace_element_to_front(struct gdll_container *gdllc_ptr,
+                                     long data_size)
+{
 
-        // add elem_to_insert_ptr to front
-        elem_to_insert_ptr->next = gdllc_ptr->first;
-        elem_to_insert_ptr->next->prev = elem_to_insert_ptr;
-        gdllc_ptr->first = elem_to_insert_ptr;
+    struct element *elem_ptr = NULL;
 
-    } else {
+    if (!gdllc_ptr) {
+        return NULL;
+    }
 
-        // insert elem_to_insert_ptr before elem_before_which_to_insert_ptr
-        elem_to_insert_ptr->next = elem_before_which_to_insert_ptr;
-        elem_to_insert_ptr->prev = elem_before_which_to_insert_ptr->prev;
-        elem_before_which_to_insert_ptr->prev = elem_to_insert_ptr;
-        elem_to_insert_ptr->prev->next = elem_to_insert_ptr;
+    if (data_size <= 0) {
+        return NULL;
+    }
 
+    if ((gdllc_ptr->ring_capacity > 0) &&
+        (gdlll_make_room_in_ring(gdllc_ptr, data_size, 1) != GDLLL_SUCCESS)) {
+        return NULL;
     }
 
-} // end of gdlll_insert_element_before_element() function
+    if ((gdllc_ptr->memory_limit > 0) &&
+        (gdlll_make_room_under_memory_limit(gdllc_ptr, data_size, 1) !=
+                                                            GDLLL_SUCCESS)) {
+        return NULL;
+    }
 
-struct element *gdlll_peek_front_element(struct gdll_container *gdllc_ptr)
-{
+    elem_ptr = gdlll_create_standalone_element(gdllc_ptr, NULL, data_size);
 
-    if (!gdllc_ptr) {
+    if (!elem_ptr) {
         return NULL;
     }
 
-    return (gdllc_ptr->first);
-
-} // end of gdlll_peek_front_element() function
+    // The data is not filled in yet, so its key can't be put in the integer
+    // key index (or the heap) now. The index will be rebuilt by the next
+    // search (and the heap by the next peek/get of the minimum).
+    if (gdllc_ptr->integer_key_index_enabled) {
+        gdllc_ptr->integer_key_index_is_stale = 1;
+    }
+    if (gdllc_ptr->priority_queue_enabled) {
+        gdllc_ptr->heap_is_stale = 1;
+    }
 
-struct element *gdlll_peek_last_element(struct gdll_container *gdllc_ptr)
-{
+    gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, gdllc_ptr->first);
 
-    if (!gdllc_ptr) {
-        return NULL;
-    }
+    gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements + 1;
 
-    return (gdllc_ptr->last);
+    return elem_ptr->data_ptr;
 
-} // end of gdlll_peek_last_element() function
+} // end of gdlll_emplace_element_to_front() function
 
-struct element *gdlll_peek_matching_element(struct gdll_container *gdllc_ptr,
-                                            void *data_ptr, long data_size,
-                                            compare_elements_function comp_func)
+void *gdlll_emplace_element_to_back(struct gdll_container *gdllc_ptr,
+                                    long data_size)
 {
 
     struct element *elem_ptr = NULL;
-    struct element *temp = NULL;
 
     if (!gdllc_ptr) {
         return NULL;
     }
 
-    if (!data_ptr) {
-        return NULL;
-    }
-
     if (data_size <= 0) {
         return NULL;
     }
 
-    if (!comp_func) {
+    if ((gdllc_ptr->ring_capacity > 0) &&
+        (gdlll_make_room_in_ring(gdllc_ptr, data_size, 1) != GDLLL_SUCCESS)) {
         return NULL;
     }
 
-    if (gdllc_ptr->total_number_of_elements == 0) {
+    if ((gdllc_ptr->memory_limit > 0) &&
+        (gdlll_make_room_under_memory_limit(gdllc_ptr, data_size, 1) !=
+                                                            GDLLL_SUCCESS)) {
         return NULL;
     }
 
-    elem_ptr = gdlll_create_standalone_element(data_ptr, data_size);
+    elem_ptr = gdlll_create_standalone_element(gdllc_ptr, NULL, data_size);
 
     if (!elem_ptr) {
         return NULL;
     }
 
-    temp = gdllc_ptr->first;
-
-    while ((temp) && (comp_func(elem_ptr, temp) != 0)) {
-        temp = temp->next;
+    // The data is not filled in yet, so its key can't be put in the integer
+    // key index (or the heap) now. The index will be rebuilt by the next
+    // search (and the heap by the next peek/get of the minimum).
+    if (gdllc_ptr->integer_key_index_enabled) {
+        gdllc_ptr->integer_key_index_is_stale = 1;
+    }
+    if (gdllc_ptr->priority_queue_enabled) {
+        gdllc_ptr->heap_is_stale = 1;
     }
 
-    // free the memory allocated in gdlll_create_standalone_element()
-    free(elem_ptr->data_ptr);
-    free(elem_ptr);
+    gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, NULL);
 
-    return temp;
+    gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements + 1;
 
-} // end of gdlll_peek_matching_element() function
+    return elem_ptr->data_ptr;
 
-int gdlll_replace_data_in_matching_element(struct gdll_container *gdllc_ptr,
-                                         void *old_data_ptr, long old_data_size,
-                                         void *new_data_ptr, long new_data_size,
-                                         compare_elements_function comp_func)
+} // end of gdlll_emplace_element_to_back() function
+
+int gdlll_emplace_elements_to_back(struct gdll_container *gdllc_ptr,
+                                   long data_size, long num_elements,
+                                   void **data_ptrs)
 {
 
-    struct element *matching_elem_ptr = NULL;
-    void *temp_data_ptr = NULL;
+    struct element *chain_first = NULL;
+    struct element *chain_last = NULL;
+    struct element *elem_ptr = NULL;
+    long i = 0;
+    int retval = GDLLL_ERROR_INIT_VALUE;
 
     if (!gdllc_ptr) {
         return GDLLL_GDLLC_PTR_IS_NULL;
     }
 
-    if (!old_data_ptr) {
+    if (!data_ptrs) {
         return GDLLL_DATA_PTR_IS_NULL;
     }
 
-    if (old_data_size <= 0) {
+    if (data_size <= 0) {
         return GDLLL_DATA_SIZE_IS_INVALID;
     }
 
-    if (!new_data_ptr) {
-        return GDLLL_DATA_PTR_IS_NULL;
+    if (num_elements <= 0) {
+        return GDLLL_NUM_ELEMENTS_IS_INVALID;
     }
 
-    if (new_data_size <= 0) {
-        return GDLLL_DATA_SIZE_IS_INVALID;
+    if (gdllc_ptr->ring_capacity > 0) {
+        retval = gdlll_make_room_in_ring(gdllc_ptr, data_size, num_elements);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
     }
 
-    if (!comp_func) {
-        return GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL;
+    if (gdllc_ptr->memory_limit > 0) {
+        retval = gdlll_make_room_under_memory_limit(gdllc_ptr, data_size,
+                                                    num_elements);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
     }
 
-    if (gdllc_ptr->total_number_of_elements == 0) {
-        return GDLLL_CONTAINER_IS_EMPTY;
-    }
+    // First create all the elements (chained through 'next'), so that nothing
+    // is added to the list if there is no memory for any of them.
+    for (i = 0; i < num_elements; i = i + 1) {
+
+        elem_ptr = gdlll_create_standalone_element(gdllc_ptr, NULL, data_size);
+
+        if (!elem_ptr) {
+            // free the elements created so far (their data is not initialized,
+            // so call_function_before_deleting_data() is not called)
+            while (chain_first) {
+                elem_ptr = chain_first;
+                chain_first = chain_first->next;
+                gdlll_release_element_memory(gdllc_ptr, elem_ptr);
+            }
+            return GDLLL_NO_MEMORY;
+        }
 
-    matching_elem_ptr = gdlll_peek_matching_element(gdllc_ptr, old_data_ptr,
-                                                    old_data_size, comp_func);
+        if (chain_last) {
+            chain_last->next = elem_ptr;
+        } else {
+            chain_first = elem_ptr;
+        }
+        chain_last = elem_ptr;
 
-    if (matching_elem_ptr == NULL) {
-        return GDLLL_MATCHING_ELEMENT_NOT_FOUND;
     }
 
-    temp_data_ptr = calloc((size_t)(new_data_size), 1);
-    if (!temp_data_ptr) {
-        return GDLLL_NO_MEMORY;
+    // The data is not filled in yet, so its key can't be put in the integer
+    // key index (or the heap) now. The index will be rebuilt by the next
+    // search (and the heap by the next peek/get of the minimum).
+    if (gdllc_ptr->integer_key_index_enabled) {
+        gdllc_ptr->integer_key_index_is_stale = 1;
+    }
+    if (gdllc_ptr->priority_queue_enabled) {
+        gdllc_ptr->heap_is_stale = 1;
     }
 
-    // Now, call the call_function_before_deleting_data() for 'data_ptr' of the
-    // matching element and then free the 'data_ptr' of the matching element
-    if (gdllc_ptr->call_function_before_deleting_data) {
-        gdllc_ptr->call_function_before_deleting_data(
-                                                matching_elem_ptr->data_ptr);
+    // Now, add all the elements to the back of the list
+    i = 0;
+    while (chain_first) {
+        elem_ptr = chain_first;
+        chain_first = chain_first->next;
+        elem_ptr->next = NULL;
+        gdlll_insert_element_before_element(gdllc_ptr, elem_ptr, NULL);
+        data_ptrs[i] = elem_ptr->data_ptr;
+        i = i + 1;
     }
-    free(matching_elem_ptr->data_ptr);
 
-    matching_elem_ptr->data_ptr = temp_data_ptr;
-    memmove(matching_elem_ptr->data_ptr, new_data_ptr, (size_t)(new_data_size));
-    matching_elem_ptr->data_size = new_data_size;
+    gdllc_ptr->total_number_of_elements =
+                            gdllc_ptr->total_number_of_elements + num_elements;
 
     return GDLLL_SUCCESS;
 
-} // end of gdlll_replace_data_in_matching_element() function
+} // end of gdlll_emplace_elements_to_back() function
 
-void gdlll_delete_front_element(struct gdll_container *gdllc_ptr)
+struct element *gdlll_get_front_element(struct gdll_container *gdllc_ptr)
 {
 
-    struct element *temp_elem_ptr = NULL;
+    struct element *temp = NULL;
 
     if (!gdllc_ptr) {
-        return;
+        return NULL;
     }
 
-    temp_elem_ptr = gdllc_ptr->first;
+    if (gdllc_ptr->total_number_of_elements == 0) {
+        return NULL;
+    }
 
-    if (temp_elem_ptr) {
-        gdlll_remove_element_from_list(gdllc_ptr, temp_elem_ptr);
-        gdlll_delete_standalone_element(gdllc_ptr, temp_elem_ptr);
-        gdllc_ptr->total_number_of_elements =
-                                    gdllc_ptr->total_number_of_elements - 1;
+    // in priority queue mode, the front element is the smallest element
+    if (gdllc_ptr->priority_queue_enabled) {
+        temp = gdlll_find_min_element(gdllc_ptr);
+    } else {
+        temp = gdllc_ptr->first;
     }
 
-    return;
+    gdlll_remove_element_from_list(gdllc_ptr, temp);
 
-} // end of gdlll_delete_front_element() function
+    gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements - 1;
 
-void gdlll_delete_last_element(struct gdll_container *gdllc_ptr)
+    return temp;
+
+} // end of gdlll_get_front_element() function
+
+struct element *gdlll_get_last_element(struct gdll_container *gdllc_ptr)
 {
 
-    struct element *temp_elem_ptr = NULL;
+    struct element *temp = NULL;
 
     if (!gdllc_ptr) {
-        return;
+        return NULL;
     }
 
-    temp_elem_ptr = gdllc_ptr->last;
+    if (gdllc_ptr->total_number_of_elements == 0) {
+        return NULL;
+    }
 
-    if (temp_elem_ptr) {
-        gdlll_remove_element_from_list(gdllc_ptr, temp_elem_ptr);
-        gdlll_delete_standalone_element(gdllc_ptr, temp_elem_ptr);
-        gdllc_ptr->total_number_of_elements =
+    temp = gdllc_ptr->last;
+
+    gdlll_remove_element_from_list(gdllc_ptr, gdllc_ptr->last);
+
+    gdllc_ptr->total_number_of_elements =
                                     gdllc_ptr->total_number_of_elements - 1;
-    }
 
-    return;
+    return temp;
 
-} // end of gdlll_delete_last_element() function
+} // end of gdlll_get_last_element() function
 
-void gdlll_delete_matching_element(struct gdll_container *gdllc_ptr,
-                                   void *data_ptr, long data_size,
-                                   compare_elements_function comp_func)
+struct element *gdlll_get_matching_element(struct gdll_container *gdllc_ptr,
+                                           void *data_ptr, long data_size,
+                                           compare_elements_function comp_func)
+{
+
+    return gdlll_get_matching_element_using_strategy(gdllc_ptr, data_ptr,
+                                                     data_size, comp_func,
+                                                     GDLLL_SEARCH_FORWARD);
+
+} // end of gdlll_get_matching_element() function
+
+struct element *gdlll_get_matching_element_using_strategy(
+                                        struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        int search_strategy)
 {
 
     struct element *matching_elem_ptr = NULL;
 
     if (!gdllc_ptr) {
-        return;
+        return NULL;
     }
 
     if (!data_ptr) {
-        return;
+        return NULL;
     }
 
     if (data_size <= 0) {
-        return;
+        return NULL;
     }
 
     if (!comp_func) {
-        return;
+        return NULL;
     }
 
     if (gdllc_ptr->total_number_of_elements == 0) {
-        return;
+        return NULL;
     }
 
-    matching_elem_ptr = gdlll_peek_matching_element(gdllc_ptr, data_ptr,
-                                                    data_size, comp_func);
+    matching_elem_ptr = gdlll_peek_matching_element_using_strategy(gdllc_ptr,
+                                                data_ptr, data_size, comp_func,
+                                                search_strategy);
 
     if (matching_elem_ptr == NULL) {
-        return;
+        return NULL;
     }
 
     gdlll_remove_element_from_list(gdllc_ptr, matching_elem_ptr);
-    gdlll_delete_standalone_element(gdllc_ptr, matching_elem_ptr);
+
     gdllc_ptr->total_number_of_elements =
                                     gdllc_ptr->total_number_of_elements - 1;
 
-    return;
+    return matching_elem_ptr;
 
-} // end of gdlll_delete_matching_element() function
+} // end of gdlll_get_matching_element_using_strategy() function
 
-void gdlll_delete_standalone_element(struct gdll_container *gdllc_ptr,
-                                     struct element *element_to_delete)
+struct element *gdlll_get_given_element(struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr)
 {
 
     if (!gdllc_ptr) {
-        return;
+        return NULL;
     }
 
-    if (!element_to_delete) {
-        return;
+    if (!elem_ptr) {
+        return NULL;
     }
 
-    // Call the call_function_before_deleting_data() for 'data_ptr' of
-    // 'element_to_delete' and then free the 'data_ptr' of 'element_to_delete'.
-    // Then free the 'element_to_delete'.
-    if (gdllc_ptr->call_function_before_deleting_data) {
-        gdllc_ptr->call_function_before_deleting_data(
-                                                element_to_delete->data_ptr);
+    if (gdllc_ptr->total_number_of_elements == 0) {
+        return NULL;
     }
 
-    free(element_to_delete->data_ptr);
+    gdlll_remove_element_from_list(gdllc_ptr, elem_ptr);
 
-    free(element_to_delete);
+    gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements - 1;
 
-    return;
+    return elem_ptr;
 
-} // end of gdlll_delete_standalone_element() function
+} // end of gdlll_get_given_element() function
 
-void gdlll_delete_all_elements_in_gdll_container(
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. If 'data_ptr' is NULL then the data of the element is not
+// initialized. If 'gdllc_ptr' is in ring mode then the element is taken from
+// its free slots (NULL is returned if there is no free slot). 'gdllc_ptr' may
+// be NULL. The element gets what it needs to be added to the indexes of
+// 'gdllc_ptr' (see gdlll_make_room_in_indexes()), so NULL is also returned if
+// there is no memory for that.
+static struct element *gdlll_create_standalone_element(
+                                            struct gdll_container *gdllc_ptr,
+                                            void *data_ptr, long data_size)
+{
+
+    return gdlll_create_element(gdllc_ptr, data_ptr, data_size,
+                        gdlll_container_needs_element_extension(gdllc_ptr));
+
+} // end of gdlll_create_standalone_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function creates an element like
+// gdlll_create_standalone_element(). If 'with_extension' is 1 then the
+// extension of the element is allocated in the memory block of the element
+// (not for a slot of a ring, which gets it from malloc()).
+static struct element *gdlll_create_element(struct gdll_container *gdllc_ptr,
+                                            void *data_ptr, long data_size,
+                                            int with_extension)
+{
+
+    struct element *elem_ptr = NULL;
+    unsigned int block_flags = 0;
+    unsigned int payload_flags = 0;
+
+    if ((gdllc_ptr) && (gdllc_ptr->ring_capacity > 0)) {
+
+        if ((data_size > gdllc_ptr->ring_max_data_size) ||
+            (!gdllc_ptr->ring_free_list)) {
+            return NULL;
+        }
+
+        elem_ptr = gdllc_ptr->ring_free_list;
+        gdllc_ptr->ring_free_list = elem_ptr->next;
+        gdllc_ptr->ring_number_of_free_slots =
+                                    gdllc_ptr->ring_number_of_free_slots - 1;
+
+        // the data of a slot is always inside the slot
+        elem_ptr->flags = GDLLL_ELEMENT_IS_IN_RING |
+                          GDLLL_ELEMENT_HAS_INLINE_DATA_AREA;
+        elem_ptr->data_ptr = GDLLL_ELEMENT_INLINE_DATA_PTR(elem_ptr);
+        elem_ptr->extension = NULL;
+
+    } else {
+
+        // Small payloads are stored inside the element's memory block, so that
+        // only one allocation is needed for them. The block of an element with
+        // a bigger payload has no inline data area.
+        if (data_size <= GDLLL_INLINE_DATA_SIZE) {
+            block_flags = GDLLL_ELEMENT_HAS_INLINE_DATA_AREA;
+        }
+
+        if (with_extension) {
+            block_flags = block_flags | GDLLL_ELEMENT_HAS_EXTENSION_AREA;
+        }
+
+        elem_ptr = gdlll_allocate_element_block(gdllc_ptr, block_flags);
+        if (!elem_ptr) {
+            return NULL;
+        }
+
+        if (block_flags & GDLLL_ELEMENT_HAS_INLINE_DATA_AREA) {
+            elem_ptr->data_ptr = GDLLL_ELEMENT_INLINE_DATA_PTR(elem_ptr);
+        } else {
+            elem_ptr->data_ptr = gdlll_allocate_payload_block(gdllc_ptr,
+                                                        data_size,
+                                                        &payload_flags);
+            if (!(elem_ptr->data_ptr)) {
+                gdlll_release_element_block(gdllc_ptr, elem_ptr);
+                return NULL;
+            }
+            elem_ptr->flags = elem_ptr->flags | payload_flags;
+        }
+
+    }
+
+    if (data_ptr) {
+        memmove(elem_ptr->data_ptr, data_ptr, (size_t)(data_size));
+    }
+    elem_ptr->data_size = data_size;
+
+    elem_ptr->prev = NULL;
+    elem_ptr->next = NULL;
+    elem_ptr->snapshot_version = 0;
+
+    if ((gdllc_ptr) &&
+        (gdlll_make_room_in_indexes(gdllc_ptr, elem_ptr, 1) != GDLLL_SUCCESS)) {
+        gdlll_release_element_memory(gdllc_ptr, elem_ptr);
+        return NULL;
+    }
+
+    return elem_ptr;
+
+} // end of gdlll_create_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function returns the extension of the element (see
+// struct gdll_element_extension), allocating it if the element doesn't have
+// one yet. NULL is returned if there is no memory.
+static struct gdll_element_extension *gdlll_get_element_extension(
+                                                    struct element *elem_ptr)
+{
+
+    struct gdll_element_extension *ext_ptr = elem_ptr->extension;
+
+    if (ext_ptr) {
+        return ext_ptr;
+    }
+
+    if (GDLLL_ALLOCATION_MUST_FAIL()) {
+        return NULL;
+    }
+
+    ext_ptr = malloc(sizeof(*ext_ptr));
+    if (!ext_ptr) {
+        return NULL;
+    }
+
+    gdlll_init_element_extension(ext_ptr);
+
+    elem_ptr->extension = ext_ptr;
+
+    return ext_ptr;
+
+} // end of gdlll_get_element_extension() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function initializes an extension that is not used
+// by any feature yet.
+static void gdlll_init_element_extension(
+                                    struct gdll_element_extension *ext_ptr)
+{
+
+    ext_ptr->integer_key_slot = -1;
+    ext_ptr->heap_index = -1;
+    memset(&(ext_ptr->order_node), 0, sizeof(ext_ptr->order_node));
+    ext_ptr->timer_bucket = -1;
+    ext_ptr->timer_expiry_time = 0;
+
+} // end of gdlll_init_element_extension() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function frees the extension of the element (if it
+// has one and it is not in the memory block of the element).
+static void gdlll_free_element_extension(struct element *elem_ptr)
+{
+
+    if (!(elem_ptr->flags & GDLLL_ELEMENT_HAS_EXTENSION_AREA)) {
+        free(elem_ptr->extension);
+    }
+
+    elem_ptr->extension = NULL;
+
+} // end of gdlll_free_element_extension() function
+
+// This function returns 1 if the elements of the container need an extension
+// (see struct gdll_element_extension), otherwise it returns 0. 'gdllc_ptr' may
+// be NULL.
+static int gdlll_container_needs_element_extension(
                                             struct gdll_container *gdllc_ptr)
 {
 
-    struct element *temp_elem_ptr = NULL;
+    if ((gdllc_ptr) &&
+        ((gdllc_ptr->integer_key_index_enabled) ||
+         (gdllc_ptr->priority_queue_enabled) ||
+         (gdllc_ptr->order_statistic_index_enabled))) {
+        return 1;
+    }
 
-    if (!gdllc_ptr) {
-        return;
+    return 0;
+
+} // end of gdlll_container_needs_element_extension() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function allocates what the indexes of the container
+// need before 'num_elements' elements are added to it: the extension of
+// 'elem_ptr' (if 'elem_ptr' is not NULL and the container needs one) and room
+// for 'num_elements' more elements in the integer key index and in the heap.
+// Then adding the elements to the indexes doesn't need any memory (and can't
+// make them stale). It returns GDLLL_SUCCESS or GDLLL_NO_MEMORY.
+static int gdlll_make_room_in_indexes(struct gdll_container *gdllc_ptr,
+                                      struct element *elem_ptr,
+                                      long num_elements)
+{
+
+    if (!gdlll_container_needs_element_extension(gdllc_ptr)) {
+        return GDLLL_SUCCESS;
     }
 
-    if (gdllc_ptr->total_number_of_elements == 0) {
-        return;
+    if ((elem_ptr) && (!gdlll_get_element_extension(elem_ptr))) {
+        return GDLLL_NO_MEMORY;
     }
 
-    temp_elem_ptr = gdllc_ptr->first;
+    if ((gdllc_ptr->integer_key_index_enabled) &&
+        (!gdllc_ptr->integer_key_index_is_stale) &&
+        (!gdlll_reserve_integer_key_index(gdllc_ptr,
+                    gdllc_ptr->integer_key_index_size + num_elements))) {
+        return GDLLL_NO_MEMORY;
+    }
 
-    while (temp_elem_ptr) {
-        gdlll_delete_front_element(gdllc_ptr);
-        temp_elem_ptr = gdllc_ptr->first;
+    if ((gdllc_ptr->priority_queue_enabled) && (!gdllc_ptr->heap_is_stale) &&
+        (!gdlll_reserve_heap(gdllc_ptr,
+                             gdllc_ptr->heap_size + num_elements))) {
+        return GDLLL_NO_MEMORY;
     }
 
-    return;
+    return GDLLL_SUCCESS;
 
-} // end of gdlll_delete_all_elements_in_gdll_container() function
+} // end of gdlll_make_room_in_indexes() function
 
-void gdlll_delete_gdll_container(struct gdll_container *gdllc_ptr)
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. 'gdllc_ptr' may be NULL. This function frees the
+// 'data_ptr' of the element (if it is not NULL) if the data is not stored
+// inside the element's memory block. A payload block of the arena of 'gdllc_ptr' is put in the free
+// list of its class (a payload block of the arena of another container is kept
+// until that arena is freed). It doesn't call
+// call_function_before_deleting_data().
+static void gdlll_free_element_data(struct gdll_container *gdllc_ptr,
+                                    struct element *elem_ptr)
 {
 
-    if (!gdllc_ptr) {
+    struct gdll_node_cache *cache_ptr = &gdlll_node_cache;
+    int class_index = 0;
+
+    if ((!elem_ptr->data_ptr) || (GDLLL_ELEMENT_DATA_IS_INLINE(elem_ptr))) {
+        elem_ptr->data_ptr = NULL;
         return;
     }
 
-    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    if (elem_ptr->flags & GDLLL_ELEMENT_PAYLOAD_IS_IN_ARENA) {
+        class_index = GDLLL_ARENA_BLOCK_CLASS_INDEX(elem_ptr->data_size);
+        if ((gdllc_ptr) &&
+            (GDLLL_ARENA_REGION_OF_BLOCK(elem_ptr->data_ptr)->owner ==
+                                                                gdllc_ptr)) {
+            *((void **)(elem_ptr->data_ptr)) =
+                                    gdllc_ptr->arena_free_blocks[class_index];
+            gdllc_ptr->arena_free_blocks[class_index] = elem_ptr->data_ptr;
+            gdlll_arena_count_block(gdllc_ptr, elem_ptr->data_ptr, -1);
+        }
+    } else if (elem_ptr->flags & GDLLL_ELEMENT_PAYLOAD_IS_CLASS_SIZED) {
+        // a class sized payload block goes to the node cache of this thread
+        class_index = gdlll_node_cache_payload_class(elem_ptr->data_size);
+        if (cache_ptr->number_of_payload_blocks[class_index] <
+                                                GDLLL_NODE_CACHE_MAX_BLOCKS) {
+            gdlll_node_cache_register();
+            *((void **)(elem_ptr->data_ptr)) =
+                                    cache_ptr->payload_blocks[class_index];
+            cache_ptr->payload_blocks[class_index] = elem_ptr->data_ptr;
+            cache_ptr->number_of_payload_blocks[class_index] =
+                        cache_ptr->number_of_payload_blocks[class_index] + 1;
+        } else {
+            free(elem_ptr->data_ptr);
+        }
+    } else {
+        free(elem_ptr->data_ptr);
+    }
 
-    free(gdllc_ptr);
+    elem_ptr->flags = elem_ptr->flags &
+                            ~(GDLLL_ELEMENT_PAYLOAD_IS_CLASS_SIZED |
+                              GDLLL_ELEMENT_PAYLOAD_IS_IN_ARENA);
+    elem_ptr->data_ptr = NULL;
 
-    return;
+} // end of gdlll_free_element_data() function
 
-} // end of gdlll_delete_gdll_container() function
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function just removes the element from the list,
+// it doesn't decrement total_number_of_elements by 1. Decrementing has to be
+// done in the calling function. This function should not be called if the
+// number of elements in the container is 0. The calling function should first
+// check whether the number of elements in the container is 0 or not.
+static void gdlll_remove_element_from_list(struct gdll_container *gdllc_ptr,
+                                           struct element *elem_ptr)
+{
+
+    gdlll_remove_element_from_indexes(gdllc_ptr, elem_ptr);
+
+    gdlll_unlink_element(gdllc_ptr, elem_ptr);
+
+    elem_ptr->prev = NULL;
+    GDLLL_STORE_RELEASE(elem_ptr->next, NULL);
+
+    // The snapshot version of an element is a version of the snapshots of this
+    // container, so it must not go with the element to another container.
+    if (!gdlll_element_is_in_snapshot(gdllc_ptr, elem_ptr)) {
+        elem_ptr->snapshot_version = 0;
+    }
+
+    // the new first or last element may be a tombstone
+    if (gdllc_ptr->number_of_tombstones > 0) {
+        gdlll_trim_tombstones(gdllc_ptr);
+    }
+
+} // end of gdlll_remove_element_from_list() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function only unlinks the element from the list (it
+// doesn't touch the integer key index or the tombstones). The 'prev' and
+// 'next' of the element are not changed, so a reader that is on the element
+// can still go forward in the list (see gdlll_epoch_read_lock()).
+static void gdlll_unlink_element(struct gdll_container *gdllc_ptr,
+                                 struct element *elem_ptr)
+{
+
+    // don't leave the finger pointing to an element that is not in the list
+    if (elem_ptr == gdllc_ptr->sorted_insertion_finger) {
+        if (elem_ptr->next) {
+            gdllc_ptr->sorted_insertion_finger = elem_ptr->next;
+        } else {
+            gdllc_ptr->sorted_insertion_finger = elem_ptr->prev;
+        }
+    }
+
+    // a relayout in progress continues from the next element
+    if (elem_ptr == gdllc_ptr->relayout_next_element) {
+        gdllc_ptr->relayout_next_element = elem_ptr->next;
+    }
+
+    if (gdllc_ptr->continuations) {
+        gdlll_replace_element_in_continuations(gdllc_ptr, elem_ptr,
+                                               elem_ptr->next);
+    }
+
+    if (elem_ptr == gdllc_ptr->first) {
+        GDLLL_STORE_RELEASE(gdllc_ptr->first, elem_ptr->next);
+        if (gdllc_ptr->first == NULL) {
+            gdllc_ptr->last = NULL;
+        } else {
+            gdllc_ptr->first->prev = NULL;
+        }
+    } else if (elem_ptr == gdllc_ptr->last) {
+        gdllc_ptr->last = elem_ptr->prev;
+        if (gdllc_ptr->last == NULL) {
+            GDLLL_STORE_RELEASE(gdllc_ptr->first, NULL);
+        } else {
+            GDLLL_STORE_RELEASE(gdllc_ptr->last->next, NULL);
+        }
+    } else {
+        GDLLL_STORE_RELEASE(elem_ptr->prev->next, elem_ptr->next);
+        elem_ptr->next->prev = elem_ptr->prev;
+    }
+
+    gdlll_count_memory(gdllc_ptr,
+                       -GDLLL_MEMORY_SIZE_OF_ELEMENT(elem_ptr->data_size));
+
+} // end of gdlll_unlink_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function frees the element (see
+// gdlll_free_element()). If the element is in a snapshot then it is kept until
+// the snapshot is released. If epoch based reclamation is enabled then the
+// element is only retired, and it is freed later when no reader can be using
+// it.
+static void gdlll_destroy_element(struct gdll_container *gdllc_ptr,
+                                  struct element *elem_ptr)
+{
+
+    if (gdlll_element_is_in_snapshot(gdllc_ptr, elem_ptr)) {
+        gdlll_snapshot_retire_element(gdllc_ptr, elem_ptr);
+        return;
+    }
+
+    if (gdllc_ptr->epoch_reclamation_enabled) {
+        gdlll_epoch_retire_element(gdllc_ptr, elem_ptr);
+        return;
+    }
+
+    gdlll_free_element(gdllc_ptr, elem_ptr);
+
+} // end of gdlll_destroy_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function calls call_function_before_deleting_data()
+// for the data of the element and then frees the element. If asynchronous
+// deletion is enabled then both are done by the reclaimer thread (except for
+// the slots of a ring and the blocks of an arena, which are not thread safe).
+static void gdlll_free_element(struct gdll_container *gdllc_ptr,
+                               struct element *elem_ptr)
+{
+
+#if !defined(GDLLL_NO_THREADS)
+    if ((gdllc_ptr->async_deleter) &&
+        (!(elem_ptr->flags &
+           (GDLLL_ELEMENT_IS_IN_RING | GDLLL_ELEMENT_IS_IN_ARENA)))) {
+        gdlll_async_deleter_push(gdllc_ptr->async_deleter, elem_ptr);
+        return;
+    }
+#endif
+
+    if (gdllc_ptr->call_function_before_deleting_data) {
+        gdllc_ptr->call_function_before_deleting_data(elem_ptr->data_ptr);
+    }
+
+    gdlll_release_element_memory(gdllc_ptr, elem_ptr);
+
+} // end of gdlll_free_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function frees the memory of the element (it doesn't
+// call call_function_before_deleting_data()). If the element is a slot of the
+// ring of 'gdllc_ptr' then the slot is put back in the free slots instead.
+static void gdlll_release_element_memory(struct gdll_container *gdllc_ptr,
+                                         struct element *elem_ptr)
+{
+
+    gdlll_free_element_data(gdllc_ptr, elem_ptr);
+    gdlll_free_element_extension(elem_ptr);
+
+    if (!(elem_ptr->flags & GDLLL_ELEMENT_IS_IN_RING)) {
+        gdlll_release_element_block(gdllc_ptr, elem_ptr);
+        return;
+    }
+
+    // the last slot in use of a ring that has been disabled frees the slots
+    if ((gdllc_ptr->ring_disabled_slots) &&
+        (((char *)(elem_ptr)) >= gdllc_ptr->ring_disabled_slots) &&
+        (((char *)(elem_ptr)) < (gdllc_ptr->ring_disabled_slots +
+                                 gdllc_ptr->ring_disabled_slots_size))) {
+        gdllc_ptr->ring_disabled_number_of_slots_in_use =
+                        gdllc_ptr->ring_disabled_number_of_slots_in_use - 1;
+        if (gdllc_ptr->ring_disabled_number_of_slots_in_use == 0) {
+            free(gdllc_ptr->ring_disabled_slots);
+            gdllc_ptr->ring_disabled_slots = NULL;
+            gdllc_ptr->ring_disabled_slots_size = 0;
+        }
+        return;
+    }
+
+    // A slot of another container can't be freed here (this can happen only
+    // if the user has moved the element to another container).
+    if ((gdllc_ptr->ring_capacity == 0) ||
+        (((char *)(elem_ptr)) < gdllc_ptr->ring_slots) ||
+        (((char *)(elem_ptr)) >= (gdllc_ptr->ring_slots +
+                    (gdllc_ptr->ring_capacity * gdllc_ptr->ring_slot_size)))) {
+        return;
+    }
+
+    elem_ptr->next = gdllc_ptr->ring_free_list;
+    gdllc_ptr->ring_free_list = elem_ptr;
+    gdllc_ptr->ring_number_of_free_slots =
+                                    gdllc_ptr->ring_number_of_free_slots + 1;
+
+} // end of gdlll_release_element_memory() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. 'gdllc_ptr' may be NULL. This function returns a memory
+// block for an element that is not in a ring (from the arena of 'gdllc_ptr',
+// from the node cache of this thread, or from calloc()). The block is as big
+// as 'block_flags' (GDLLL_ELEMENT_HAS_INLINE_DATA_AREA and
+// GDLLL_ELEMENT_HAS_EXTENSION_AREA) need, and only 'flags' and 'extension' are
+// initialized. NULL is returned if there is no memory.
+static struct element *gdlll_allocate_element_block(
+                                            struct gdll_container *gdllc_ptr,
+                                            unsigned int block_flags)
+{
+
+    struct gdll_node_cache *cache_ptr = &gdlll_node_cache;
+    struct element *elem_ptr = NULL;
+    long block_size = (long)(GDLLL_ELEMENT_BLOCK_SIZE(block_flags));
+    int class_index = 0;
+    int kind = GDLLL_NODE_CACHE_BLOCK_KIND(block_flags);
+
+    if (GDLLL_ALLOCATION_MUST_FAIL()) {
+        return NULL;
+    }
+
+    if ((gdllc_ptr) && (gdllc_ptr->arena_mode_enabled)) {
+
+        class_index = GDLLL_ARENA_BLOCK_CLASS_INDEX(block_size);
+
+        if (gdllc_ptr->arena_free_blocks[class_index]) {
+            elem_ptr = gdllc_ptr->arena_free_blocks[class_index];
+            gdllc_ptr->arena_free_blocks[class_index] = *((void **)(elem_ptr));
+        } else {
+            elem_ptr = gdlll_arena_take_new_block(gdllc_ptr, block_size);
+            if (!elem_ptr) {
+                return NULL;
+            }
+        }
+
+        gdlll_arena_count_block(gdllc_ptr, elem_ptr, 1);
+
+        elem_ptr->flags = GDLLL_ELEMENT_IS_IN_ARENA | block_flags;
+
+    } else {
+
+        if ((gdllc_ptr) && (gdllc_ptr->node_cache_enabled) &&
+            (cache_ptr->element_blocks[kind])) {
+            elem_ptr = cache_ptr->element_blocks[kind];
+            cache_ptr->element_blocks[kind] = elem_ptr->next;
+            cache_ptr->number_of_element_blocks[kind] =
+                                cache_ptr->number_of_element_blocks[kind] - 1;
+        } else {
+            elem_ptr = calloc((size_t)(block_size), 1);
+            if (!elem_ptr) {
+                return NULL;
+            }
+        }
+
+        elem_ptr->flags = block_flags;
+
+    }
+
+    if (block_flags & GDLLL_ELEMENT_HAS_EXTENSION_AREA) {
+        elem_ptr->extension = GDLLL_ELEMENT_EXTENSION_AREA_PTR(elem_ptr);
+        gdlll_init_element_extension(elem_ptr->extension);
+    } else {
+        elem_ptr->extension = NULL;
+    }
+
+    return elem_ptr;
+
+} // end of gdlll_allocate_element_block() function
+
+#if defined(GDLLL_FAULT_INJECTION)
+
+// This function returns 1 if the allocation that is about to be done by this
+// thread must fail (see gdlll_inject_allocation_failures()), otherwise it
+// returns 0.
+static int gdlll_allocation_must_fail(void)
+{
+
+    if (gdlll_allocations_to_succeed > 0) {
+        gdlll_allocations_to_succeed = gdlll_allocations_to_succeed - 1;
+        return 0;
+    }
+
+    if (gdlll_allocations_to_fail == 0) {
+        return 0;
+    }
+
+    if (gdlll_allocations_to_fail > 0) {
+        gdlll_allocations_to_fail = gdlll_allocations_to_fail - 1;
+    }
+
+    gdlll_number_of_injected_failures = gdlll_number_of_injected_failures + 1;
+
+    return 1;
+
+} // end of gdlll_allocation_must_fail() function
+
+void gdlll_inject_allocation_failures(long num_allocations_to_succeed,
+                                      long num_allocations_to_fail)
+{
+
+    if (num_allocations_to_succeed < 0) {
+        num_allocations_to_succeed = 0;
+    }
+
+    gdlll_allocations_to_succeed = num_allocations_to_succeed;
+    gdlll_allocations_to_fail = num_allocations_to_fail;
+    gdlll_number_of_injected_failures = 0;
+
+    return;
+
+} // end of gdlll_inject_allocation_failures() function
+
+long gdlll_get_number_of_injected_failures(void)
+{
+
+    return gdlll_number_of_injected_failures;
+
+} // end of gdlll_get_number_of_injected_failures() function
+
+#endif
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. 'gdllc_ptr' may be NULL. This function gives back the
+// memory block of an element that is not in a ring (its data must have been
+// freed already). A block of the arena of 'gdllc_ptr' is put in the free list
+// of its class (a block of the arena of another container is kept until that
+// arena is freed). Any other block is put in the node cache of this thread (if
+// the node cache of 'gdllc_ptr' is enabled) or freed.
+static void gdlll_release_element_block(struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr)
+{
+
+    struct gdll_node_cache *cache_ptr = &gdlll_node_cache;
+    int class_index = GDLLL_ARENA_BLOCK_CLASS_INDEX(
+                                GDLLL_ELEMENT_BLOCK_SIZE(elem_ptr->flags));
+    int kind = GDLLL_NODE_CACHE_BLOCK_KIND(elem_ptr->flags);
+
+    if (elem_ptr->flags & GDLLL_ELEMENT_IS_IN_ARENA) {
+        if (GDLLL_ARENA_REGION_OF_BLOCK(elem_ptr)->owner == gdllc_ptr) {
+            *((void **)(elem_ptr)) = gdllc_ptr->arena_free_blocks[class_index];
+            gdllc_ptr->arena_free_blocks[class_index] = elem_ptr;
+            gdlll_arena_count_block(gdllc_ptr, elem_ptr, -1);
+        }
+        return;
+    }
+
+    if ((gdllc_ptr) && (gdllc_ptr->node_cache_enabled) &&
+        (cache_ptr->number_of_element_blocks[kind] <
+                                                GDLLL_NODE_CACHE_MAX_BLOCKS)) {
+        gdlll_node_cache_register();
+        elem_ptr->next = cache_ptr->element_blocks[kind];
+        cache_ptr->element_blocks[kind] = elem_ptr;
+        cache_ptr->number_of_element_blocks[kind] =
+                                cache_ptr->number_of_element_blocks[kind] + 1;
+        return;
+    }
+
+    free(elem_ptr);
+
+} // end of gdlll_release_element_block() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. 'gdllc_ptr' may be NULL. This function returns a payload
+// block of at least 'data_size' bytes (NULL if there is no memory) and stores
+// the flags that the element must have for it in '*payload_flags_ptr'. In
+// arena mode, a payload of up to GDLLL_ARENA_MAX_PAYLOAD_SIZE bytes gets a
+// block from the arena (rounded up to 16 bytes). Otherwise, if the node cache
+// of 'gdllc_ptr' is enabled and the payload is small then the block is as big
+// as its class and it comes from the node cache of this thread (if there is
+// one there).
+static void *gdlll_allocate_payload_block(struct gdll_container *gdllc_ptr,
+                                          long data_size,
+                                          unsigned int *payload_flags_ptr)
+{
+
+    struct gdll_node_cache *cache_ptr = &gdlll_node_cache;
+    void *block_ptr = NULL;
+    int class_index = 0;
+
+    *payload_flags_ptr = 0;
+
+    if (GDLLL_ALLOCATION_MUST_FAIL()) {
+        return NULL;
+    }
+
+    if ((gdllc_ptr) && (gdllc_ptr->arena_mode_enabled) &&
+        (data_size <= GDLLL_ARENA_MAX_PAYLOAD_SIZE)) {
+
+        class_index = GDLLL_ARENA_BLOCK_CLASS_INDEX(data_size);
+
+        if (gdllc_ptr->arena_free_blocks[class_index]) {
+            block_ptr = gdllc_ptr->arena_free_blocks[class_index];
+            gdllc_ptr->arena_free_blocks[class_index] = *((void **)(block_ptr));
+        } else {
+            block_ptr = gdlll_arena_take_new_block(gdllc_ptr,
+                                                   16L * class_index);
+            if (!block_ptr) {
+                return NULL;
+            }
+        }
+
+        gdlll_arena_count_block(gdllc_ptr, block_ptr, 1);
+
+        *payload_flags_ptr = GDLLL_ELEMENT_PAYLOAD_IS_IN_ARENA;
+
+        return block_ptr;
+
+    }
+
+    if ((!gdllc_ptr) || (!gdllc_ptr->node_cache_enabled) ||
+        (data_size > GDLLL_NODE_CACHE_MAX_PAYLOAD_SIZE)) {
+        return calloc((size_t)(data_size), 1);
+    }
+
+    class_index = gdlll_node_cache_payload_class(data_size);
+
+    if (cache_ptr->payload_blocks[class_index]) {
+        block_ptr = cache_ptr->payload_blocks[class_index];
+        cache_ptr->payload_blocks[class_index] = *((void **)(block_ptr));
+        cache_ptr->number_of_payload_blocks[class_index] =
+                        cache_ptr->number_of_payload_blocks[class_index] - 1;
+    } else {
+        block_ptr = malloc(((size_t)(GDLLL_NODE_CACHE_MIN_PAYLOAD_CLASS_SIZE))
+                           << class_index);
+        if (!block_ptr) {
+            return NULL;
+        }
+    }
+
+    *payload_flags_ptr = GDLLL_ELEMENT_PAYLOAD_IS_CLASS_SIZED;
+
+    return block_ptr;
+
+} // end of gdlll_allocate_payload_block() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function returns the index of the node cache class
+// of a payload of 'data_size' bytes ('data_size' must be <=
+// GDLLL_NODE_CACHE_MAX_PAYLOAD_SIZE for the index to be valid).
+static int gdlll_node_cache_payload_class(long data_size)
+{
+
+    int class_index = 0;
+
+    while ((class_index < (GDLLL_NODE_CACHE_NUM_PAYLOAD_CLASSES - 1)) &&
+           (data_size > (GDLLL_NODE_CACHE_MIN_PAYLOAD_CLASS_SIZE <<
+                                                            class_index))) {
+        class_index = class_index + 1;
+    }
+
+    return class_index;
+
+} // end of gdlll_node_cache_payload_class() function
+
+// This function makes sure that the node cache of this thread is freed when
+// the thread exits (it must be called before a block is put in the node
+// cache), and that the change of the memory count by this thread is not lost
+// then (see gdlll_count_memory()).
+static void gdlll_node_cache_register(void)
+{
+
+#if !defined(GDLLL_NO_THREADS)
+
+    if (gdlll_node_cache.is_registered) {
+        return;
+    }
+
+    pthread_once(&gdlll_node_cache_key_once, gdlll_node_cache_create_key);
+
+    // any non-NULL value makes the thread call gdlll_node_cache_thread_exit()
+    pthread_setspecific(gdlll_node_cache_key, &gdlll_node_cache);
+
+    gdlll_node_cache.is_registered = 1;
+
+#endif
+
+    return;
+
+} // end of gdlll_node_cache_register() function
+
+#if !defined(GDLLL_NO_THREADS)
+
+static void gdlll_node_cache_create_key(void)
+{
+
+    pthread_key_create(&gdlll_node_cache_key, gdlll_node_cache_thread_exit);
+
+} // end of gdlll_node_cache_create_key() function
+
+// This function is called when a thread that has used its node cache (or
+// changed the memory count of a container) exits.
+static void gdlll_node_cache_thread_exit(void *arg)
+{
+
+    (void)(arg);
+
+    gdlll_free_node_cache_of_current_thread();
+
+    GDLLL_ADD_RELAXED(gdlll_global_memory_in_use,
+                      gdlll_global_memory_change_of_thread);
+    gdlll_global_memory_change_of_thread = 0;
+
+} // end of gdlll_node_cache_thread_exit() function
+
+#endif
+
+int gdlll_enable_node_cache(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    gdllc_ptr->node_cache_enabled = 1;
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_enable_node_cache() function
+
+void gdlll_disable_node_cache(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    gdllc_ptr->node_cache_enabled = 0;
+
+    return;
+
+} // end of gdlll_disable_node_cache() function
+
+void gdlll_free_node_cache_of_current_thread(void)
+{
+
+    struct gdll_node_cache *cache_ptr = &gdlll_node_cache;
+    struct element *elem_ptr = NULL;
+    void *block_ptr = NULL;
+    int i = 0;
+
+    for (i = 0; i < GDLLL_NODE_CACHE_NUM_BLOCK_KINDS; i = i + 1) {
+        while (cache_ptr->element_blocks[i]) {
+            elem_ptr = cache_ptr->element_blocks[i];
+            cache_ptr->element_blocks[i] = elem_ptr->next;
+            free(elem_ptr);
+        }
+        cache_ptr->number_of_element_blocks[i] = 0;
+    }
+
+    for (i = 0; i < GDLLL_NODE_CACHE_NUM_PAYLOAD_CLASSES; i = i + 1) {
+        while (cache_ptr->payload_blocks[i]) {
+            block_ptr = cache_ptr->payload_blocks[i];
+            cache_ptr->payload_blocks[i] = *((void **)(block_ptr));
+            free(block_ptr);
+        }
+        cache_ptr->number_of_payload_blocks[i] = 0;
+    }
+
+    return;
+
+} // end of gdlll_free_node_cache_of_current_thread() function
+
+int gdlll_enable_arena_mode(struct gdll_container *gdllc_ptr, int numa_node)
+{
+
+    int retval = GDLLL_ERROR_INIT_VALUE;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if ((numa_node < GDLLL_NO_NUMA_NODE) ||
+        (numa_node >= GDLLL_MAX_NUMA_NODES)) {
+        return GDLLL_NUMA_NODE_IS_INVALID;
+    }
+
+#if !defined(GDLLL_ARENA_USES_MMAP)
+    if (numa_node != GDLLL_NO_NUMA_NODE) {
+        return GDLLL_NUMA_NODE_IS_INVALID;
+    }
+#endif
+
+    if ((gdllc_ptr->total_number_of_elements != 0) ||
+        (gdllc_ptr->number_of_tombstones != 0)) {
+        return GDLLL_CONTAINER_IS_NOT_EMPTY;
+    }
+
+    if (gdllc_ptr->snapshots) {
+        gdlll_reclaim_snapshots(gdllc_ptr);
+    }
+
+    // the blocks of the old arena that are in use are not in the list
+    if (gdllc_ptr->arena_number_of_blocks_in_use != 0) {
+        return GDLLL_CONTAINER_IS_SHARED;
+    }
+
+    gdlll_disable_arena_mode(gdllc_ptr);
+
+    retval = gdlll_arena_start(gdllc_ptr, numa_node);
+
+    return retval;
+
+} // end of gdlll_enable_arena_mode() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function puts a container that is not in arena mode
+// in arena mode (the elements that the container already has are not moved).
+// It returns GDLLL_SUCCESS, GDLLL_NO_MEMORY or GDLLL_NUMA_NODE_IS_INVALID.
+static int gdlll_arena_start(struct gdll_container *gdllc_ptr, int numa_node)
+{
+
+    int retval = GDLLL_ERROR_INIT_VALUE;
+
+    gdllc_ptr->arena_free_blocks = calloc(GDLLL_ARENA_NUM_BLOCK_CLASSES,
+                                          sizeof(void *));
+    if (!gdllc_ptr->arena_free_blocks) {
+        return GDLLL_NO_MEMORY;
+    }
+
+    gdllc_ptr->arena_numa_node = numa_node;
+
+    // the first region is added now, so that an invalid NUMA node is found here
+    retval = gdlll_arena_add_region(gdllc_ptr);
+    if (retval != GDLLL_SUCCESS) {
+        free(gdllc_ptr->arena_free_blocks);
+        gdllc_ptr->arena_free_blocks = NULL;
+        gdllc_ptr->arena_numa_node = GDLLL_NO_NUMA_NODE;
+        return retval;
+    }
+
+    gdllc_ptr->arena_mode_enabled = 1;
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_arena_start() function
+
+void gdlll_disable_arena_mode(struct gdll_container *gdllc_ptr)
+{
+
+    struct gdll_continuation *cont_ptr = NULL;
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    if (!gdllc_ptr->arena_regions) {
+        return;
+    }
+
+    // the elements removed by incremental deletes may be in the arena
+    for (cont_ptr = gdllc_ptr->continuations; cont_ptr;
+                                                cont_ptr = cont_ptr->next) {
+        gdlll_free_pending_elements(gdllc_ptr, cont_ptr);
+    }
+
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+
+    gdllc_ptr->arena_mode_enabled = 0;
+    gdllc_ptr->relayout_in_progress = 0;
+    gdllc_ptr->relayout_next_element = NULL;
+
+    // The elements kept for the snapshots and the epoch readers may still be
+    // in the arena. If so, the regions are freed when the last block is given
+    // back (see gdlll_arena_count_block()).
+    if (gdllc_ptr->snapshots) {
+        gdlll_reclaim_snapshots(gdllc_ptr);
+    }
+
+    if (gdllc_ptr->arena_number_of_blocks_in_use == 0) {
+        gdlll_arena_free_all_regions(gdllc_ptr);
+    }
+
+    return;
+
+} // end of gdlll_disable_arena_mode() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function frees all the regions of the arena of the
+// container (the blocks in them must not be used after this) and clears the
+// state of the arena.
+static void gdlll_arena_free_all_regions(struct gdll_container *gdllc_ptr)
+{
+
+    struct gdll_arena_region *region_ptr = NULL;
+
+    while (gdllc_ptr->arena_regions) {
+        region_ptr = gdllc_ptr->arena_regions;
+        gdllc_ptr->arena_regions = region_ptr->next;
+        gdlll_arena_free_region(region_ptr);
+    }
+
+    gdllc_ptr->arena_mode_enabled = 0;
+    gdllc_ptr->arena_numa_node = GDLLL_NO_NUMA_NODE;
+    gdllc_ptr->arena_number_of_regions = 0;
+    gdllc_ptr->arena_number_of_blocks_in_use = 0;
+    free(gdllc_ptr->arena_free_blocks);
+    gdllc_ptr->arena_free_blocks = NULL;
+    gdllc_ptr->arena_next_free_block = NULL;
+    gdllc_ptr->arena_end = NULL;
+
+} // end of gdlll_arena_free_all_regions() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function adds a new region to the arena of the
+// container (bound to 'arena_numa_node') and makes it the region from which
+// the next blocks are taken. It returns GDLLL_SUCCESS, GDLLL_NO_MEMORY or
+// GDLLL_NUMA_NODE_IS_INVALID.
+static int gdlll_arena_add_region(struct gdll_container *gdllc_ptr)
+{
+
+    struct gdll_arena_region *region_ptr = NULL;
+
+#if defined(GDLLL_ARENA_USES_MMAP)
+
+    unsigned long node_mask[GDLLL_MAX_NUMA_NODES /
+                            (8 * sizeof(unsigned long))];
+    char *mapping_ptr = MAP_FAILED;
+    char *region_start = NULL;
+    char *mapping_end = NULL;
+    int numa_node = gdllc_ptr->arena_numa_node;
+
+#if defined(GDLLL_ARENA_HUGETLB_FLAGS)
+    // a 2 MB huge page is always aligned to 2 MB
+    mapping_ptr = mmap(NULL, GDLLL_ARENA_REGION_SIZE, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | GDLLL_ARENA_HUGETLB_FLAGS,
+                       -1, 0);
+    if ((mapping_ptr != MAP_FAILED) &&
+        ((((uintptr_t)(mapping_ptr)) & (GDLLL_ARENA_REGION_SIZE - 1)) != 0)) {
+        munmap(mapping_ptr, GDLLL_ARENA_REGION_SIZE);
+        mapping_ptr = MAP_FAILED;
+    }
+#endif
+
+    if (mapping_ptr != MAP_FAILED) {
+
+        region_start = mapping_ptr;
+
+    } else {
+
+        // Map twice the region size and unmap the parts before and after the
+        // aligned region.
+        mapping_ptr = mmap(NULL, 2 * GDLLL_ARENA_REGION_SIZE,
+                           PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                           -1, 0);
+        if (mapping_ptr == MAP_FAILED) {
+            return GDLLL_NO_MEMORY;
+        }
+
+        mapping_end = mapping_ptr + (2 * GDLLL_ARENA_REGION_SIZE);
+        region_start = (char *)((((uintptr_t)(mapping_ptr)) +
+                                 GDLLL_ARENA_REGION_SIZE - 1) &
+                                ~((uintptr_t)(GDLLL_ARENA_REGION_SIZE - 1)));
+
+        if (region_start > mapping_ptr) {
+            munmap(mapping_ptr, (size_t)(region_start - mapping_ptr));
+        }
+        if (mapping_end > (region_start + GDLLL_ARENA_REGION_SIZE)) {
+            munmap(region_start + GDLLL_ARENA_REGION_SIZE,
+                   (size_t)(mapping_end -
+                            (region_start + GDLLL_ARENA_REGION_SIZE)));
+        }
+
+#if defined(MADV_HUGEPAGE)
+        // it doesn't matter if transparent huge pages are not available
+        madvise(region_start, GDLLL_ARENA_REGION_SIZE, MADV_HUGEPAGE);
+#endif
+
+    }
+
+    // The pages are not touched yet, so they will be allocated on the NUMA
+    // node.
+    if (numa_node != GDLLL_NO_NUMA_NODE) {
+        memset(node_mask, 0, sizeof(node_mask));
+        node_mask[numa_node / (8 * sizeof(unsigned long))] =
+                            1UL << (numa_node % (8 * sizeof(unsigned long)));
+        if (syscall(SYS_mbind, region_start, GDLLL_ARENA_REGION_SIZE,
+                    GDLLL_MPOL_BIND, node_mask,
+                    (unsigned long)(GDLLL_MAX_NUMA_NODES + 1), 0UL) != 0) {
+            munmap(region_start, GDLLL_ARENA_REGION_SIZE);
+            return GDLLL_NUMA_NODE_IS_INVALID;
+        }
+    }
+
+    region_ptr = (struct gdll_arena_region *)(region_start);
+
+#else
+
+    region_ptr = aligned_alloc(GDLLL_ARENA_REGION_SIZE,
+                               GDLLL_ARENA_REGION_SIZE);
+    if (!region_ptr) {
+        return GDLLL_NO_MEMORY;
+    }
+
+#endif
+
+    region_ptr->owner = gdllc_ptr;
+    region_ptr->next = gdllc_ptr->arena_regions;
+    region_ptr->number_of_blocks_in_use = 0;
+    gdllc_ptr->arena_regions = region_ptr;
+    gdllc_ptr->arena_number_of_regions =
+                                    gdllc_ptr->arena_number_of_regions + 1;
+
+    gdllc_ptr->arena_next_free_block = ((char *)(region_ptr)) +
+                                        GDLLL_ARENA_REGION_HEADER_SIZE;
+    gdllc_ptr->arena_end = ((char *)(region_ptr)) + GDLLL_ARENA_REGION_SIZE;
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_arena_add_region() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function gives the memory of a region back to the
+// system.
+static void gdlll_arena_free_region(struct gdll_arena_region *region_ptr)
+{
+
+#if defined(GDLLL_ARENA_USES_MMAP)
+    munmap(region_ptr, GDLLL_ARENA_REGION_SIZE);
+#else
+    free(region_ptr);
+#endif
+
+} // end of gdlll_arena_free_region() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function returns a block of 'block_size' bytes (a
+// multiple of 16) that has never been used from the newest region of the arena
+// (a new region is added if the newest region doesn't have room for it). NULL
+// is returned if there is no memory.
+static void *gdlll_arena_take_new_block(struct gdll_container *gdllc_ptr,
+                                        long block_size)
+{
+
+    void *block_ptr = NULL;
+
+    if ((gdllc_ptr->arena_end - gdllc_ptr->arena_next_free_block) <
+                                                                block_size) {
+        if (gdlll_arena_add_region(gdllc_ptr) != GDLLL_SUCCESS) {
+            return NULL;
+        }
+    }
+
+    block_ptr = gdllc_ptr->arena_next_free_block;
+    gdllc_ptr->arena_next_free_block =
+                            gdllc_ptr->arena_next_free_block + block_size;
+
+    return block_ptr;
+
+} // end of gdlll_arena_take_new_block() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function deletes all the elements of a container in
+// arena mode that has no per-element state (see
+// gdlll_delete_all_elements_in_gdll_container()). The list is emptied at once
+// and then the elements are freed in one pass, without updating the list for
+// every element. If no block of the arena is in use after that then the arena
+// is reset (see gdlll_arena_reset()).
+static void gdlll_arena_delete_all_elements(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp = NULL;
+    struct element *next = NULL;
+
+    temp = gdllc_ptr->first;
+
+    GDLLL_STORE_RELEASE(gdllc_ptr->first, NULL);
+    gdllc_ptr->last = NULL;
+    gdllc_ptr->sorted_insertion_finger = NULL;
+    gdllc_ptr->relayout_next_element = NULL;
+    gdllc_ptr->total_number_of_elements = 0;
+    gdlll_move_continuations(gdllc_ptr, NULL);
+    gdlll_count_memory(gdllc_ptr, -(gdllc_ptr->memory_in_use));
+
+    while (temp) {
+        next = temp->next;
+        if (gdllc_ptr->call_function_before_deleting_data) {
+            gdllc_ptr->call_function_before_deleting_data(temp->data_ptr);
+        }
+        gdlll_release_element_memory(gdllc_ptr, temp);
+        temp = next;
+    }
+
+    if (gdllc_ptr->arena_number_of_blocks_in_use == 0) {
+        gdlll_arena_reset(gdllc_ptr);
+    }
+
+} // end of gdlll_arena_delete_all_elements() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function must be called only when no block of the
+// arena is in use. It frees all the regions except the newest one and makes
+// the arena start again from the beginning of that region (so the elements
+// added next are next to each other in memory again).
+static void gdlll_arena_reset(struct gdll_container *gdllc_ptr)
+{
+
+    struct gdll_arena_region *region_ptr = NULL;
+
+    while (gdllc_ptr->arena_regions->next) {
+        region_ptr = gdllc_ptr->arena_regions->next;
+        gdllc_ptr->arena_regions->next = region_ptr->next;
+        gdlll_arena_free_region(region_ptr);
+    }
+
+    gdllc_ptr->arena_number_of_regions = 1;
+    memset(gdllc_ptr->arena_free_blocks, 0,
+           GDLLL_ARENA_NUM_BLOCK_CLASSES * sizeof(void *));
+    gdllc_ptr->arena_next_free_block = ((char *)(gdllc_ptr->arena_regions)) +
+                                       GDLLL_ARENA_REGION_HEADER_SIZE;
+    gdllc_ptr->arena_end = ((char *)(gdllc_ptr->arena_regions)) +
+                           GDLLL_ARENA_REGION_SIZE;
+
+} // end of gdlll_arena_reset() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function adds 'change' (1 or -1) to the number of
+// blocks in use of the arena and of the region of 'block_ptr'.
+static void gdlll_arena_count_block(struct gdll_container *gdllc_ptr,
+                                    void *block_ptr, long change)
+{
+
+    struct gdll_arena_region *region_ptr =
+                                    GDLLL_ARENA_REGION_OF_BLOCK(block_ptr);
+
+    region_ptr->number_of_blocks_in_use =
+                                region_ptr->number_of_blocks_in_use + change;
+    gdllc_ptr->arena_number_of_blocks_in_use =
+                            gdllc_ptr->arena_number_of_blocks_in_use + change;
+
+    // the last block in use of an arena that has been disabled
+    if ((!gdllc_ptr->arena_mode_enabled) &&
+        (gdllc_ptr->arena_number_of_blocks_in_use == 0)) {
+        gdlll_arena_free_all_regions(gdllc_ptr);
+    }
+
+} // end of gdlll_arena_count_block() function
+
+int gdlll_relayout_container(struct gdll_container *gdllc_ptr)
+{
+
+    return gdlll_relayout_container_incrementally(gdllc_ptr, LONG_MAX);
+
+} // end of gdlll_relayout_container() function
+
+int gdlll_relayout_container_incrementally(struct gdll_container *gdllc_ptr,
+                                           long max_elements)
+{
+
+    struct element *old_elem_ptr = NULL;
+    long num_moved = 0;
+    int retval = GDLLL_ERROR_INIT_VALUE;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (max_elements <= 0) {
+        return GDLLL_NUM_ELEMENTS_IS_INVALID;
+    }
+
+    // the snapshots that have been released don't matter
+    if (gdllc_ptr->snapshots) {
+        gdlll_reclaim_snapshots(gdllc_ptr);
+    }
+
+    // readers of other threads and snapshots may be on the elements
+    if ((gdllc_ptr->epoch_reclamation_enabled) || (gdllc_ptr->snapshots)) {
+        return GDLLL_CONTAINER_IS_SHARED;
+    }
+
+    if (gdllc_ptr->ring_capacity > 0) {
+        return GDLLL_SUCCESS;
+    }
+
+    // an arena that has been disabled but not freed yet is used again
+    if (gdllc_ptr->arena_regions) {
+        gdllc_ptr->arena_mode_enabled = 1;
+    } else if (!gdllc_ptr->arena_mode_enabled) {
+        retval = gdlll_arena_start(gdllc_ptr, GDLLL_NO_NUMA_NODE);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+    }
+
+    if (!gdllc_ptr->relayout_in_progress) {
+        gdllc_ptr->relayout_in_progress = 1;
+        gdllc_ptr->relayout_next_element = gdllc_ptr->first;
+    }
+
+    while ((gdllc_ptr->relayout_next_element) && (num_moved < max_elements)) {
+        old_elem_ptr = gdllc_ptr->relayout_next_element;
+        gdllc_ptr->relayout_next_element = old_elem_ptr->next;
+        if (!gdlll_relayout_element(gdllc_ptr, old_elem_ptr)) {
+            gdllc_ptr->relayout_next_element = old_elem_ptr;
+            return GDLLL_NO_MEMORY;
+        }
+        num_moved = num_moved + 1;
+    }
+
+    if (!gdllc_ptr->relayout_next_element) {
+        gdllc_ptr->relayout_in_progress = 0;
+        gdlll_arena_free_empty_regions(gdllc_ptr);
+    }
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_relayout_container_incrementally() function
+
+int gdlll_relayout_is_in_progress(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return 0;
+    }
+
+    return gdllc_ptr->relayout_in_progress;
+
+} // end of gdlll_relayout_is_in_progress() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function moves an element of the list (and its
+// payload, if it is not too big for the arena) to new blocks taken from the
+// unused part of the arena (not from the free lists, so the elements moved one
+// after the other are next to each other in memory). The neighbours of the
+// element, 'first', 'last', the finger and the indexes are updated, and the
+// old blocks are given back. It returns the moved element (NULL if there is no
+// memory, then the element is not moved).
+static struct element *gdlll_relayout_element(struct gdll_container *gdllc_ptr,
+                                              struct element *old_elem_ptr)
+{
+
+    struct element *new_elem_ptr = NULL;
+    void *payload_ptr = NULL;
+    unsigned int block_flags = 0;
+    unsigned int payload_flags = 0;
+    long data_size = old_elem_ptr->data_size;
+
+    // the data of a slot of a ring may be too big for an inline data area
+    if ((GDLLL_ELEMENT_DATA_IS_INLINE(old_elem_ptr)) &&
+        (data_size <= GDLLL_INLINE_DATA_SIZE)) {
+        block_flags = GDLLL_ELEMENT_HAS_INLINE_DATA_AREA;
+    }
+
+    block_flags = block_flags |
+                  (old_elem_ptr->flags & GDLLL_ELEMENT_HAS_EXTENSION_AREA);
+
+    new_elem_ptr = gdlll_arena_take_new_block(gdllc_ptr,
+                                (long)(GDLLL_ELEMENT_BLOCK_SIZE(block_flags)));
+    if (!new_elem_ptr) {
+        return NULL;
+    }
+
+    new_elem_ptr->flags = GDLLL_ELEMENT_IS_IN_ARENA | block_flags;
+    gdlll_arena_count_block(gdllc_ptr, new_elem_ptr, 1);
+
+    if (block_flags & GDLLL_ELEMENT_HAS_INLINE_DATA_AREA) {
+        payload_ptr = GDLLL_ELEMENT_INLINE_DATA_PTR(new_elem_ptr);
+    } else if (data_size <= GDLLL_ARENA_MAX_PAYLOAD_SIZE) {
+        payload_ptr = gdlll_arena_take_new_block(gdllc_ptr,
+                    16L * GDLLL_ARENA_BLOCK_CLASS_INDEX(data_size));
+        if (payload_ptr) {
+            gdlll_arena_count_block(gdllc_ptr, payload_ptr, 1);
+            payload_flags = GDLLL_ELEMENT_PAYLOAD_IS_IN_ARENA;
+        }
+    } else if (GDLLL_ELEMENT_DATA_IS_INLINE(old_elem_ptr)) {
+        // a big payload in a slot of a ring can't stay where it is
+        payload_ptr = gdlll_allocate_payload_block(gdllc_ptr, data_size,
+                                                   &payload_flags);
+    } else {
+        // a big payload stays where it is
+        payload_ptr = old_elem_ptr->data_ptr;
+        payload_flags = old_elem_ptr->flags &
+                                    (GDLLL_ELEMENT_PAYLOAD_IS_CLASS_SIZED |
+                                     GDLLL_ELEMENT_PAYLOAD_IS_IN_ARENA);
+    }
+
+    if (!payload_ptr) {
+        // the new element block goes to the free list
+        gdlll_release_element_block(gdllc_ptr, new_elem_ptr);
+        return NULL;
+    }
+
+    *new_elem_ptr = *old_elem_ptr;
+    new_elem_ptr->data_ptr = payload_ptr;
+
+    // an extension that is not in the block of the element stays where it is
+    if (block_flags & GDLLL_ELEMENT_HAS_EXTENSION_AREA) {
+        new_elem_ptr->extension = GDLLL_ELEMENT_EXTENSION_AREA_PTR(new_elem_ptr);
+        *(new_elem_ptr->extension) = *(old_elem_ptr->extension);
+    }
+
+    if (payload_ptr != old_elem_ptr->data_ptr) {
+        memcpy(payload_ptr, old_elem_ptr->data_ptr, (size_t)(data_size));
+    } else {
+        // the old element must not free the payload
+        old_elem_ptr->data_ptr = NULL;
+    }
+
+    new_elem_ptr->flags = (old_elem_ptr->flags &
+                           ~(GDLLL_ELEMENT_IS_IN_RING |
+                             GDLLL_ELEMENT_IS_IN_ARENA |
+                             GDLLL_ELEMENT_HAS_INLINE_DATA_AREA |
+                             GDLLL_ELEMENT_HAS_EXTENSION_AREA |
+                             GDLLL_ELEMENT_PAYLOAD_IS_CLASS_SIZED |
+                             GDLLL_ELEMENT_PAYLOAD_IS_IN_ARENA)) |
+                          GDLLL_ELEMENT_IS_IN_ARENA | block_flags |
+                          payload_flags;
+
+    if (new_elem_ptr->prev) {
+        GDLLL_STORE_RELEASE(new_elem_ptr->prev->next, new_elem_ptr);
+    } else {
+        GDLLL_STORE_RELEASE(gdllc_ptr->first, new_elem_ptr);
+    }
+
+    if (new_elem_ptr->next) {
+        new_elem_ptr->next->prev = new_elem_ptr;
+    } else {
+        gdllc_ptr->last = new_elem_ptr;
+    }
+
+    if (gdllc_ptr->sorted_insertion_finger == old_elem_ptr) {
+        gdllc_ptr->sorted_insertion_finger = new_elem_ptr;
+    }
+
+    // The indexes may be stale (then they will be rebuilt from the list), so
+    // only a position that really has the old element is updated.
+    if ((gdllc_ptr->integer_key_index_enabled) &&
+        (GDLLL_INTEGER_KEY_SLOT(new_elem_ptr) >= 0) &&
+        (GDLLL_INTEGER_KEY_SLOT(new_elem_ptr) <
+                                    gdllc_ptr->integer_key_index_size) &&
+        (gdllc_ptr->integer_key_elems[GDLLL_INTEGER_KEY_SLOT(new_elem_ptr)] ==
+                                                            old_elem_ptr)) {
+        gdllc_ptr->integer_key_elems[GDLLL_INTEGER_KEY_SLOT(new_elem_ptr)] =
+                                                            new_elem_ptr;
+    }
+
+    if ((gdllc_ptr->priority_queue_enabled) &&
+        (GDLLL_HEAP_INDEX(new_elem_ptr) >= 0) &&
+        (GDLLL_HEAP_INDEX(new_elem_ptr) < gdllc_ptr->heap_size) &&
+        (gdllc_ptr->heap[GDLLL_HEAP_INDEX(new_elem_ptr)] == old_elem_ptr)) {
+        gdllc_ptr->heap[GDLLL_HEAP_INDEX(new_elem_ptr)] = new_elem_ptr;
+    }
+
+    if (GDLLL_ORDER_NODE(new_elem_ptr)) {
+        gdlll_move_order_statistic_node(gdllc_ptr,
+                                        &(old_elem_ptr->extension->order_node),
+                                        new_elem_ptr);
+    }
+
+    gdlll_replace_element_in_continuations(gdllc_ptr, old_elem_ptr,
+                                           new_elem_ptr);
+
+    gdlll_free_element_data(gdllc_ptr, old_elem_ptr);
+    gdlll_release_element_block(gdllc_ptr, old_elem_ptr);
+
+    return new_elem_ptr;
+
+} // end of gdlll_relayout_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function gives back to the system the regions of the
+// arena (except the newest one) that have no block in use. The free blocks in
+// those regions are removed from the free lists first.
+static void gdlll_arena_free_empty_regions(struct gdll_container *gdllc_ptr)
+{
+
+    struct gdll_arena_region *region_ptr = NULL;
+    struct gdll_arena_region *prev_region_ptr = NULL;
+    void **block_link_ptr = NULL;
+    int i = 0;
+
+    for (i = 0; i < GDLLL_ARENA_NUM_BLOCK_CLASSES; i = i + 1) {
+        block_link_ptr = &(gdllc_ptr->arena_free_blocks[i]);
+        while (*block_link_ptr) {
+            region_ptr = GDLLL_ARENA_REGION_OF_BLOCK(*block_link_ptr);
+            if ((region_ptr->number_of_blocks_in_use == 0) &&
+                (region_ptr != gdllc_ptr->arena_regions)) {
+                *block_link_ptr = *((void **)(*block_link_ptr));
+            } else {
+                block_link_ptr = (void **)(*block_link_ptr);
+            }
+        }
+    }
+
+    prev_region_ptr = gdllc_ptr->arena_regions;
+    while (prev_region_ptr->next) {
+        region_ptr = prev_region_ptr->next;
+        if (region_ptr->number_of_blocks_in_use == 0) {
+            prev_region_ptr->next = region_ptr->next;
+            gdlll_arena_free_region(region_ptr);
+            gdllc_ptr->arena_number_of_regions =
+                                    gdllc_ptr->arena_number_of_regions - 1;
+        } else {
+            prev_region_ptr = region_ptr;
+        }
+    }
+
+} // end of gdlll_arena_free_empty_regions() function
+
+int gdlll_enable_async_deletion(struct gdll_container *gdllc_ptr)
+{
+
+#if defined(GDLLL_NO_THREADS)
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    return GDLLL_THREAD_CREATION_FAILED;
+
+#else
+
+    struct gdll_async_deleter *deleter_ptr = NULL;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (gdllc_ptr->async_deleter) {
+        return GDLLL_SUCCESS;
+    }
+
+    deleter_ptr = calloc(1, sizeof(*deleter_ptr));
+    if (!deleter_ptr) {
+        return GDLLL_NO_MEMORY;
+    }
+
+    deleter_ptr->stack = NULL;
+    deleter_ptr->reclaimer_is_waiting = 0;
+    deleter_ptr->stop = 0;
+    deleter_ptr->number_of_queued_elements = 0;
+    deleter_ptr->number_of_freed_elements = 0;
+    deleter_ptr->call_function_before_deleting_data =
+                                gdllc_ptr->call_function_before_deleting_data;
+
+    if (pthread_mutex_init(&(deleter_ptr->mutex), NULL) != 0) {
+        free(deleter_ptr);
+        return GDLLL_THREAD_CREATION_FAILED;
+    }
+
+    if (pthread_cond_init(&(deleter_ptr->work_cond), NULL) != 0) {
+        pthread_mutex_destroy(&(deleter_ptr->mutex));
+        free(deleter_ptr);
+        return GDLLL_THREAD_CREATION_FAILED;
+    }
+
+    if (pthread_cond_init(&(deleter_ptr->done_cond), NULL) != 0) {
+        pthread_cond_destroy(&(deleter_ptr->work_cond));
+        pthread_mutex_destroy(&(deleter_ptr->mutex));
+        free(deleter_ptr);
+        return GDLLL_THREAD_CREATION_FAILED;
+    }
+
+    if (pthread_create(&(deleter_ptr->thread), NULL,
+                       gdlll_async_deleter_thread, deleter_ptr) != 0) {
+        pthread_cond_destroy(&(deleter_ptr->done_cond));
+        pthread_cond_destroy(&(deleter_ptr->work_cond));
+        pthread_mutex_destroy(&(deleter_ptr->mutex));
+        free(deleter_ptr);
+        return GDLLL_THREAD_CREATION_FAILED;
+    }
+
+    gdllc_ptr->async_deleter = deleter_ptr;
+
+    return GDLLL_SUCCESS;
+
+#endif
+
+} // end of gdlll_enable_async_deletion() function
+
+void gdlll_flush_async_deletion(struct gdll_container *gdllc_ptr)
+{
+
+#if !defined(GDLLL_NO_THREADS)
+
+    struct gdll_async_deleter *deleter_ptr = NULL;
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    deleter_ptr = gdllc_ptr->async_deleter;
+
+    if (!deleter_ptr) {
+        return;
+    }
+
+    pthread_mutex_lock(&(deleter_ptr->mutex));
+
+    pthread_cond_signal(&(deleter_ptr->work_cond));
+
+    while (deleter_ptr->number_of_freed_elements <
+                                    deleter_ptr->number_of_queued_elements) {
+        pthread_cond_wait(&(deleter_ptr->done_cond), &(deleter_ptr->mutex));
+    }
+
+    pthread_mutex_unlock(&(deleter_ptr->mutex));
+
+#else
+
+    (void)(gdllc_ptr);
+
+#endif
+
+    return;
+
+} // end of gdlll_flush_async_deletion() function
+
+void gdlll_disable_async_deletion(struct gdll_container *gdllc_ptr)
+{
+
+#if !defined(GDLLL_NO_THREADS)
+
+    struct gdll_async_deleter *deleter_ptr = NULL;
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    deleter_ptr = gdllc_ptr->async_deleter;
+
+    if (!deleter_ptr) {
+        return;
+    }
+
+    // the reclaimer thread frees all the queued elements before it stops
+    pthread_mutex_lock(&(deleter_ptr->mutex));
+    deleter_ptr->stop = 1;
+    pthread_cond_signal(&(deleter_ptr->work_cond));
+    pthread_mutex_unlock(&(deleter_ptr->mutex));
+
+    pthread_join(deleter_ptr->thread, NULL);
+
+    pthread_cond_destroy(&(deleter_ptr->done_cond));
+    pthread_cond_destroy(&(deleter_ptr->work_cond));
+    pthread_mutex_destroy(&(deleter_ptr->mutex));
+    free(deleter_ptr);
+
+    gdllc_ptr->async_deleter = NULL;
+
+#else
+
+    (void)(gdllc_ptr);
+
+#endif
+
+    return;
+
+} // end of gdlll_disable_async_deletion() function
+
+#if !defined(GDLLL_NO_THREADS)
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function pushes the element (that nobody is using any
+// more) on the stack of the reclaimer thread and wakes up the reclaimer thread
+// if it is waiting. Only the writer calls this function.
+static void gdlll_async_deleter_push(struct gdll_async_deleter *deleter_ptr,
+                                     struct element *elem_ptr)
+{
+
+    struct element *old_top = NULL;
+
+    // Treiber stack push. The reclaimer only takes the whole stack at once, so
+    // there is no ABA problem.
+    old_top = GDLLL_LOAD_ACQUIRE(deleter_ptr->stack);
+    do {
+        elem_ptr->next = old_top;
+    } while (!__atomic_compare_exchange_n(&(deleter_ptr->stack), &old_top,
+                                          elem_ptr, 1, __ATOMIC_SEQ_CST,
+                                          __ATOMIC_ACQUIRE));
+
+    deleter_ptr->number_of_queued_elements =
+                                deleter_ptr->number_of_queued_elements + 1;
+
+    // The reclaimer sets 'reclaimer_is_waiting' before it checks the stack for
+    // the last time, so either it sees this element or it is woken up here.
+    if (GDLLL_LOAD_SEQ_CST(deleter_ptr->reclaimer_is_waiting)) {
+        pthread_mutex_lock(&(deleter_ptr->mutex));
+        pthread_cond_signal(&(deleter_ptr->work_cond));
+        pthread_mutex_unlock(&(deleter_ptr->mutex));
+    }
+
+} // end of gdlll_async_deleter_push() function
+
+// This is the reclaimer thread. It takes all the elements on the stack at once,
+// calls call_function_before_deleting_data() for their data and frees them,
+// and then waits for more elements.
+static void *gdlll_async_deleter_thread(void *arg)
+{
+
+    struct gdll_async_deleter *deleter_ptr = arg;
+    struct element *list = NULL;
+    struct element *temp = NULL;
+    long count = 0;
+
+    pthread_mutex_lock(&(deleter_ptr->mutex));
+
+    while (1) {
+
+        list = __atomic_exchange_n(&(deleter_ptr->stack), NULL,
+                                   __ATOMIC_ACQ_REL);
+
+        if (list) {
+
+            pthread_mutex_unlock(&(deleter_ptr->mutex));
+
+            count = 0;
+            while (list) {
+                temp = list;
+                list = list->next;
+                if (deleter_ptr->call_function_before_deleting_data) {
+                    deleter_ptr->call_function_before_deleting_data(
+                                                            temp->data_ptr);
+                }
+                // The payload is freed directly. A class sized payload block
+                // must not go to the node cache of this thread, nobody would
+                // take it from there.
+                if (!GDLLL_ELEMENT_DATA_IS_INLINE(temp)) {
+                    free(temp->data_ptr);
+                }
+                gdlll_free_element_extension(temp);
+                free(temp);
+                count = count + 1;
+            }
+
+            pthread_mutex_lock(&(deleter_ptr->mutex));
+            deleter_ptr->number_of_freed_elements =
+                            deleter_ptr->number_of_freed_elements + count;
+            pthread_cond_broadcast(&(deleter_ptr->done_cond));
+            continue;
+
+        }
+
+        if (deleter_ptr->stop) {
+            break;
+        }
+
+        GDLLL_STORE_SEQ_CST(deleter_ptr->reclaimer_is_waiting, 1);
+
+        if (GDLLL_LOAD_SEQ_CST(deleter_ptr->stack) == NULL) {
+            pthread_cond_wait(&(deleter_ptr->work_cond),
+                              &(deleter_ptr->mutex));
+        }
+
+        GDLLL_STORE_SEQ_CST(deleter_ptr->reclaimer_is_waiting, 0);
+
+    }
+
+    pthread_mutex_unlock(&(deleter_ptr->mutex));
+
+    return NULL;
+
+} // end of gdlll_async_deleter_thread() function
+
+#endif
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function should be called only in ring mode. It
+// makes sure that 'num_elements' slots (with room for 'data_size' bytes) are
+// free, by deleting the first elements of the list if 'ring_when_full' is
+// GDLLL_RING_OVERWRITE_OLDEST_WHEN_FULL. It returns GDLLL_SUCCESS,
+// GDLLL_DATA_SIZE_IS_INVALID or GDLLL_CONTAINER_IS_FULL.
+static int gdlll_make_room_in_ring(struct gdll_container *gdllc_ptr,
+                                   long data_size, long num_elements)
+{
+
+    long num_free_slots = 0;
+
+    if (data_size > gdllc_ptr->ring_max_data_size) {
+        return GDLLL_DATA_SIZE_IS_INVALID;
+    }
+
+    if (num_elements > gdllc_ptr->ring_capacity) {
+        return GDLLL_CONTAINER_IS_FULL;
+    }
+
+    while (gdllc_ptr->ring_number_of_free_slots < num_elements) {
+
+        if ((gdllc_ptr->ring_when_full !=
+                                    GDLLL_RING_OVERWRITE_OLDEST_WHEN_FULL) ||
+            (gdllc_ptr->first == NULL)) {
+            return GDLLL_CONTAINER_IS_FULL;
+        }
+
+        num_free_slots = gdllc_ptr->ring_number_of_free_slots;
+
+        gdlll_delete_element_in_list(gdllc_ptr, gdllc_ptr->first);
+
+        // the slot is not freed now with lazy deletion or epochs
+        if (gdllc_ptr->ring_number_of_free_slots == num_free_slots) {
+            return GDLLL_CONTAINER_IS_FULL;
+        }
+
+    }
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_make_room_in_ring() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function adds 'change' bytes to the memory count of
+// the container and to the change of the process wide count by this thread.
+// The change of this thread is added to the process wide count when it reaches
+// GDLLL_GLOBAL_MEMORY_BATCH_SIZE bytes, so that the threads don't write to the
+// same cache line for every element.
+static void gdlll_count_memory(struct gdll_container *gdllc_ptr, long change)
+{
+
+    gdllc_ptr->memory_in_use = gdllc_ptr->memory_in_use + change;
+
+    // the change of this thread is added to the process wide count when the
+    // thread exits too
+    gdlll_node_cache_register();
+
+    gdlll_global_memory_change_of_thread =
+                                gdlll_global_memory_change_of_thread + change;
+
+    if ((gdlll_global_memory_change_of_thread >=
+                                        GDLLL_GLOBAL_MEMORY_BATCH_SIZE) ||
+        (gdlll_global_memory_change_of_thread <=
+                                        -GDLLL_GLOBAL_MEMORY_BATCH_SIZE)) {
+        GDLLL_ADD_RELAXED(gdlll_global_memory_in_use,
+                          gdlll_global_memory_change_of_thread);
+        gdlll_global_memory_change_of_thread = 0;
+    }
+
+    return;
+
+} // end of gdlll_count_memory() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function should be called only if the container has
+// a memory limit. It makes sure that 'num_elements' elements with a payload of
+// 'data_size' bytes fit under the limit, by deleting the elements chosen by
+// the eviction policy of the container. It returns GDLLL_SUCCESS or
+// GDLLL_MEMORY_LIMIT_IS_REACHED.
+static int gdlll_make_room_under_memory_limit(struct gdll_container *gdllc_ptr,
+                                              long data_size,
+                                              long num_elements)
+{
+
+    long memory_size = 0;
+    struct element *elem_ptr = NULL;
+
+    memory_size = GDLLL_MEMORY_SIZE_OF_ELEMENT(data_size) * num_elements;
+
+    if (memory_size > gdllc_ptr->memory_limit) {
+        return GDLLL_MEMORY_LIMIT_IS_REACHED;
+    }
+
+    while ((gdllc_ptr->memory_in_use + memory_size) >
+                                                gdllc_ptr->memory_limit) {
+
+        if (!gdllc_ptr->choose_element_to_evict) {
+            return GDLLL_MEMORY_LIMIT_IS_REACHED;
+        }
+
+        elem_ptr = gdllc_ptr->choose_element_to_evict(gdllc_ptr);
+
+        // a tombstone has been deleted already (its memory is given back when
+        // it is removed from the list)
+        if ((!elem_ptr) || (GDLLL_IS_TOMBSTONE(elem_ptr))) {
+            return GDLLL_MEMORY_LIMIT_IS_REACHED;
+        }
+
+        gdlll_delete_element_in_list(gdllc_ptr, elem_ptr);
+
+    }
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_make_room_under_memory_limit() function
+
+int gdlll_enable_ring_mode(struct gdll_container *gdllc_ptr, long capacity,
+                           long max_data_size, int when_full)
+{
+
+    struct element *elem_ptr = NULL;
+    long data_area_size = 0;
+    long i = 0;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (capacity <= 0) {
+        return GDLLL_NUM_ELEMENTS_IS_INVALID;
+    }
+
+    if (max_data_size <= 0) {
+        return GDLLL_DATA_SIZE_IS_INVALID;
+    }
+
+    if ((when_full != GDLLL_RING_REJECT_WHEN_FULL) &&
+        (when_full != GDLLL_RING_OVERWRITE_OLDEST_WHEN_FULL)) {
+        return GDLLL_WHEN_FULL_IS_INVALID;
+    }
+
+    if ((gdllc_ptr->total_number_of_elements != 0) ||
+        (gdllc_ptr->number_of_tombstones != 0)) {
+        return GDLLL_CONTAINER_IS_NOT_EMPTY;
+    }
+
+    if (gdllc_ptr->snapshots) {
+        gdlll_reclaim_snapshots(gdllc_ptr);
+    }
+
+    // the slots of the old ring that are in use are not in the list
+    if ((gdllc_ptr->ring_disabled_slots) ||
+        (gdllc_ptr->ring_number_of_free_slots !=
+                                        gdllc_ptr->ring_capacity)) {
+        return GDLLL_CONTAINER_IS_SHARED;
+    }
+
+    gdlll_disable_ring_mode(gdllc_ptr);
+
+    // the data area of every slot is a multiple of 16 bytes (for alignment)
+    data_area_size = max_data_size;
+    if (data_area_size < GDLLL_INLINE_DATA_SIZE) {
+        data_area_size = GDLLL_INLINE_DATA_SIZE;
+    }
+    data_area_size = (data_area_size + 15) & ~15L;
+
+    gdllc_ptr->ring_slot_size = (long)(GDLLL_ELEMENT_HEADER_SIZE) +
+                                data_area_size;
+
+    gdllc_ptr->ring_slots = calloc((size_t)(capacity),
+                                   (size_t)(gdllc_ptr->ring_slot_size));
+    if (!gdllc_ptr->ring_slots) {
+        gdllc_ptr->ring_slot_size = 0;
+        return GDLLL_NO_MEMORY;
+    }
+
+    // link all the slots in the free list (the first slot at the head)
+    gdllc_ptr->ring_free_list = NULL;
+    for (i = capacity - 1; i >= 0; i = i - 1) {
+        elem_ptr = (struct element *)(gdllc_ptr->ring_slots +
+                                      (i * gdllc_ptr->ring_slot_size));
+        elem_ptr->flags = GDLLL_ELEMENT_IS_IN_RING |
+                          GDLLL_ELEMENT_HAS_INLINE_DATA_AREA;
+        elem_ptr->next = gdllc_ptr->ring_free_list;
+        gdllc_ptr->ring_free_list = elem_ptr;
+    }
+
+    gdllc_ptr->ring_capacity = capacity;
+    gdllc_ptr->ring_max_data_size = max_data_size;
+    gdllc_ptr->ring_when_full = when_full;
+    gdllc_ptr->ring_number_of_free_slots = capacity;
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_enable_ring_mode() function
+
+void gdlll_disable_ring_mode(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    if (gdllc_ptr->ring_capacity == 0) {
+        return;
+    }
+
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+
+    if (gdllc_ptr->snapshots) {
+        gdlll_reclaim_snapshots(gdllc_ptr);
+    }
+
+    // The elements kept for the snapshots and the epoch readers may still be
+    // in the slots. If so, the slots are freed when the last of them is given
+    // back (see gdlll_release_element_memory()).
+    if (gdllc_ptr->ring_number_of_free_slots == gdllc_ptr->ring_capacity) {
+        free(gdllc_ptr->ring_slots);
+    } else {
+        gdllc_ptr->ring_disabled_slots = gdllc_ptr->ring_slots;
+        gdllc_ptr->ring_disabled_slots_size =
+                        gdllc_ptr->ring_capacity * gdllc_ptr->ring_slot_size;
+        gdllc_ptr->ring_disabled_number_of_slots_in_use =
+                gdllc_ptr->ring_capacity - gdllc_ptr->ring_number_of_free_slots;
+    }
+
+    gdllc_ptr->ring_capacity = 0;
+    gdllc_ptr->ring_max_data_size = 0;
+    gdllc_ptr->ring_slot_size = 0;
+    gdllc_ptr->ring_when_full = 0;
+    gdllc_ptr->ring_slots = NULL;
+    gdllc_ptr->ring_free_list = NULL;
+    gdllc_ptr->ring_number_of_free_slots = 0;
+
+    return;
+
+} // end of gdlll_disable_ring_mode() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function deletes an element that is in the list and
+// decrements total_number_of_elements by 1. If lazy deletion is enabled then
+// the element is only marked as a tombstone (and it stays in the list unless
+// it is the first or the last element).
+static void gdlll_delete_element_in_list(struct gdll_container *gdllc_ptr,
+                                         struct element *elem_ptr)
+{
+
+    gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements - 1;
+
+    if (!gdllc_ptr->lazy_deletion_enabled) {
+        if (gdllc_ptr->epoch_reclamation_enabled) {
+            // The 'next' of the element is not cleared, so a reader that is on
+            // this element can still go forward in the list.
+            gdlll_remove_element_from_indexes(gdllc_ptr, elem_ptr);
+            gdlll_unlink_element(gdllc_ptr, elem_ptr);
+        } else {
+            gdlll_remove_element_from_list(gdllc_ptr, elem_ptr);
+        }
+        gdlll_destroy_element(gdllc_ptr, elem_ptr);
+        return;
+    }
+
+    gdlll_remove_element_from_indexes(gdllc_ptr, elem_ptr);
+
+    elem_ptr->flags = elem_ptr->flags | GDLLL_ELEMENT_IS_TOMBSTONE;
+    gdllc_ptr->number_of_tombstones = gdllc_ptr->number_of_tombstones + 1;
+
+    if ((elem_ptr == gdllc_ptr->first) || (elem_ptr == gdllc_ptr->last)) {
+        gdlll_trim_tombstones(gdllc_ptr);
+    }
+
+    gdlll_purge_tombstones_if_needed(gdllc_ptr);
+
+} // end of gdlll_delete_element_in_list() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function should be called after a tombstone has been
+// added to the container. It purges all the tombstones if the dead ratio
+// threshold has been reached.
+static void gdlll_purge_tombstones_if_needed(struct gdll_container *gdllc_ptr)
+{
+
+    long threshold = gdllc_ptr->tombstone_purge_threshold_percent;
+
+    if (threshold == 0) {
+        return;
+    }
+
+    if ((gdllc_ptr->number_of_tombstones * 100) >=
+            (threshold * (gdllc_ptr->number_of_tombstones +
+                          gdllc_ptr->total_number_of_elements))) {
+        gdlll_purge_tombstones(gdllc_ptr);
+    }
+
+} // end of gdlll_purge_tombstones_if_needed() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function moves the tombstones at both ends of the list
+// to 'tombstone_list', so that the first and the last elements of the list are
+// not tombstones.
+static void gdlll_trim_tombstones(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp = NULL;
+
+    while ((gdllc_ptr->first) && (GDLLL_IS_TOMBSTONE(gdllc_ptr->first))) {
+        temp = gdllc_ptr->first;
+        gdlll_unlink_element(gdllc_ptr, temp);
+        temp->prev = NULL;
+        GDLLL_STORE_RELEASE(temp->next, gdllc_ptr->tombstone_list);
+        gdllc_ptr->tombstone_list = temp;
+    }
+
+    while ((gdllc_ptr->last) && (GDLLL_IS_TOMBSTONE(gdllc_ptr->last))) {
+        temp = gdllc_ptr->last;
+        gdlll_unlink_element(gdllc_ptr, temp);
+        temp->prev = NULL;
+        GDLLL_STORE_RELEASE(temp->next, gdllc_ptr->tombstone_list);
+        gdllc_ptr->tombstone_list = temp;
+    }
+
+} // end of gdlll_trim_tombstones() function
+
+int gdlll_enable_lazy_deletion(struct gdll_container *gdllc_ptr,
+                               int dead_ratio_threshold_percent)
+{
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if ((dead_ratio_threshold_percent < 0) ||
+        (dead_ratio_threshold_percent > 100)) {
+        return GDLLL_PERCENT_IS_INVALID;
+    }
+
+    gdllc_ptr->tombstone_purge_threshold_percent =
+                                            dead_ratio_threshold_percent;
+    gdllc_ptr->lazy_deletion_enabled = 1;
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_enable_lazy_deletion() function
+
+void gdlll_disable_lazy_deletion(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    gdlll_purge_tombstones(gdllc_ptr);
+
+    gdllc_ptr->lazy_deletion_enabled = 0;
+    gdllc_ptr->tombstone_purge_threshold_percent = 0;
+
+    return;
+
+} // end of gdlll_disable_lazy_deletion() function
+
+long gdlll_purge_tombstones(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp = NULL;
+    struct element *next = NULL;
+    long count = 0;
+
+    if (!gdllc_ptr) {
+        return 0;
+    }
+
+    if (gdllc_ptr->number_of_tombstones == 0) {
+        return 0;
+    }
+
+    // The tombstones in the list are never the first or the last element, so
+    // unlinking them doesn't change 'first' and 'last'.
+    temp = gdllc_ptr->first;
+
+    while (temp) {
+        next = temp->next;
+        if (GDLLL_IS_TOMBSTONE(temp)) {
+            gdlll_unlink_element(gdllc_ptr, temp);
+            gdlll_destroy_element(gdllc_ptr, temp);
+            count = count + 1;
+        }
+        temp = next;
+    }
+
+    while (gdllc_ptr->tombstone_list) {
+        temp = gdllc_ptr->tombstone_list;
+        gdllc_ptr->tombstone_list = temp->next;
+        gdlll_destroy_element(gdllc_ptr, temp);
+        count = count + 1;
+    }
+
+    gdllc_ptr->number_of_tombstones = 0;
+
+    return count;
+
+} // end of gdlll_purge_tombstones() function
+
+struct element *gdlll_peek_next_element(struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr)
+{
+
+    struct element *temp = NULL;
+
+    if ((!gdllc_ptr) || (!elem_ptr)) {
+        return NULL;
+    }
+
+    temp = GDLLL_LOAD_ACQUIRE(elem_ptr->next);
+
+    while ((temp) && (GDLLL_IS_TOMBSTONE(temp))) {
+        temp = GDLLL_LOAD_ACQUIRE(temp->next);
+    }
+
+    return temp;
+
+} // end of gdlll_peek_next_element() function
+
+struct element *gdlll_peek_prev_element(struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr)
+{
+
+    struct element *temp = NULL;
+
+    if ((!gdllc_ptr) || (!elem_ptr)) {
+        return NULL;
+    }
+
+    temp = elem_ptr->prev;
+
+    while ((temp) && (GDLLL_IS_TOMBSTONE(temp))) {
+        temp = temp->prev;
+    }
+
+    return temp;
+
+} // end of gdlll_peek_prev_element() function
+
+int gdlll_enable_epoch_reclamation(struct gdll_container *gdllc_ptr,
+                                   int max_readers)
+{
+
+    unsigned long *slots = NULL;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (max_readers <= 0) {
+        return GDLLL_NUM_READERS_IS_INVALID;
+    }
+
+    if (gdllc_ptr->epoch_reclamation_enabled) {
+        gdlll_disable_epoch_reclamation(gdllc_ptr);
+    }
+
+    slots = calloc((size_t)(max_readers) * GDLLL_EPOCH_READER_SLOT_STRIDE,
+                   sizeof(*slots));
+    if (!slots) {
+        return GDLLL_NO_MEMORY;
+    }
+
+    gdllc_ptr->epoch_reader_slots = slots;
+    gdllc_ptr->epoch_max_readers = max_readers;
+    gdllc_ptr->global_epoch = 0;
+    gdllc_ptr->epoch_number_of_retired_elements = 0;
+    gdllc_ptr->epoch_retired_since_last_reclaim = 0;
+    gdllc_ptr->epoch_reclamation_enabled = 1;
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_enable_epoch_reclamation() function
+
+void gdlll_disable_epoch_reclamation(struct gdll_container *gdllc_ptr)
+{
+
+    int i = 0;
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    if (!gdllc_ptr->epoch_reclamation_enabled) {
+        return;
+    }
+
+    for (i = 0; i < 3; i = i + 1) {
+        gdlll_free_retired_list(gdllc_ptr,
+                                &(gdllc_ptr->epoch_retired_lists[i]));
+    }
+
+    free(gdllc_ptr->epoch_reader_slots);
+
+    gdllc_ptr->epoch_reader_slots = NULL;
+    gdllc_ptr->epoch_max_readers = 0;
+    gdllc_ptr->epoch_number_of_retired_elements = 0;
+    gdllc_ptr->epoch_retired_since_last_reclaim = 0;
+    gdllc_ptr->epoch_reclamation_enabled = 0;
+
+    return;
+
+} // end of gdlll_disable_epoch_reclamation() function
+
+int gdlll_epoch_read_lock(struct gdll_container *gdllc_ptr, int reader_id)
+{
+
+    unsigned long epoch = 0;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if ((!gdllc_ptr->epoch_reclamation_enabled) || (reader_id < 0) ||
+        (reader_id >= gdllc_ptr->epoch_max_readers)) {
+        return GDLLL_READER_ID_IS_INVALID;
+    }
+
+    // A slot is 0 if the reader is not in a read section, otherwise it is
+    // ((epoch << 1) | 1). The barrier makes sure that the writer sees the slot
+    // before this reader loads any element of the list.
+    epoch = GDLLL_LOAD_SEQ_CST(gdllc_ptr->global_epoch);
+
+    GDLLL_STORE_SEQ_CST(gdllc_ptr->epoch_reader_slots[
+                        (size_t)(reader_id) * GDLLL_EPOCH_READER_SLOT_STRIDE],
+                        (epoch << 1) | 1UL);
+
+    GDLLL_FULL_MEMORY_BARRIER();
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_epoch_read_lock() function
+
+void gdlll_epoch_read_unlock(struct gdll_container *gdllc_ptr, int reader_id)
+{
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    if ((!gdllc_ptr->epoch_reclamation_enabled) || (reader_id < 0) ||
+        (reader_id >= gdllc_ptr->epoch_max_readers)) {
+        return;
+    }
+
+    GDLLL_STORE_SEQ_CST(gdllc_ptr->epoch_reader_slots[
+                        (size_t)(reader_id) * GDLLL_EPOCH_READER_SLOT_STRIDE],
+                        0UL);
+
+    return;
+
+} // end of gdlll_epoch_read_unlock() function
+
+long gdlll_epoch_reclaim(struct gdll_container *gdllc_ptr)
+{
+
+    long count = 0;
+    long freed = 0;
+    int i = 0;
+
+    if (!gdllc_ptr) {
+        return 0;
+    }
+
+    if (!gdllc_ptr->epoch_reclamation_enabled) {
+        return 0;
+    }
+
+    gdllc_ptr->epoch_retired_since_last_reclaim = 0;
+
+    // If no reader is stuck in an old epoch then two advances free all the
+    // retired elements.
+    for (i = 0; i < 2; i = i + 1) {
+        if (gdllc_ptr->epoch_number_of_retired_elements == 0) {
+            break;
+        }
+        freed = gdlll_epoch_try_to_advance(gdllc_ptr);
+        if (freed < 0) {
+            break;
+        }
+        count = count + freed;
+    }
+
+    return count;
+
+} // end of gdlll_epoch_reclaim() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function adds the element to the retired list of the
+// current epoch. The element is freed when no reader can be using it.
+static void gdlll_epoch_retire_element(struct gdll_container *gdllc_ptr,
+                                       struct element *elem_ptr)
+{
+
+    struct element **list_ptr = &(gdllc_ptr->epoch_retired_lists[
+                                        gdllc_ptr->global_epoch % 3]);
+
+    // 'next' is left as it is for the readers, so the retired list is linked
+    // by 'prev'.
+    elem_ptr->prev = *list_ptr;
+    *list_ptr = elem_ptr;
+
+    gdllc_ptr->epoch_number_of_retired_elements =
+                            gdllc_ptr->epoch_number_of_retired_elements + 1;
+    gdllc_ptr->epoch_retired_since_last_reclaim =
+                            gdllc_ptr->epoch_retired_since_last_reclaim + 1;
+
+    if (gdllc_ptr->epoch_retired_since_last_reclaim >=
+                                            GDLLL_EPOCH_RECLAIM_BATCH_SIZE) {
+        gdlll_epoch_reclaim(gdllc_ptr);
+    }
+
+} // end of gdlll_epoch_retire_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. The global epoch can go from 'e' to 'e + 1' only if every
+// reader that is in a read section has seen epoch 'e'. Such readers started
+// after all the elements of epoch 'e - 1' were removed from the list, so the
+// elements retired in epoch 'e - 1' can be freed after the advance. This
+// function returns the number of elements freed, or -1 if some reader is still
+// in an older epoch.
+static long gdlll_epoch_try_to_advance(struct gdll_container *gdllc_ptr)
+{
+
+    unsigned long epoch = gdllc_ptr->global_epoch;
+    unsigned long slot = 0;
+    int i = 0;
+
+    for (i = 0; i < gdllc_ptr->epoch_max_readers; i = i + 1) {
+        slot = GDLLL_LOAD_SEQ_CST(gdllc_ptr->epoch_reader_slots[
+                                (size_t)(i) * GDLLL_EPOCH_READER_SLOT_STRIDE]);
+        if ((slot & 1UL) && ((slot >> 1) != epoch)) {
+            return -1;
+        }
+    }
+
+    GDLLL_STORE_SEQ_CST(gdllc_ptr->global_epoch, epoch + 1);
+
+    // (epoch - 1) % 3 is the same as (epoch + 2) % 3
+    return gdlll_free_retired_list(gdllc_ptr,
+                            &(gdllc_ptr->epoch_retired_lists[(epoch + 2) % 3]));
+
+} // end of gdlll_epoch_try_to_advance() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function frees all the elements of a retired list
+// (linked by 'prev') and returns the number of elements freed.
+static long gdlll_free_retired_list(struct gdll_container *gdllc_ptr,
+                                    struct element **list_ptr)
+{
+
+    struct element *temp = NULL;
+    long count = 0;
+
+    while (*list_ptr) {
+        temp = *list_ptr;
+        *list_ptr = temp->prev;
+        gdlll_free_element(gdllc_ptr, temp);
+        count = count + 1;
+    }
+
+    gdllc_ptr->epoch_number_of_retired_elements =
+                            gdllc_ptr->epoch_number_of_retired_elements - count;
+
+    return count;
+
+} // end of gdlll_free_retired_list() function
+
+struct gdll_snapshot *gdlll_take_snapshot(struct gdll_container *gdllc_ptr)
+{
+
+    struct gdll_snapshot *snapshot_ptr = NULL;
+    struct element *temp = NULL;
+    long i = 0;
+
+    if (!gdllc_ptr) {
+        return NULL;
+    }
+
+    // free the snapshots that have been released (and the elements that only
+    // they were using)
+    gdlll_reclaim_snapshots(gdllc_ptr);
+
+    if (GDLLL_ALLOCATION_MUST_FAIL()) {
+        return NULL;
+    }
+
+    snapshot_ptr = calloc(1, sizeof(*snapshot_ptr));
+    if (!snapshot_ptr) {
+        return NULL;
+    }
+
+    if (gdllc_ptr->total_number_of_elements > 0) {
+        snapshot_ptr->elements = malloc(sizeof(*(snapshot_ptr->elements)) *
+                            (size_t)(gdllc_ptr->total_number_of_elements));
+        if (!snapshot_ptr->elements) {
+            free(snapshot_ptr);
+            return NULL;
+        }
+    }
+
+    gdllc_ptr->snapshot_version = gdllc_ptr->snapshot_version + 1;
+
+    snapshot_ptr->version = gdllc_ptr->snapshot_version;
+    snapshot_ptr->is_released = 0;
+
+    // Every element of the snapshot remembers the newest snapshot that has it,
+    // so that the writer knows that it must not change or free the element.
+    for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+        if (GDLLL_IS_TOMBSTONE(temp)) {
+            continue;
+        }
+        temp->snapshot_version = snapshot_ptr->version;
+        snapshot_ptr->elements[i] = temp;
+        i = i + 1;
+    }
+
+    snapshot_ptr->total_number_of_elements = i;
+
+    snapshot_ptr->next = gdllc_ptr->snapshots;
+    gdllc_ptr->snapshots = snapshot_ptr;
+
+    return snapshot_ptr;
+
+} // end of gdlll_take_snapshot() function
+
+long gdlll_snapshot_get_total_number_of_elements(
+                                        struct gdll_snapshot *snapshot_ptr)
+{
+
+    if (!snapshot_ptr) {
+        return 0;
+    }
+
+    return snapshot_ptr->total_number_of_elements;
+
+} // end of gdlll_snapshot_get_total_number_of_elements() function
+
+struct element *gdlll_snapshot_peek_element_at_position(
+                                        struct gdll_snapshot *snapshot_ptr,
+                                        long position)
+{
+
+    if (!snapshot_ptr) {
+        return NULL;
+    }
+
+    if ((position < 0) ||
+        (position >= snapshot_ptr->total_number_of_elements)) {
+        return NULL;
+    }
+
+    return snapshot_ptr->elements[position];
+
+} // end of gdlll_snapshot_peek_element_at_position() function
+
+void gdlll_release_snapshot(struct gdll_snapshot *snapshot_ptr)
+{
+
+    if (!snapshot_ptr) {
+        return;
+    }
+
+    // The snapshot is freed later by the writer (see gdlll_reclaim_snapshots()),
+    // so this is the only write of a reader.
+    GDLLL_STORE_RELEASE(snapshot_ptr->is_released, 1);
+
+    return;
+
+} // end of gdlll_release_snapshot() function
+
+long gdlll_reclaim_snapshots(struct gdll_container *gdllc_ptr)
+{
+
+    struct gdll_snapshot **snapshot_ptr_ptr = NULL;
+    struct gdll_snapshot *snapshot_ptr = NULL;
+    struct element **elem_ptr_ptr = NULL;
+    struct element *temp = NULL;
+    unsigned int oldest_version = 0;
+    long count = 0;
+
+    if (!gdllc_ptr) {
+        return 0;
+    }
+
+    gdllc_ptr->snapshot_retired_since_last_reclaim = 0;
+
+    // free the released snapshots and find the oldest one that is still in use
+    oldest_version = gdllc_ptr->snapshot_version + 1;
+
+    snapshot_ptr_ptr = &(gdllc_ptr->snapshots);
+    while (*snapshot_ptr_ptr) {
+        snapshot_ptr = *snapshot_ptr_ptr;
+        if (GDLLL_LOAD_ACQUIRE(snapshot_ptr->is_released)) {
+            *snapshot_ptr_ptr = snapshot_ptr->next;
+            free(snapshot_ptr->elements);
+            free(snapshot_ptr);
+            continue;
+        }
+        if (snapshot_ptr->version < oldest_version) {
+            oldest_version = snapshot_ptr->version;
+        }
+        snapshot_ptr_ptr = &(snapshot_ptr->next);
+    }
+
+    gdllc_ptr->oldest_snapshot_version_in_use = oldest_version;
+
+    // An element that is not in any snapshot in use can be destroyed now (the
+    // retired list is linked by 'prev', see gdlll_snapshot_retire_element()).
+    elem_ptr_ptr = &(gdllc_ptr->snapshot_retired_list);
+    while (*elem_ptr_ptr) {
+        temp = *elem_ptr_ptr;
+        if (temp->snapshot_version >= oldest_version) {
+            elem_ptr_ptr = &(temp->prev);
+            continue;
+        }
+        *elem_ptr_ptr = temp->prev;
+        temp->snapshot_version = 0;
+        gdlll_destroy_element(gdllc_ptr, temp);
+        count = count + 1;
+    }
+
+    gdllc_ptr->snapshot_number_of_retired_elements =
+                        gdllc_ptr->snapshot_number_of_retired_elements - count;
+
+    return count;
+
+} // end of gdlll_reclaim_snapshots() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function returns 1 if the element may be in a
+// snapshot that has not been freed yet (so its data must not be changed or
+// freed), and 0 otherwise.
+static int gdlll_element_is_in_snapshot(struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr)
+{
+
+    if (elem_ptr->snapshot_version == 0) {
+        return 0;
+    }
+
+    return (elem_ptr->snapshot_version >=
+                                gdllc_ptr->oldest_snapshot_version_in_use);
+
+} // end of gdlll_element_is_in_snapshot() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function adds the element (that has been removed from
+// the list) to the retired list of the snapshots. The element is destroyed
+// when all the snapshots that have it are released.
+static void gdlll_snapshot_retire_element(struct gdll_container *gdllc_ptr,
+                                          struct element *elem_ptr)
+{
+
+    // 'next' may still be used by an epoch reader, so link by 'prev'
+    elem_ptr->prev = gdllc_ptr->snapshot_retired_list;
+    gdllc_ptr->snapshot_retired_list = elem_ptr;
+
+    gdllc_ptr->snapshot_number_of_retired_elements =
+                        gdllc_ptr->snapshot_number_of_retired_elements + 1;
+    gdllc_ptr->snapshot_retired_since_last_reclaim =
+                        gdllc_ptr->snapshot_retired_since_last_reclaim + 1;
+
+    if (gdllc_ptr->snapshot_retired_since_last_reclaim >=
+                                        GDLLL_SNAPSHOT_RECLAIM_BATCH_SIZE) {
+        gdlll_reclaim_snapshots(gdllc_ptr);
+    }
+
+} // end of gdlll_snapshot_retire_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function frees all the snapshots (even the ones that
+// have not been released) and destroys all the elements that they have kept.
+static void gdlll_free_all_snapshots(struct gdll_container *gdllc_ptr)
+{
+
+    struct gdll_snapshot *snapshot_ptr = NULL;
+
+    for (snapshot_ptr = gdllc_ptr->snapshots; snapshot_ptr != NULL;
+         snapshot_ptr = snapshot_ptr->next) {
+        snapshot_ptr->is_released = 1;
+    }
+
+    gdlll_reclaim_snapshots(gdllc_ptr);
+
+} // end of gdlll_free_all_snapshots() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function just inserts the element in the list at the
+// appropriate place, it doesn't increment total_number_of_elements by 1.
+// Incrementing has to be done in the calling function. If
+// 'elem_before_which_to_insert_ptr' is NULL then the element is added to the
+// back of the list (the list may be empty in this case).
+static void gdlll_insert_element_before_element(
+                                            struct gdll_container *gdllc_ptr,
+                                          struct element *elem_to_insert_ptr,
+                             struct element *elem_before_which_to_insert_ptr)
+{
+
+    // The 'next' of the element is set before the element is published (with
+    // release semantics) to the readers that go forward in the list (see
+    // gdlll_epoch_read_lock()).
+    if (gdllc_ptr->first == NULL) {
+
+        gdllc_ptr->last = elem_to_insert_ptr;
+        GDLLL_STORE_RELEASE(gdllc_ptr->first, elem_to_insert_ptr);
+
+    } else if (elem_before_which_to_insert_ptr == NULL) {
+
+        // add elem_to_insert_ptr to back
+        elem_to_insert_ptr->prev = gdllc_ptr->last;
+        GDLLL_STORE_RELEASE(gdllc_ptr->last->next, elem_to_insert_ptr);
+        gdllc_ptr->last = elem_to_insert_ptr;
+
+    } else if (elem_before_which_to_insert_ptr == gdllc_ptr->first) {
+
+        // add elem_to_insert_ptr to front
+        elem_to_insert_ptr->next = gdllc_ptr->first;
+        elem_to_insert_ptr->next->prev = elem_to_insert_ptr;
+        GDLLL_STORE_RELEASE(gdllc_ptr->first, elem_to_insert_ptr);
+
+    } else {
+
+        // insert elem_to_insert_ptr before elem_before_which_to_insert_ptr
+        elem_to_insert_ptr->next = elem_before_which_to_insert_ptr;
+        elem_to_insert_ptr->prev = elem_before_which_to_insert_ptr->prev;
+        elem_before_which_to_insert_ptr->prev = elem_to_insert_ptr;
+        GDLLL_STORE_RELEASE(elem_to_insert_ptr->prev->next,
+                            elem_to_insert_ptr);
+
+    }
+
+    gdlll_add_element_to_indexes(gdllc_ptr, elem_to_insert_ptr);
+
+    gdlll_count_memory(gdllc_ptr,
+                       GDLLL_MEMORY_SIZE_OF_ELEMENT(
+                                            elem_to_insert_ptr->data_size));
+
+} // end of gdlll_insert_element_before_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function adds the key of the element to the integer
+// key index. If the index is stale then nothing is done (the index will be
+// rebuilt from the list). If there is no memory to grow the index (or for the
+// extension of the element) then the index is marked stale. This can happen
+// only while the index is rebuilt, as the elements that are added to the
+// container get both before they are linked (see
+// gdlll_make_room_in_indexes()).
+static void gdlll_add_element_to_integer_key_index(
+                                            struct gdll_container *gdllc_ptr,
+                                            struct element *elem_ptr)
+{
+
+    if (gdllc_ptr->integer_key_index_is_stale) {
+        return;
+    }
+
+    if ((elem_ptr->data_size < (long)(sizeof(long))) ||
+        (GDLLL_IS_TOMBSTONE(elem_ptr))) {
+        return;
+    }
+
+    if (!gdlll_get_element_extension(elem_ptr)) {
+        gdllc_ptr->integer_key_index_is_stale = 1;
+        return;
+    }
+
+    if (!gdlll_reserve_integer_key_index(gdllc_ptr,
+                                    gdllc_ptr->integer_key_index_size + 1)) {
+        gdllc_ptr->integer_key_index_is_stale = 1;
+        return;
+    }
+
+    memcpy(&(gdllc_ptr->integer_keys[gdllc_ptr->integer_key_index_size]),
+           elem_ptr->data_ptr, sizeof(long));
+    gdllc_ptr->integer_key_elems[gdllc_ptr->integer_key_index_size] = elem_ptr;
+    elem_ptr->extension->integer_key_slot = gdllc_ptr->integer_key_index_size;
+    gdllc_ptr->integer_key_index_size = gdllc_ptr->integer_key_index_size + 1;
+
+} // end of gdlll_add_element_to_integer_key_index() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function grows the arrays of the integer key index
+// (at least to double their size) if they don't have room for 'min_capacity'
+// keys. It returns 1 on success and 0 if there is no memory.
+static int gdlll_reserve_integer_key_index(struct gdll_container *gdllc_ptr,
+                                           long min_capacity)
+{
+
+    long new_capacity = gdllc_ptr->integer_key_index_capacity * 2;
+    long *new_keys = NULL;
+    struct element **new_elems = NULL;
+
+    if (min_capacity <= gdllc_ptr->integer_key_index_capacity) {
+        return 1;
+    }
+
+    if (new_capacity < 16) {
+        new_capacity = 16;
+    }
+
+    if (new_capacity < min_capacity) {
+        new_capacity = min_capacity;
+    }
+
+    if (GDLLL_ALLOCATION_MUST_FAIL()) {
+        return 0;
+    }
+
+    new_keys = realloc(gdllc_ptr->integer_keys,
+                       sizeof(*new_keys) * (size_t)(new_capacity));
+    if (!new_keys) {
+        return 0;
+    }
+    gdllc_ptr->integer_keys = new_keys;
+
+    new_elems = realloc(gdllc_ptr->integer_key_elems,
+                        sizeof(*new_elems) * (size_t)(new_capacity));
+    if (!new_elems) {
+        return 0;
+    }
+    gdllc_ptr->integer_key_elems = new_elems;
+
+    gdllc_ptr->integer_key_index_capacity = new_capacity;
+
+    return 1;
+
+} // end of gdlll_reserve_integer_key_index() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function removes the key of the element from the
+// integer key index by moving the last key of the index in its place.
+static void gdlll_remove_element_from_integer_key_index(
+                                            struct gdll_container *gdllc_ptr,
+                                            struct element *elem_ptr)
+{
+
+    long slot = GDLLL_INTEGER_KEY_SLOT(elem_ptr);
+    long last_slot = 0;
+
+    if (slot < 0) {
+        return;
+    }
+
+    elem_ptr->extension->integer_key_slot = -1;
+
+    if (gdllc_ptr->integer_key_index_is_stale) {
+        return;
+    }
+
+    last_slot = gdllc_ptr->integer_key_index_size - 1;
+
+    gdllc_ptr->integer_keys[slot] = gdllc_ptr->integer_keys[last_slot];
+    gdllc_ptr->integer_key_elems[slot] =
+                                    gdllc_ptr->integer_key_elems[last_slot];
+    gdllc_ptr->integer_key_elems[slot]->extension->integer_key_slot = slot;
+
+    gdllc_ptr->integer_key_index_size = last_slot;
+
+} // end of gdlll_remove_element_from_integer_key_index() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function rebuilds the integer key index from the
+// elements in the list. It returns 1 on success and 0 if there is no memory
+// (the index remains stale in this case).
+static int gdlll_rebuild_integer_key_index(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp = NULL;
+
+    // add all elements to an empty index
+    gdllc_ptr->integer_key_index_size = 0;
+    gdllc_ptr->integer_key_index_is_stale = 0;
+
+    for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+        if (temp->extension) {
+            temp->extension->integer_key_slot = -1;
+        }
+        gdlll_add_element_to_integer_key_index(gdllc_ptr, temp);
+    }
+
+    if (gdllc_ptr->integer_key_index_is_stale) {
+        for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+            if (temp->extension) {
+                temp->extension->integer_key_slot = -1;
+            }
+        }
+        return 0;
+    }
+
+    return 1;
+
+} // end of gdlll_rebuild_integer_key_index() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function adds the element (that has just been linked
+// in the list) to the integer key index, to the heap and to the order statistic
+// index (if they are enabled).
+static void gdlll_add_element_to_indexes(struct gdll_container *gdllc_ptr,
+                                         struct element *elem_ptr)
+{
+
+    if (gdllc_ptr->integer_key_index_enabled) {
+        gdlll_add_element_to_integer_key_index(gdllc_ptr, elem_ptr);
+    }
+
+    if (gdllc_ptr->priority_queue_enabled) {
+        gdlll_add_element_to_heap(gdllc_ptr, elem_ptr);
+    }
+
+    if (gdllc_ptr->order_statistic_index_enabled) {
+        gdlll_add_element_to_order_statistic_index(gdllc_ptr, elem_ptr);
+    }
+
+} // end of gdlll_add_element_to_indexes() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function removes the element (that is going to be
+// unlinked from the list or marked as a tombstone) from the integer key index,
+// from the heap and from the order statistic index (if they are enabled).
+static void gdlll_remove_element_from_indexes(struct gdll_container *gdllc_ptr,
+                                              struct element *elem_ptr)
+{
+
+    if (gdllc_ptr->integer_key_index_enabled) {
+        gdlll_remove_element_from_integer_key_index(gdllc_ptr, elem_ptr);
+    }
+
+    if (gdllc_ptr->priority_queue_enabled) {
+        gdlll_remove_element_from_heap(gdllc_ptr, elem_ptr);
+    }
+
+    if (gdllc_ptr->order_statistic_index_enabled) {
+        gdlll_remove_element_from_order_statistic_index(gdllc_ptr, elem_ptr);
+    }
+
+} // end of gdlll_remove_element_from_indexes() function
+
+int gdlll_enable_integer_key_index(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (gdllc_ptr->integer_key_index_enabled) {
+        return GDLLL_SUCCESS;
+    }
+
+    gdllc_ptr->integer_key_index_enabled = 1;
+
+    if (!gdlll_rebuild_integer_key_index(gdllc_ptr)) {
+        gdlll_disable_integer_key_index(gdllc_ptr);
+        return GDLLL_NO_MEMORY;
+    }
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_enable_integer_key_index() function
+
+void gdlll_disable_integer_key_index(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp = NULL;
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+        if (temp->extension) {
+            temp->extension->integer_key_slot = -1;
+        }
+    }
+
+    free(gdllc_ptr->integer_keys);
+    free(gdllc_ptr->integer_key_elems);
+
+    gdllc_ptr->integer_key_index_enabled = 0;
+    gdllc_ptr->integer_key_index_is_stale = 0;
+    gdllc_ptr->integer_keys = NULL;
+    gdllc_ptr->integer_key_elems = NULL;
+    gdllc_ptr->integer_key_index_size = 0;
+    gdllc_ptr->integer_key_index_capacity = 0;
+
+    return;
+
+} // end of gdlll_disable_integer_key_index() function
+
+struct element *gdlll_peek_element_with_integer_key(
+                                            struct gdll_container *gdllc_ptr,
+                                            long key)
+{
+
+    struct element *temp = NULL;
+    long elem_key = 0;
+    long slot = -1;
+
+    if (!gdllc_ptr) {
+        return NULL;
+    }
+
+    if (!gdllc_ptr->integer_key_index_enabled) {
+        return NULL;
+    }
+
+    if ((gdllc_ptr->integer_key_index_is_stale) &&
+        (!gdlll_rebuild_integer_key_index(gdllc_ptr))) {
+        // no memory for the index, so search the list
+        for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+            if ((temp->data_size >= (long)(sizeof(long))) &&
+                (!GDLLL_IS_TOMBSTONE(temp))) {
+                memcpy(&elem_key, temp->data_ptr, sizeof(long));
+                if (elem_key == key) {
+                    return temp;
+                }
+            }
+        }
+        return NULL;
+    }
+
+    slot = gdlll_find_integer_key(gdllc_ptr->integer_keys,
+                                  gdllc_ptr->integer_key_index_size, key);
+
+    if (slot < 0) {
+        return NULL;
+    }
+
+    return gdllc_ptr->integer_key_elems[slot];
+
+} // end of gdlll_peek_element_with_integer_key() function
+
+struct element *gdlll_peek_lower_bound_element_with_integer_key(
+                                            struct gdll_container *gdllc_ptr,
+                                            long key)
+{
+
+    struct element *temp = NULL;
+    struct element *best = NULL;
+    long best_key = LONG_MAX;
+    long elem_key = 0;
+    long slot = -1;
+
+    if (!gdllc_ptr) {
+        return NULL;
+    }
+
+    if (!gdllc_ptr->integer_key_index_enabled) {
+        return NULL;
+    }
+
+    if ((gdllc_ptr->integer_key_index_is_stale) &&
+        (!gdlll_rebuild_integer_key_index(gdllc_ptr))) {
+        // no memory for the index, so search the list
+        for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+            if ((temp->data_size >= (long)(sizeof(long))) &&
+                (!GDLLL_IS_TOMBSTONE(temp))) {
+                memcpy(&elem_key, temp->data_ptr, sizeof(long));
+                if ((elem_key >= key) && ((!best) || (elem_key < best_key))) {
+                    best = temp;
+                    best_key = elem_key;
+                }
+            }
+        }
+        return best;
+    }
+
+    // First find the smallest key that is >= 'key' (LONG_MAX if there is no
+    // such key) and then find where it is. If no key is >= 'key' then
+    // LONG_MAX is not found either (because LONG_MAX >= 'key').
+    best_key = gdlll_find_min_integer_key_not_less_than(
+                                        gdllc_ptr->integer_keys,
+                                        gdllc_ptr->integer_key_index_size, key);
+
+    slot = gdlll_find_integer_key(gdllc_ptr->integer_keys,
+                                  gdllc_ptr->integer_key_index_size, best_key);
+
+    if (slot < 0) {
+        return NULL;
+    }
+
+    return gdllc_ptr->integer_key_elems[slot];
+
+} // end of gdlll_peek_lower_bound_element_with_integer_key() function
+
+// This function returns the position of 'key' in 'keys' (the first position
+// if there are many), or -1 if 'key' is not in 'keys'.
+static long gdlll_find_integer_key(const long *keys, long num_keys, long key)
+{
+
+    long i = 0;
+
+#ifdef GDLLL_X86_64_SIMD
+    if (__builtin_cpu_supports("avx2")) {
+        return gdlll_find_integer_key_avx2(keys, num_keys, key);
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return gdlll_find_integer_key_sse42(keys, num_keys, key);
+    }
+#endif
+
+    for (i = 0; i < num_keys; i = i + 1) {
+        if (keys[i] == key) {
+            return i;
+        }
+    }
+
+    return -1;
+
+} // end of gdlll_find_integer_key() function
+
+// This function returns the smallest key in 'keys' that is >= 'key', or
+// LONG_MAX if there is no such key.
+static long gdlll_find_min_integer_key_not_less_than(const long *keys,
+                                                     long num_keys, long key)
+{
+
+    long min_key = LONG_MAX;
+    long i = 0;
+
+#ifdef GDLLL_X86_64_SIMD
+    if (__builtin_cpu_supports("avx2")) {
+        return gdlll_find_min_integer_key_not_less_than_avx2(keys, num_keys,
+                                                             key);
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return gdlll_find_min_integer_key_not_less_than_sse42(keys, num_keys,
+                                                              key);
+    }
+#endif
+
+    for (i = 0; i < num_keys; i = i + 1) {
+        if ((keys[i] >= key) && (keys[i] < min_key)) {
+            min_key = keys[i];
+        }
+    }
+
+    return min_key;
+
+} // end of gdlll_find_min_integer_key_not_less_than() function
+
+#ifdef GDLLL_X86_64_SIMD
+
+// Same as the scalar code in gdlll_find_integer_key() but compares 8 keys per
+// iteration with AVX2.
+__attribute__((target("avx2")))
+static long gdlll_find_integer_key_avx2(const long *keys, long num_keys,
+                                        long key)
+{
+
+    __m256i key_vec = _mm256_set1_epi64x(key);
+    __m256i eq_lo;
+    __m256i eq_hi;
+    int mask = 0;
+    long i = 0;
+
+    for (i = 0; (i + 8) <= num_keys; i = i + 8) {
+        eq_lo = _mm256_cmpeq_epi64(
+                    _mm256_loadu_si256((const __m256i *)(keys + i)), key_vec);
+        eq_hi = _mm256_cmpeq_epi64(
+                    _mm256_loadu_si256((const __m256i *)(keys + i + 4)),
+                    key_vec);
+        mask = _mm256_movemask_pd(_mm256_castsi256_pd(eq_lo)) |
+               (_mm256_movemask_pd(_mm256_castsi256_pd(eq_hi)) << 4);
+        if (mask) {
+            return i + __builtin_ctz((unsigned int)(mask));
+        }
+    }
+
+    for (; i < num_keys; i = i + 1) {
+        if (keys[i] == key) {
+            return i;
+        }
+    }
+
+    return -1;
+
+} // end of gdlll_find_integer_key_avx2() function
+
+// Same as the scalar code in gdlll_find_integer_key() but compares 4 keys per
+// iteration with SSE4.2.
+__attribute__((target("sse4.2")))
+static long gdlll_find_integer_key_sse42(const long *keys, long num_keys,
+                                         long key)
+{
+
+    __m128i key_vec = _mm_set1_epi64x(key);
+    __m128i eq_lo;
+    __m128i eq_hi;
+    int mask = 0;
+    long i = 0;
+
+    for (i = 0; (i + 4) <= num_keys; i = i + 4) {
+        eq_lo = _mm_cmpeq_epi64(_mm_loadu_si128((const __m128i *)(keys + i)),
+                                key_vec);
+        eq_hi = _mm_cmpeq_epi64(
+                    _mm_loadu_si128((const __m128i *)(keys + i + 2)), key_vec);
+        mask = _mm_movemask_pd(_mm_castsi128_pd(eq_lo)) |
+               (_mm_movemask_pd(_mm_castsi128_pd(eq_hi)) << 2);
+        if (mask) {
+            return i + __builtin_ctz((unsigned int)(mask));
+        }
+    }
+
+    for (; i < num_keys; i = i + 1) {
+        if (keys[i] == key) {
+            return i;
+        }
+    }
+
+    return -1;
+
+} // end of gdlll_find_integer_key_sse42() function
+
+// Same as the scalar code in gdlll_find_min_integer_key_not_less_than() but
+// handles 4 keys per iteration with AVX2. Keys that are < 'key' are replaced
+// by LONG_MAX and then the minimum is taken.
+__attribute__((target("avx2")))
+static long gdlll_find_min_integer_key_not_less_than_avx2(const long *keys,
+                                                          long num_keys,
+                                                          long key)
+{
+
+    __m256i key_vec = _mm256_set1_epi64x(key);
+    __m256i max_vec = _mm256_set1_epi64x(LONG_MAX);
+    __m256i min_vec = max_vec;
+    __m256i keys_vec;
+    long min_keys[4] = {0};
+    long min_key = LONG_MAX;
+    long i = 0;
+
+    for (i = 0; (i + 4) <= num_keys; i = i + 4) {
+        keys_vec = _mm256_loadu_si256((const __m256i *)(keys + i));
+        keys_vec = _mm256_blendv_epi8(keys_vec, max_vec,
+                                      _mm256_cmpgt_epi64(key_vec, keys_vec));
+        min_vec = _mm256_blendv_epi8(min_vec, keys_vec,
+                                     _mm256_cmpgt_epi64(min_vec, keys_vec));
+    }
+
+    _mm256_storeu_si256((__m256i *)(min_keys), min_vec);
+
+    for (; i < num_keys; i = i + 1) {
+        if ((keys[i] >= key) && (keys[i] < min_key)) {
+            min_key = keys[i];
+        }
+    }
+
+    for (i = 0; i < 4; i = i + 1) {
+        if (min_keys[i] < min_key) {
+            min_key = min_keys[i];
+        }
+    }
+
+    return min_key;
+
+} // end of gdlll_find_min_integer_key_not_less_than_avx2() function
+
+// Same as gdlll_find_min_integer_key_not_less_than_avx2() but handles 2 keys
+// per iteration with SSE4.2.
+__attribute__((target("sse4.2")))
+static long gdlll_find_min_integer_key_not_less_than_sse42(const long *keys,
+                                                           long num_keys,
+                                                           long key)
+{
+
+    __m128i key_vec = _mm_set1_epi64x(key);
+    __m128i max_vec = _mm_set1_epi64x(LONG_MAX);
+    __m128i min_vec = max_vec;
+    __m128i keys_vec;
+    long min_keys[2] = {0};
+    long min_key = LONG_MAX;
+    long i = 0;
+
+    for (i = 0; (i + 2) <= num_keys; i = i + 2) {
+        keys_vec = _mm_loadu_si128((const __m128i *)(keys + i));
+        keys_vec = _mm_blendv_epi8(keys_vec, max_vec,
+                                   _mm_cmpgt_epi64(key_vec, keys_vec));
+        min_vec = _mm_blendv_epi8(min_vec, keys_vec,
+                                  _mm_cmpgt_epi64(min_vec, keys_vec));
+    }
+
+    _mm_storeu_si128((__m128i *)(min_keys), min_vec);
+
+    for (; i < num_keys; i = i + 1) {
+        if ((keys[i] >= key) && (keys[i] < min_key)) {
+            min_key = keys[i];
+        }
+    }
+
+    for (i = 0; i < 2; i = i + 1) {
+        if (min_keys[i] < min_key) {
+            min_key = min_keys[i];
+        }
+    }
+
+    return min_key;
+
+} // end of gdlll_find_min_integer_key_not_less_than_sse42() function
+
+#endif
+
+struct element *gdlll_peek_front_element(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return NULL;
+    }
+
+    // in priority queue mode, the front element is the smallest element
+    if (gdllc_ptr->priority_queue_enabled) {
+        return gdlll_find_min_element(gdllc_ptr);
+    }
+
+    return GDLLL_LOAD_ACQUIRE(gdllc_ptr->first);
+
+} // end of gdlll_peek_front_element() function
+
+struct element *gdlll_peek_last_element(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return NULL;
+    }
+
+    return (gdllc_ptr->last);
+
+} // end of gdlll_peek_last_element() function
+
+struct element *gdlll_peek_matching_element(struct gdll_container *gdllc_ptr,
+                                            void *data_ptr, long data_size,
+                                            compare_elements_function comp_func)
+{
+
+    return gdlll_peek_matching_element_using_strategy(gdllc_ptr, data_ptr,
+                                                      data_size, comp_func,
+                                                      GDLLL_SEARCH_FORWARD);
+
+} // end of gdlll_peek_matching_element() function
+
+struct element *gdlll_peek_matching_element_using_strategy(
+                                        struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        int search_strategy)
+{
+
+    struct element key_elem = {0};
+
+    if (!gdllc_ptr) {
+        return NULL;
+    }
+
+    if (!data_ptr) {
+        return NULL;
+    }
+
+    if (data_size <= 0) {
+        return NULL;
+    }
+
+    if (!comp_func) {
+        return NULL;
+    }
+
+    if (!gdlll_is_valid_search_strategy(search_strategy)) {
+        return NULL;
+    }
+
+    // The readers of epoch based reclamation call this function while the
+    // writer changes the container, so the list is checked instead of
+    // 'total_number_of_elements' (which is not published to them).
+    if (GDLLL_LOAD_ACQUIRE(gdllc_ptr->first) == NULL) {
+        return NULL;
+    }
+
+    // The comparator only reads the elements, so the user's data can be
+    // compared in place without copying it into a new element.
+    key_elem.data_ptr = data_ptr;
+    key_elem.data_size = data_size;
+
+    return gdlll_find_matching_element(gdllc_ptr, &key_elem, comp_func,
+                                       search_strategy);
+
+} // end of gdlll_peek_matching_element_using_strategy() function
+
+// This function returns 1 if 'search_strategy' is one of the GDLLL_SEARCH_*
+// values, otherwise it returns 0.
+static int gdlll_is_valid_search_strategy(int search_strategy)
+{
+
+    if ((search_strategy == GDLLL_SEARCH_FORWARD) ||
+        (search_strategy == GDLLL_SEARCH_BACKWARD) ||
+        (search_strategy == GDLLL_SEARCH_FROM_BOTH_ENDS) ||
+        (search_strategy == GDLLL_SEARCH_SORTED_ASCENDING) ||
+        (search_strategy == GDLLL_SEARCH_SORTED_DESCENDING)) {
+        return 1;
+    }
+
+    return 0;
+
+} // end of gdlll_is_valid_search_strategy() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function should not be called if the number of
+// elements in the container is 0. This function returns the element that
+// matches 'key_elem_ptr' (as found by 'search_strategy'), or NULL if no element
+// matches.
+static struct element *gdlll_find_matching_element(
+                                        struct gdll_container *gdllc_ptr,
+                                        struct element *key_elem_ptr,
+                                        compare_elements_function comp_func,
+                                        int search_strategy)
+{
+
+    struct element *temp = NULL;
+    struct element *back = NULL;
+
+    if (search_strategy == GDLLL_SEARCH_BACKWARD) {
+
+        temp = gdllc_ptr->last;
+        while ((temp) && ((GDLLL_IS_TOMBSTONE(temp)) ||
+                          (comp_func(key_elem_ptr, temp) != 0))) {
+            temp = temp->prev;
+        }
+
+    } else if (search_strategy == GDLLL_SEARCH_FROM_BOTH_ENDS) {
+
+        temp = gdllc_ptr->first;
+        back = gdllc_ptr->last;
+        while (1) {
+            if ((!GDLLL_IS_TOMBSTONE(temp)) &&
+                (comp_func(key_elem_ptr, temp) == 0)) {
+                break;
+            }
+            if (temp == back) {
+                temp = NULL;
+                break;
+            }
+            if ((!GDLLL_IS_TOMBSTONE(back)) &&
+                (comp_func(key_elem_ptr, back) == 0)) {
+                temp = back;
+                break;
+            }
+            if (temp->next == back) {
+                temp = NULL;
+                break;
+            }
+            temp = temp->next;
+            back = back->prev;
+        }
+
+    } else if ((search_strategy == GDLLL_SEARCH_SORTED_ASCENDING) ||
+               (search_strategy == GDLLL_SEARCH_SORTED_DESCENDING)) {
+
+        // The first matching element (if any) is the first element that the
+        // key doesn't go after.
+        temp = gdlll_find_lower_bound(gdllc_ptr, key_elem_ptr, comp_func,
+                    (search_strategy == GDLLL_SEARCH_SORTED_ASCENDING) ?
+                    GDLLL_ASCENDING_ORDER : GDLLL_DESCENDING_ORDER);
+        // skip the matching tombstones
+        while ((temp) && (GDLLL_IS_TOMBSTONE(temp)) &&
+               (comp_func(key_elem_ptr, temp) == 0)) {
+            temp = temp->next;
+        }
+        if ((temp) && ((GDLLL_IS_TOMBSTONE(temp)) ||
+                       (comp_func(key_elem_ptr, temp) != 0))) {
+            temp = NULL;
+        }
+
+    } else {
+
+        temp = GDLLL_LOAD_ACQUIRE(gdllc_ptr->first);
+        while ((temp) && ((GDLLL_IS_TOMBSTONE(temp)) ||
+                          (comp_func(key_elem_ptr, temp) != 0))) {
+            temp = GDLLL_LOAD_ACQUIRE(temp->next);
+        }
+
+    }
+
+    return temp;
+
+} // end of gdlll_find_matching_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function should not be called if the number of
+// elements in the container is 0. The list must be sorted in 'sorting_order'.
+// This function returns the first element that 'key_elem_ptr' doesn't go after
+// (that is, the first element that is not less than the key for ascending
+// order), or NULL if the key goes after all elements. The 'last' element is
+// checked first and then the scan starts from 'sorted_insertion_finger' (or
+// from the first element if there is no finger) in the right direction, so
+// lookups near the last insertion point stop early.
+static struct element *gdlll_find_lower_bound(struct gdll_container *gdllc_ptr,
+                                        struct element *key_elem_ptr,
+                                        compare_elements_function comp_func,
+                                        int sorting_order)
+{
+
+    struct element *temp = NULL;
+
+    if (gdlll_element_goes_after(comp_func(key_elem_ptr, gdllc_ptr->last),
+                                 sorting_order)) {
+        return NULL;
+    }
+
+    temp = gdllc_ptr->sorted_insertion_finger;
+    if (!temp) {
+        temp = gdllc_ptr->first;
+    }
+
+    if (gdlll_element_goes_after(comp_func(key_elem_ptr, temp),
+                                 sorting_order)) {
+        // scan forward
+        temp = temp->next;
+        while ((temp) && (gdlll_element_goes_after(
+                            comp_func(key_elem_ptr, temp), sorting_order))) {
+            temp = temp->next;
+        }
+    } else {
+        // scan backward
+        while ((temp->prev) && (!gdlll_element_goes_after(
+                        comp_func(key_elem_ptr, temp->prev), sorting_order))) {
+            temp = temp->prev;
+        }
+    }
+
+    return temp;
+
+} // end of gdlll_find_lower_bound() function
+
+int gdlll_peek_matching_elements(struct gdll_container *gdllc_ptr,
+                                 void **data_ptrs, long *data_sizes,
+                                 long num_keys,
+                                 compare_elements_function comp_func,
+                                 struct element **matching_elem_ptrs)
+{
+
+    struct element *key_elems = NULL;
+    long *pending_keys = NULL;
+    long num_pending_keys = 0;
+    struct element *temp = NULL;
+    long i = 0;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if ((!data_ptrs) || (!data_sizes) || (!matching_elem_ptrs)) {
+        return GDLLL_DATA_PTR_IS_NULL;
+    }
+
+    if (num_keys <= 0) {
+        return GDLLL_NUM_ELEMENTS_IS_INVALID;
+    }
+
+    if (!comp_func) {
+        return GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL;
+    }
+
+    for (i = 0; i < num_keys; i = i + 1) {
+        if (!data_ptrs[i]) {
+            return GDLLL_DATA_PTR_IS_NULL;
+        }
+        if (data_sizes[i] <= 0) {
+            return GDLLL_DATA_SIZE_IS_INVALID;
+        }
+    }
+
+    key_elems = calloc((size_t)(num_keys), sizeof(*key_elems));
+    pending_keys = calloc((size_t)(num_keys), sizeof(*pending_keys));
+    if ((!key_elems) || (!pending_keys)) {
+        free(key_elems);
+        free(pending_keys);
+        return GDLLL_NO_MEMORY;
+    }
+
+    for (i = 0; i < num_keys; i = i + 1) {
+        key_elems[i].data_ptr = data_ptrs[i];
+        key_elems[i].data_size = data_sizes[i];
+        matching_elem_ptrs[i] = NULL;
+        pending_keys[i] = i;
+    }
+
+    num_pending_keys = num_keys;
+
+    // Traverse the list only once and compare every element with all the keys
+    // that have not been found yet. A key that is found is removed from
+    // 'pending_keys' (by moving the last pending key in its place), and the
+    // traversal stops when all keys have been found.
+    temp = gdllc_ptr->first;
+
+    while ((temp) && (num_pending_keys > 0)) {
+
+        // start loading the next elements while this one is being compared
+        if (temp->next) {
+            GDLLL_PREFETCH(temp->next->data_ptr);
+            GDLLL_PREFETCH(temp->next->next);
+        }
+
+        i = 0;
+        if (GDLLL_IS_TOMBSTONE(temp)) {
+            // skip the tombstone
+            i = num_pending_keys;
+        }
+        while (i < num_pending_keys) {
+            if (comp_func(&(key_elems[pending_keys[i]]), temp) == 0) {
+                matching_elem_ptrs[pending_keys[i]] = temp;
+                num_pending_keys = num_pending_keys - 1;
+                pending_keys[i] = pending_keys[num_pending_keys];
+            } else {
+                i = i + 1;
+            }
+        }
+
+        temp = temp->next;
+
+    }
+
+    free(key_elems);
+    free(pending_keys);
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_peek_matching_elements() function
+
+int gdlll_enable_priority_queue_mode(struct gdll_container *gdllc_ptr,
+                                     compare_elements_function comp_func)
+{
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!comp_func) {
+        return GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL;
+    }
+
+    gdllc_ptr->priority_queue_comp_func = comp_func;
+    gdllc_ptr->priority_queue_enabled = 1;
+
+    // heapify the elements already in the list
+    if (!gdlll_rebuild_heap(gdllc_ptr)) {
+        gdlll_disable_priority_queue_mode(gdllc_ptr);
+        return GDLLL_NO_MEMORY;
+    }
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_enable_priority_queue_mode() function
+
+void gdlll_disable_priority_queue_mode(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp = NULL;
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+        if (temp->extension) {
+            temp->extension->heap_index = -1;
+        }
+    }
+
+    free(gdllc_ptr->heap);
+
+    gdllc_ptr->priority_queue_enabled = 0;
+    gdllc_ptr->heap_is_stale = 0;
+    gdllc_ptr->priority_queue_comp_func = NULL;
+    gdllc_ptr->heap = NULL;
+    gdllc_ptr->heap_size = 0;
+    gdllc_ptr->heap_capacity = 0;
+
+    return;
+
+} // end of gdlll_disable_priority_queue_mode() function
+
+int gdlll_update_element_priority(struct gdll_container *gdllc_ptr,
+                                  struct element *elem_ptr)
+{
+
+    long index = 0;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!elem_ptr) {
+        return GDLLL_ELEMENT_PTR_IS_NULL;
+    }
+
+    // If the heap is stale then it will be rebuilt with the new data anyway.
+    if ((!gdllc_ptr->priority_queue_enabled) || (gdllc_ptr->heap_is_stale) ||
+        (GDLLL_HEAP_INDEX(elem_ptr) < 0)) {
+        return GDLLL_SUCCESS;
+    }
+
+    // The element goes up if it is now smaller than its parent, otherwise it
+    // may have to go down.
+    index = elem_ptr->extension->heap_index;
+
+    gdlll_heap_sift_up(gdllc_ptr, index);
+
+    if (elem_ptr->extension->heap_index == index) {
+        gdlll_heap_sift_down(gdllc_ptr, index);
+    }
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_update_element_priority() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function adds the element to the heap. If the heap is
+// stale then nothing is done (the heap will be rebuilt from the list). If there
+// is no memory to grow the heap (or for the extension of the element) then the
+// heap is marked stale. This can happen only while the heap is rebuilt, as the
+// elements that are added to the container get both before they are linked
+// (see gdlll_make_room_in_indexes()).
+static void gdlll_add_element_to_heap(struct gdll_container *gdllc_ptr,
+                                      struct element *elem_ptr)
+{
+
+    if (elem_ptr->extension) {
+        elem_ptr->extension->heap_index = -1;
+    }
+
+    if ((gdllc_ptr->heap_is_stale) || (GDLLL_IS_TOMBSTONE(elem_ptr))) {
+        return;
+    }
+
+    if (!gdlll_get_element_extension(elem_ptr)) {
+        gdllc_ptr->heap_is_stale = 1;
+        return;
+    }
+
+    if (!gdlll_reserve_heap(gdllc_ptr, gdllc_ptr->heap_size + 1)) {
+        gdllc_ptr->heap_is_stale = 1;
+        return;
+    }
+
+    gdllc_ptr->heap[gdllc_ptr->heap_size] = elem_ptr;
+    gdllc_ptr->heap_size = gdllc_ptr->heap_size + 1;
+
+    gdlll_heap_sift_up(gdllc_ptr, gdllc_ptr->heap_size - 1);
+
+} // end of gdlll_add_element_to_heap() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function grows the heap array (at least to double its
+// size) if it doesn't have room for 'min_capacity' elements. It returns 1 on
+// success and 0 if there is no memory.
+static int gdlll_reserve_heap(struct gdll_container *gdllc_ptr,
+                              long min_capacity)
+{
+
+    long new_capacity = gdllc_ptr->heap_capacity * 2;
+    struct element **new_heap = NULL;
+
+    if (min_capacity <= gdllc_ptr->heap_capacity) {
+        return 1;
+    }
+
+    if (new_capacity < 16) {
+        new_capacity = 16;
+    }
+
+    if (new_capacity < min_capacity) {
+        new_capacity = min_capacity;
+    }
+
+    if (GDLLL_ALLOCATION_MUST_FAIL()) {
+        return 0;
+    }
+
+    new_heap = realloc(gdllc_ptr->heap,
+                       sizeof(*new_heap) * (size_t)(new_capacity));
+    if (!new_heap) {
+        return 0;
+    }
+
+    gdllc_ptr->heap = new_heap;
+    gdllc_ptr->heap_capacity = new_capacity;
+
+    return 1;
+
+} // end of gdlll_reserve_heap() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function removes the element from the heap by moving
+// the last element of the heap in its place.
+static void gdlll_remove_element_from_heap(struct gdll_container *gdllc_ptr,
+                                           struct element *elem_ptr)
+{
+
+    long index = GDLLL_HEAP_INDEX(elem_ptr);
+    struct element *last_elem_ptr = NULL;
+
+    if (index < 0) {
+        return;
+    }
+
+    elem_ptr->extension->heap_index = -1;
+
+    if (gdllc_ptr->heap_is_stale) {
+        return;
+    }
+
+    gdllc_ptr->heap_size = gdllc_ptr->heap_size - 1;
+
+    if (index == gdllc_ptr->heap_size) {
+        return;
+    }
+
+    last_elem_ptr = gdllc_ptr->heap[gdllc_ptr->heap_size];
+    gdllc_ptr->heap[index] = last_elem_ptr;
+    last_elem_ptr->extension->heap_index = index;
+
+    gdlll_heap_sift_up(gdllc_ptr, index);
+
+    if (last_elem_ptr->extension->heap_index == index) {
+        gdlll_heap_sift_down(gdllc_ptr, index);
+    }
+
+} // end of gdlll_remove_element_from_heap() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function moves the element at 'index' up the heap
+// until its parent is not greater than it.
+static void gdlll_heap_sift_up(struct gdll_container *gdllc_ptr, long index)
+{
+
+    struct element **heap = gdllc_ptr->heap;
+    struct element *elem_ptr = heap[index];
+    long parent = 0;
+
+    while (index > 0) {
+        parent = (index - 1) / GDLLL_HEAP_ARITY;
+        if (gdllc_ptr->priority_queue_comp_func(elem_ptr, heap[parent]) >= 0) {
+            break;
+        }
+        heap[index] = heap[parent];
+        heap[index]->extension->heap_index = index;
+        index = parent;
+    }
+
+    heap[index] = elem_ptr;
+    elem_ptr->extension->heap_index = index;
+
+} // end of gdlll_heap_sift_up() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function moves the element at 'index' down the heap
+// until none of its children is smaller than it.
+static void gdlll_heap_sift_down(struct gdll_container *gdllc_ptr, long index)
+{
+
+    struct element **heap = gdllc_ptr->heap;
+    struct element *elem_ptr = heap[index];
+    long child = 0;
+    long last_child = 0;
+    long min_child = 0;
+
+    while (1) {
+
+        child = (index * GDLLL_HEAP_ARITY) + 1;
+        if (child >= gdllc_ptr->heap_size) {
+            break;
+        }
+
+        last_child = child + GDLLL_HEAP_ARITY;
+        if (last_child > gdllc_ptr->heap_size) {
+            last_child = gdllc_ptr->heap_size;
+        }
+
+        min_child = child;
+        for (child = child + 1; child < last_child; child = child + 1) {
+            if (gdllc_ptr->priority_queue_comp_func(heap[child],
+                                                    heap[min_child]) < 0) {
+                min_child = child;
+            }
+        }
+
+        if (gdllc_ptr->priority_queue_comp_func(heap[min_child],
+                                                elem_ptr) >= 0) {
+            break;
+        }
+
+        heap[index] = heap[min_child];
+        heap[index]->extension->heap_index = index;
+        index = min_child;
+
+    }
+
+    heap[index] = elem_ptr;
+    elem_ptr->extension->heap_index = index;
+
+} // end of gdlll_heap_sift_down() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function rebuilds the heap from the elements in the
+// list in O(n) time (by sifting down every node that has children, starting
+// from the last one). It returns 1 on success and 0 if there is no memory (the
+// heap remains stale in this case). Every element in the heap has an extension
+// (see struct gdll_element_extension).
+static int gdlll_rebuild_heap(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp = NULL;
+    long index = 0;
+
+    if (!gdlll_reserve_heap(gdllc_ptr, gdllc_ptr->total_number_of_elements)) {
+        gdllc_ptr->heap_is_stale = 1;
+        return 0;
+    }
+
+    gdllc_ptr->heap_size = 0;
+
+    for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+        if (temp->extension) {
+            temp->extension->heap_index = -1;
+        }
+        if (!GDLLL_IS_TOMBSTONE(temp)) {
+            if (!gdlll_get_element_extension(temp)) {
+                gdllc_ptr->heap_size = 0;
+                gdllc_ptr->heap_is_stale = 1;
+                return 0;
+            }
+            temp->extension->heap_index = gdllc_ptr->heap_size;
+            gdllc_ptr->heap[gdllc_ptr->heap_size] = temp;
+            gdllc_ptr->heap_size = gdllc_ptr->heap_size + 1;
+        }
+    }
+
+    // the last node that has children is the parent of the last node
+    if (gdllc_ptr->heap_size > 1) {
+        for (index = (gdllc_ptr->heap_size - 2) / GDLLL_HEAP_ARITY; index >= 0;
+             index = index - 1) {
+            gdlll_heap_sift_down(gdllc_ptr, index);
+        }
+    }
+
+    gdllc_ptr->heap_is_stale = 0;
+
+    return 1;
+
+} // end of gdlll_rebuild_heap() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function should be called only in priority queue
+// mode. It returns the element with the smallest data (the top of the heap),
+// or NULL if there are no elements in the container. If the heap is stale and
+// can't be rebuilt (no memory) then the list is scanned.
+static struct element *gdlll_find_min_element(
+                                            struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp = NULL;
+    struct element *min_elem_ptr = NULL;
+
+    if (gdllc_ptr->total_number_of_elements == 0) {
+        return NULL;
+    }
+
+    if ((gdllc_ptr->heap_is_stale) && (!gdlll_rebuild_heap(gdllc_ptr))) {
+        for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+            if ((!GDLLL_IS_TOMBSTONE(temp)) && ((!min_elem_ptr) ||
+                (gdllc_ptr->priority_queue_comp_func(temp,
+                                                     min_elem_ptr) < 0))) {
+                min_elem_ptr = temp;
+            }
+        }
+        return min_elem_ptr;
+    }
+
+    return gdllc_ptr->heap[0];
+
+} // end of gdlll_find_min_element() function
+
+int gdlll_enable_order_statistic_index(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (gdllc_ptr->order_statistic_index_enabled) {
+        return GDLLL_SUCCESS;
+    }
+
+    gdllc_ptr->order_statistic_index_enabled = 1;
+
+    if (!gdlll_rebuild_order_statistic_index(gdllc_ptr)) {
+        gdlll_disable_order_statistic_index(gdllc_ptr);
+        return GDLLL_NO_MEMORY;
+    }
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_enable_order_statistic_index() function
+
+void gdlll_disable_order_statistic_index(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    gdlll_free_order_statistic_index(gdllc_ptr);
+
+    gdllc_ptr->order_statistic_index_enabled = 0;
+    gdllc_ptr->order_statistic_index_is_stale = 0;
+
+    return;
+
+} // end of gdlll_disable_order_statistic_index() function
+
+struct element *gdlll_peek_element_at_position(struct gdll_container *gdllc_ptr,
+                                               long position)
+{
+
+    if (!gdllc_ptr) {
+        return NULL;
+    }
+
+    if ((position < 0) ||
+        (position >= gdllc_ptr->total_number_of_elements)) {
+        return NULL;
+    }
+
+    return gdlll_find_element_at_position(gdllc_ptr, position);
+
+} // end of gdlll_peek_element_at_position() function
+
+struct element *gdlll_get_element_at_position(struct gdll_container *gdllc_ptr,
+                                              long position)
+{
+
+    struct element *elem_ptr = NULL;
+
+    elem_ptr = gdlll_peek_element_at_position(gdllc_ptr, position);
+
+    if (elem_ptr == NULL) {
+        return NULL;
+    }
+
+    gdlll_remove_element_from_list(gdllc_ptr, elem_ptr);
+
+    gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements - 1;
+
+    return elem_ptr;
+
+} // end of gdlll_get_element_at_position() function
+
+void gdlll_delete_element_at_position(struct gdll_container *gdllc_ptr,
+                                      long position)
+{
+
+    struct element *elem_ptr = NULL;
+
+    elem_ptr = gdlll_peek_element_at_position(gdllc_ptr, position);
+
+    if (elem_ptr == NULL) {
+        return;
+    }
+
+    gdlll_delete_element_in_list(gdllc_ptr, elem_ptr);
+
+    return;
+
+} // end of gdlll_delete_element_at_position() function
+
+int gdlll_add_element_at_position(struct gdll_container *gdllc_ptr,
+                                  long position, void *data_ptr,
+                                  long data_size)
+{
+
+    struct element *elem_ptr = NULL;
+    struct element *elem_at_position_ptr = NULL;
+    int retval = GDLLL_ERROR_INIT_VALUE;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!data_ptr) {
+        return GDLLL_DATA_PTR_IS_NULL;
+    }
+
+    if (data_size <= 0) {
+        return GDLLL_DATA_SIZE_IS_INVALID;
+    }
+
+    if ((position < 0) ||
+        (position > gdllc_ptr->total_number_of_elements)) {
+        return GDLLL_POSITION_IS_INVALID;
+    }
+
+    if (gdllc_ptr->ring_capacity > 0) {
+        retval = gdlll_make_room_in_ring(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+        // the oldest elements may have been deleted to make room
+        if (position > gdllc_ptr->total_number_of_elements) {
+            position = gdllc_ptr->total_number_of_elements;
+        }
+    }
+
+    if (gdllc_ptr->memory_limit > 0) {
+        retval = gdlll_make_room_under_memory_limit(gdllc_ptr, data_size, 1);
+        if (retval != GDLLL_SUCCESS) {
+            return retval;
+        }
+        // elements may have been evicted to make room
+        if (position > gdllc_ptr->total_number_of_elements) {
+            position = gdllc_ptr->total_number_of_elements;
+        }
+    }
+
+    elem_ptr = gdlll_create_standalone_element(gdllc_ptr, data_ptr, data_size);
+
+    if (!elem_ptr) {
+        return GDLLL_NO_MEMORY;
+    }
+
+    // adding at position 'total_number_of_elements' means adding to the back
+    if (position < gdllc_ptr->total_number_of_elements) {
+        elem_at_position_ptr = gdlll_find_element_at_position(gdllc_ptr,
+                                                              position);
+    }
+
+    gdlll_insert_element_before_element(gdllc_ptr, elem_ptr,
+                                        elem_at_position_ptr);
+
+    gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements + 1;
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_add_element_at_position() function
+
+long gdlll_get_position_of_element(struct gdll_container *gdllc_ptr,
+                                   struct element *elem_ptr)
+{
+
+    struct element *temp = NULL;
+    struct gdll_order_node *node_ptr = NULL;
+    long position = 0;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!elem_ptr) {
+        return GDLLL_ELEMENT_PTR_IS_NULL;
+    }
+
+    if (gdlll_order_statistic_index_is_usable(gdllc_ptr)) {
+
+        node_ptr = GDLLL_ORDER_NODE(elem_ptr);
+
+        // an element of another container may have a node too
+        if ((node_ptr == NULL) || (GDLLL_IS_TOMBSTONE(elem_ptr))) {
+            return GDLLL_MATCHING_ELEMENT_NOT_FOUND;
+        }
+
+        position = GDLLL_ORDER_NODE_SIZE(node_ptr->left);
+
+        while (node_ptr->parent) {
+            if (node_ptr == node_ptr->parent->right) {
+                position = position +
+                           GDLLL_ORDER_NODE_SIZE(node_ptr->parent->left) + 1;
+            }
+            node_ptr = node_ptr->parent;
+        }
+
+        if (node_ptr != gdllc_ptr->order_root) {
+            return GDLLL_MATCHING_ELEMENT_NOT_FOUND;
+        }
+
+        return position;
+
+    }
+
+    // no index (or no memory for it), so count the elements before this one
+    for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+        if (GDLLL_IS_TOMBSTONE(temp)) {
+            continue;
+        }
+        if (temp == elem_ptr) {
+            return position;
+        }
+        position = position + 1;
+    }
+
+    return GDLLL_MATCHING_ELEMENT_NOT_FOUND;
+
+} // end of gdlll_get_position_of_element() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. 'position' must be in the range 0 to
+// (total_number_of_elements - 1). This function returns the element at
+// 'position' using the order statistic index (O(log n)). If there is no index
+// (or no memory to rebuild it) then the list is walked from the nearer end.
+static struct element *gdlll_find_element_at_position(
+                                            struct gdll_container *gdllc_ptr,
+                                            long position)
+{
+
+    struct element *temp = NULL;
+    struct gdll_order_node *node_ptr = NULL;
+    long left_size = 0;
+    long count = 0;
+
+    if (gdlll_order_statistic_index_is_usable(gdllc_ptr)) {
+
+        node_ptr = gdllc_ptr->order_root;
+
+        while (node_ptr) {
+            left_size = GDLLL_ORDER_NODE_SIZE(node_ptr->left);
+            if (position < left_size) {
+                node_ptr = node_ptr->left;
+            } else if (position == left_size) {
+                return node_ptr->elem_ptr;
+            } else {
+                position = position - left_size - 1;
+                node_ptr = node_ptr->right;
+            }
+        }
+
+        return NULL;
+
+    }
+
+    // the tombstones are skipped (they are never the first or last element)
+    if (position < (gdllc_ptr->total_number_of_elements / 2)) {
+        for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+            if (GDLLL_IS_TOMBSTONE(temp)) {
+                continue;
+            }
+            if (count == position) {
+                return temp;
+            }
+            count = count + 1;
+        }
+    } else {
+        position = gdllc_ptr->total_number_of_elements - 1 - position;
+        for (temp = gdllc_ptr->last; temp != NULL; temp = temp->prev) {
+            if (GDLLL_IS_TOMBSTONE(temp)) {
+                continue;
+            }
+            if (count == position) {
+                return temp;
+            }
+            count = count + 1;
+        }
+    }
+
+    return NULL;
+
+} // end of gdlll_find_element_at_position() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function adds a node for the element (that has just
+// been linked in the list) to the order statistic index, just after the node of
+// the nearest element before it that is in the index. The node is in the
+// extension of the element. If the index is stale then nothing is done. If
+// there is no memory for the extension of the element then the index is freed
+// and marked stale (it will be rebuilt by the next positional access).
+static void gdlll_add_element_to_order_statistic_index(
+                                            struct gdll_container *gdllc_ptr,
+                                            struct element *elem_ptr)
+{
+
+    struct gdll_order_node *node_ptr = NULL;
+    struct gdll_order_node *pred_ptr = NULL;
+    struct gdll_order_node *temp = NULL;
+    struct element *prev_elem_ptr = NULL;
+
+    if ((gdllc_ptr->order_statistic_index_is_stale) ||
+        (GDLLL_IS_TOMBSTONE(elem_ptr))) {
+        return;
+    }
+
+    if (!gdlll_get_element_extension(elem_ptr)) {
+        gdlll_free_order_statistic_index(gdllc_ptr);
+        gdllc_ptr->order_statistic_index_is_stale = 1;
+        return;
+    }
+
+    node_ptr = &(elem_ptr->extension->order_node);
+    memset(node_ptr, 0, sizeof(*node_ptr));
+    node_ptr->elem_ptr = elem_ptr;
+    node_ptr->size = 1;
+
+    // xorshift64, the priorities just have to look random
+    gdllc_ptr->order_random_state ^= gdllc_ptr->order_random_state << 13;
+    gdllc_ptr->order_random_state ^= gdllc_ptr->order_random_state >> 7;
+    gdllc_ptr->order_random_state ^= gdllc_ptr->order_random_state << 17;
+    node_ptr->priority = gdllc_ptr->order_random_state;
+
+    // the tombstones are not in the index
+    prev_elem_ptr = elem_ptr->prev;
+    while ((prev_elem_ptr) && (GDLLL_ORDER_NODE(prev_elem_ptr) == NULL)) {
+        prev_elem_ptr = prev_elem_ptr->prev;
+    }
+
+    if (prev_elem_ptr) {
+        pred_ptr = &(prev_elem_ptr->extension->order_node);
+    }
+
+    // The new node goes just after 'pred_ptr' in the in-order sequence: as the
+    // right child of 'pred_ptr' or as the leftmost node of its right subtree.
+    // If there is no 'pred_ptr' then it goes before the leftmost node.
+    if (gdllc_ptr->order_root == NULL) {
+        gdllc_ptr->order_root = node_ptr;
+    } else {
+        if (pred_ptr == NULL) {
+            temp = gdllc_ptr->order_root;
+            while (temp->left) {
+                temp = temp->left;
+            }
+            temp->left = node_ptr;
+        } else if (pred_ptr->right == NULL) {
+            temp = pred_ptr;
+            temp->right = node_ptr;
+        } else {
+            temp = pred_ptr->right;
+            while (temp->left) {
+                temp = temp->left;
+            }
+            temp->left = node_ptr;
+        }
+        node_ptr->parent = temp;
+        while (temp) {
+            temp->size = temp->size + 1;
+            temp = temp->parent;
+        }
+    }
+
+    // restore the heap order of the priorities
+    while ((node_ptr->parent) &&
+           (node_ptr->parent->priority < node_ptr->priority)) {
+        gdlll_order_statistic_rotate_up(gdllc_ptr, node_ptr);
+    }
+
+} // end of gdlll_add_element_to_order_statistic_index() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function removes the node of the element from the
+// order statistic index (if the element is in the index).
+static void gdlll_remove_element_from_order_statistic_index(
+                                            struct gdll_container *gdllc_ptr,
+                                            struct element *elem_ptr)
+{
+
+    struct gdll_order_node *node_ptr = GDLLL_ORDER_NODE(elem_ptr);
+    struct gdll_order_node *child_ptr = NULL;
+    struct gdll_order_node *temp = NULL;
+
+    if (node_ptr == NULL) {
+        return;
+    }
+
+    // rotate the node down until it is a leaf
+    while ((node_ptr->left) || (node_ptr->right)) {
+        if ((node_ptr->right == NULL) ||
+            ((node_ptr->left) &&
+             (node_ptr->left->priority > node_ptr->right->priority))) {
+            child_ptr = node_ptr->left;
+        } else {
+            child_ptr = node_ptr->right;
+        }
+        gdlll_order_statistic_rotate_up(gdllc_ptr, child_ptr);
+    }
+
+    temp = node_ptr->parent;
+
+    if (temp == NULL) {
+        gdllc_ptr->order_root = NULL;
+    } else if (temp->left == node_ptr) {
+        temp->left = NULL;
+    } else {
+        temp->right = NULL;
+    }
+
+    while (temp) {
+        temp->size = temp->size - 1;
+        temp = temp->parent;
+    }
+
+    memset(node_ptr, 0, sizeof(*node_ptr));
+
+} // end of gdlll_remove_element_from_order_statistic_index() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function rotates 'node_ptr' (which must have a
+// parent) above its parent. The in-order sequence doesn't change.
+static void gdlll_order_statistic_rotate_up(struct gdll_container *gdllc_ptr,
+                                            struct gdll_order_node *node_ptr)
+{
+
+    struct gdll_order_node *parent_ptr = node_ptr->parent;
+    struct gdll_order_node *grand_parent_ptr = parent_ptr->parent;
+
+    if (node_ptr == parent_ptr->left) {
+        parent_ptr->left = node_ptr->right;
+        if (node_ptr->right) {
+            node_ptr->right->parent = parent_ptr;
+        }
+        node_ptr->right = parent_ptr;
+    } else {
+        parent_ptr->right = node_ptr->left;
+        if (node_ptr->left) {
+            node_ptr->left->parent = parent_ptr;
+        }
+        node_ptr->left = parent_ptr;
+    }
+
+    parent_ptr->parent = node_ptr;
+    node_ptr->parent = grand_parent_ptr;
+
+    if (grand_parent_ptr == NULL) {
+        gdllc_ptr->order_root = node_ptr;
+    } else if (grand_parent_ptr->left == parent_ptr) {
+        grand_parent_ptr->left = node_ptr;
+    } else {
+        grand_parent_ptr->right = node_ptr;
+    }
+
+    parent_ptr->size = GDLLL_ORDER_NODE_SIZE(parent_ptr->left) +
+                       GDLLL_ORDER_NODE_SIZE(parent_ptr->right) + 1;
+    node_ptr->size = GDLLL_ORDER_NODE_SIZE(node_ptr->left) +
+                     GDLLL_ORDER_NODE_SIZE(node_ptr->right) + 1;
+
+} // end of gdlll_order_statistic_rotate_up() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function rebuilds the order statistic index from the
+// elements in the list. It returns 1 on success and 0 if there is no memory
+// (the index remains stale in this case).
+static int gdlll_rebuild_order_statistic_index(
+                                            struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp = NULL;
+
+    gdlll_free_order_statistic_index(gdllc_ptr);
+    gdllc_ptr->order_statistic_index_is_stale = 0;
+
+    // every element is added after the previous one (O(log n) each)
+    for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+        gdlll_add_element_to_order_statistic_index(gdllc_ptr, temp);
+        if (gdllc_ptr->order_statistic_index_is_stale) {
+            return 0;
+        }
+    }
+
+    return 1;
+
+} // end of gdlll_rebuild_order_statistic_index() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function takes all the elements out of the order
+// statistic index (their nodes are in their extensions, so nothing is freed).
+static void gdlll_free_order_statistic_index(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp = NULL;
+
+    for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+        if (temp->extension) {
+            memset(&(temp->extension->order_node), 0,
+                   sizeof(temp->extension->order_node));
+        }
+    }
+
+    gdllc_ptr->order_root = NULL;
+
+} // end of gdlll_free_order_statistic_index() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. The element has just been moved to a new memory block
+// (see gdlll_relayout_element()) and 'old_node_ptr' is where its node was. If
+// the node has moved with the extension then this function points the parent
+// and the children of the node (or the root of the index) to the new node.
+static void gdlll_move_order_statistic_node(struct gdll_container *gdllc_ptr,
+                                        struct gdll_order_node *old_node_ptr,
+                                        struct element *elem_ptr)
+{
+
+    struct gdll_order_node *node_ptr = &(elem_ptr->extension->order_node);
+
+    node_ptr->elem_ptr = elem_ptr;
+
+    if (node_ptr == old_node_ptr) {
+        return;
+    }
+
+    if (node_ptr->parent == NULL) {
+        gdllc_ptr->order_root = node_ptr;
+    } else if (node_ptr->parent->left == old_node_ptr) {
+        node_ptr->parent->left = node_ptr;
+    } else {
+        node_ptr->parent->right = node_ptr;
+    }
+
+    if (node_ptr->left) {
+        node_ptr->left->parent = node_ptr;
+    }
+
+    if (node_ptr->right) {
+        node_ptr->right->parent = node_ptr;
+    }
+
+} // end of gdlll_move_order_statistic_node() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function returns 1 if the order statistic index is
+// enabled and up to date (it is rebuilt here if it is stale), and 0 otherwise.
+static int gdlll_order_statistic_index_is_usable(
+                                            struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr->order_statistic_index_enabled) {
+        return 0;
+    }
+
+    if (gdllc_ptr->order_statistic_index_is_stale) {
+        return gdlll_rebuild_order_statistic_index(gdllc_ptr);
+    }
+
+    return 1;
+
+} // end of gdlll_order_statistic_index_is_usable() function
+
+int gdlll_replace_data_in_matching_element(struct gdll_container *gdllc_ptr,
+                                         void *old_data_ptr, long old_data_size,
+                                         void *new_data_ptr, long new_data_size,
+                                         compare_elements_function comp_func)
+{
+
+    struct element *matching_elem_ptr = NULL;
+    struct element *new_elem_ptr = NULL;
+    void *temp_data_ptr = NULL;
+    unsigned int payload_flags = 0;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!old_data_ptr) {
+        return GDLLL_DATA_PTR_IS_NULL;
+    }
+
+    if (old_data_size <= 0) {
+        return GDLLL_DATA_SIZE_IS_INVALID;
+    }
+
+    if (!new_data_ptr) {
+        return GDLLL_DATA_PTR_IS_NULL;
+    }
+
+    if (new_data_size <= 0) {
+        return GDLLL_DATA_SIZE_IS_INVALID;
+    }
+
+    if (!comp_func) {
+        return GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL;
+    }
+
+    if (gdllc_ptr->total_number_of_elements == 0) {
+        return GDLLL_CONTAINER_IS_EMPTY;
+    }
+
+    matching_elem_ptr = gdlll_peek_matching_element(gdllc_ptr, old_data_ptr,
+                                                    old_data_size, comp_func);
+
+    if (matching_elem_ptr == NULL) {
+        return GDLLL_MATCHING_ELEMENT_NOT_FOUND;
+    }
+
+    // The data of an element that is in a snapshot must not change, so the
+    // element is replaced by a new element with the new data (copy-on-write).
+    // This is also done with asynchronous deletion, so that the old data is
+    // deleted by the reclaimer thread.
+    if ((gdlll_element_is_in_snapshot(gdllc_ptr, matching_elem_ptr)) ||
+        (gdllc_ptr->async_deleter)) {
+
+        if (gdllc_ptr->ring_capacity > 0) {
+            if (new_data_size > gdllc_ptr->ring_max_data_size) {
+                return GDLLL_DATA_SIZE_IS_INVALID;
+            }
+            if (gdllc_ptr->ring_number_of_free_slots == 0) {
+                return GDLLL_CONTAINER_IS_FULL;
+            }
+        }
+
+        new_elem_ptr = gdlll_create_standalone_element(gdllc_ptr, new_data_ptr,
+                                                       new_data_size);
+        if (!new_elem_ptr) {
+            return GDLLL_NO_MEMORY;
+        }
+
+        gdlll_insert_element_before_element(gdllc_ptr, new_elem_ptr,
+                                            matching_elem_ptr);
+        gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements + 1;
+
+        gdlll_delete_element_in_list(gdllc_ptr, matching_elem_ptr);
+
+        return GDLLL_SUCCESS;
+
+    }
+
+    // Small new data is stored inside the element's memory block (if it has an
+    // inline data area), so no allocation is needed for it (a ring slot has
+    // room for 'ring_max_data_size' bytes).
+    if (((matching_elem_ptr->flags & GDLLL_ELEMENT_HAS_INLINE_DATA_AREA) &&
+         (new_data_size <= GDLLL_INLINE_DATA_SIZE)) ||
+        ((matching_elem_ptr->flags & GDLLL_ELEMENT_IS_IN_RING) &&
+         (new_data_size <= gdllc_ptr->ring_max_data_size))) {
+        temp_data_ptr = GDLLL_ELEMENT_INLINE_DATA_PTR(matching_elem_ptr);
+    } else {
+        temp_data_ptr = gdlll_allocate_payload_block(gdllc_ptr, new_data_size,
+                                                     &payload_flags);
+        if (!temp_data_ptr) {
+            return GDLLL_NO_MEMORY;
+        }
+    }
+
+    // Now, call the call_function_before_deleting_data() for 'data_ptr' of the
+    // matching element and then free the 'data_ptr' of the matching element
+    if (gdllc_ptr->call_function_before_deleting_data) {
+        gdllc_ptr->call_function_before_deleting_data(
+                                                matching_elem_ptr->data_ptr);
+    }
+    gdlll_free_element_data(gdllc_ptr, matching_elem_ptr);
+
+    matching_elem_ptr->data_ptr = temp_data_ptr;
+    matching_elem_ptr->flags = matching_elem_ptr->flags | payload_flags;
+    memmove(matching_elem_ptr->data_ptr, new_data_ptr, (size_t)(new_data_size));
+    gdlll_count_memory(gdllc_ptr,
+                       GDLLL_MEMORY_SIZE_OF_ELEMENT(new_data_size) -
+                       GDLLL_MEMORY_SIZE_OF_ELEMENT(
+                                            matching_elem_ptr->data_size));
+    matching_elem_ptr->data_size = new_data_size;
+
+    // the key of the element may have changed
+    if (gdllc_ptr->integer_key_index_enabled) {
+        gdlll_remove_element_from_integer_key_index(gdllc_ptr,
+                                                    matching_elem_ptr);
+        gdlll_add_element_to_integer_key_index(gdllc_ptr, matching_elem_ptr);
+    }
+    gdlll_update_element_priority(gdllc_ptr, matching_elem_ptr);
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_replace_data_in_matching_element() function
+
+void gdlll_delete_front_element(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp_elem_ptr = NULL;
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    // in priority queue mode, the front element is the smallest element
+    if (gdllc_ptr->priority_queue_enabled) {
+        temp_elem_ptr = gdlll_find_min_element(gdllc_ptr);
+    } else {
+        temp_elem_ptr = gdllc_ptr->first;
+    }
+
+    if (temp_elem_ptr) {
+        gdlll_delete_element_in_list(gdllc_ptr, temp_elem_ptr);
+    }
+
+    return;
+
+} // end of gdlll_delete_front_element() function
+
+void gdlll_delete_last_element(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp_elem_ptr = NULL;
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    temp_elem_ptr = gdllc_ptr->last;
+
+    if (temp_elem_ptr) {
+        gdlll_delete_element_in_list(gdllc_ptr, temp_elem_ptr);
+    }
+
+    return;
+
+} // end of gdlll_delete_last_element() function
+
+void gdlll_delete_matching_element(struct gdll_container *gdllc_ptr,
+                                   void *data_ptr, long data_size,
+                                   compare_elements_function comp_func)
+{
+
+    gdlll_delete_matching_element_using_strategy(gdllc_ptr, data_ptr, data_size,
+                                                 comp_func,
+                                                 GDLLL_SEARCH_FORWARD);
+
+    return;
+
+} // end of gdlll_delete_matching_element() function
+
+void gdlll_delete_matching_element_using_strategy(
+                                        struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        int search_strategy)
+{
+
+    struct element *matching_elem_ptr = NULL;
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    if (!data_ptr) {
+        return;
+    }
+
+    if (data_size <= 0) {
+        return;
+    }
+
+    if (!comp_func) {
+        return;
+    }
+
+    if (gdllc_ptr->total_number_of_elements == 0) {
+        return;
+    }
+
+    matching_elem_ptr = gdlll_peek_matching_element_using_strategy(gdllc_ptr,
+                                                data_ptr, data_size, comp_func,
+                                                search_strategy);
+
+    if (matching_elem_ptr == NULL) {
+        return;
+    }
+
+    gdlll_delete_element_in_list(gdllc_ptr, matching_elem_ptr);
+
+    return;
+
+} // end of gdlll_delete_matching_element_using_strategy() function
+
+long gdlll_count_matching_elements(struct gdll_container *gdllc_ptr,
+                                   void *data_ptr, long data_size,
+                                   compare_elements_function comp_func)
+{
+
+    struct element key_elem = {0};
+    struct element *temp = NULL;
+    long count = 0;
+
+    if (!gdllc_ptr) {
+        return 0;
+    }
+
+    if (!data_ptr) {
+        return 0;
+    }
+
+    if (data_size <= 0) {
+        return 0;
+    }
+
+    if (!comp_func) {
+        return 0;
+    }
+
+    key_elem.data_ptr = data_ptr;
+    key_elem.data_size = data_size;
+
+    for (temp = gdllc_ptr->first; temp != NULL; temp = temp->next) {
+        if ((!GDLLL_IS_TOMBSTONE(temp)) && (comp_func(&key_elem, temp) == 0)) {
+            count = count + 1;
+        }
+    }
+
+    return count;
+
+} // end of gdlll_count_matching_elements() function
+
+long gdlll_peek_equal_range(struct gdll_container *gdllc_ptr,
+                            void *data_ptr, long data_size,
+                            compare_elements_function comp_func,
+                            int search_strategy,
+                            struct element **range_first_ptr,
+                            struct element **range_last_ptr)
+{
+
+    struct element key_elem = {0};
+    struct element *temp = NULL;
+    long count = 0;
+
+    if ((!range_first_ptr) || (!range_last_ptr)) {
+        return 0;
+    }
+
+    *range_first_ptr = NULL;
+    *range_last_ptr = NULL;
+
+    if ((search_strategy != GDLLL_SEARCH_SORTED_ASCENDING) &&
+        (search_strategy != GDLLL_SEARCH_SORTED_DESCENDING)) {
+        return 0;
+    }
+
+    // this also checks the rest of the arguments
+    temp = gdlll_peek_matching_element_using_strategy(gdllc_ptr, data_ptr,
+                                                      data_size, comp_func,
+                                                      search_strategy);
+
+    if (temp == NULL) {
+        return 0;
+    }
+
+    key_elem.data_ptr = data_ptr;
+    key_elem.data_size = data_size;
+
+    // the matching elements are adjacent in a sorted list
+    *range_first_ptr = temp;
+    while ((temp) && (comp_func(&key_elem, temp) == 0)) {
+        if (!GDLLL_IS_TOMBSTONE(temp)) {
+            *range_last_ptr = temp;
+            count = count + 1;
+        }
+        temp = temp->next;
+    }
+
+    return count;
+
+} // end of gdlll_peek_equal_range() function
+
+struct element *gdlll_peek_lower_bound_element(struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        int search_strategy)
+{
+
+    struct element key_elem = {0};
+
+    if ((!gdllc_ptr) || (!data_ptr) || (data_size <= 0) || (!comp_func)) {
+        return NULL;
+    }
+
+    if ((search_strategy != GDLLL_SEARCH_SORTED_ASCENDING) &&
+        (search_strategy != GDLLL_SEARCH_SORTED_DESCENDING)) {
+        return NULL;
+    }
+
+    if (gdllc_ptr->total_number_of_elements == 0) {
+        return NULL;
+    }
+
+    key_elem.data_ptr = data_ptr;
+    key_elem.data_size = data_size;
+
+    return gdlll_find_bound(gdllc_ptr, &key_elem, comp_func,
+                    (search_strategy == GDLLL_SEARCH_SORTED_ASCENDING) ?
+                    GDLLL_ASCENDING_ORDER : GDLLL_DESCENDING_ORDER, 0);
+
+} // end of gdlll_peek_lower_bound_element() function
+
+struct element *gdlll_peek_upper_bound_element(struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        int search_strategy)
+{
+
+    struct element key_elem = {0};
+
+    if ((!gdllc_ptr) || (!data_ptr) || (data_size <= 0) || (!comp_func)) {
+        return NULL;
+    }
+
+    if ((search_strategy != GDLLL_SEARCH_SORTED_ASCENDING) &&
+        (search_strategy != GDLLL_SEARCH_SORTED_DESCENDING)) {
+        return NULL;
+    }
+
+    if (gdllc_ptr->total_number_of_elements == 0) {
+        return NULL;
+    }
+
+    key_elem.data_ptr = data_ptr;
+    key_elem.data_size = data_size;
+
+    return gdlll_find_bound(gdllc_ptr, &key_elem, comp_func,
+                    (search_strategy == GDLLL_SEARCH_SORTED_ASCENDING) ?
+                    GDLLL_ASCENDING_ORDER : GDLLL_DESCENDING_ORDER, 1);
+
+} // end of gdlll_peek_upper_bound_element() function
+
+long gdlll_peek_range(struct gdll_container *gdllc_ptr,
+                      void *from_data_ptr, long from_data_size,
+                      void *to_data_ptr, long to_data_size,
+                      compare_elements_function comp_func,
+                      int search_strategy,
+                      struct element **range_first_ptr,
+                      struct element **range_last_ptr)
+{
+
+    return gdlll_peek_range_and_memory_size(gdllc_ptr, from_data_ptr,
+                                            from_data_size, to_data_ptr,
+                                            to_data_size, comp_func,
+                                            search_strategy, range_first_ptr,
+                                            range_last_ptr, NULL);
+
+} // end of gdlll_peek_range() function
+
+// This function is used by gdlll_peek_range() and gdlll_get_range(). It is
+// same as gdlll_peek_range() except that it also stores the memory (as counted
+// in 'memory_in_use') of the elements of the range in '*memory_size_ptr' if
+// 'memory_size_ptr' is not NULL (see gdlll_find_range()).
+static long gdlll_peek_range_and_memory_size(struct gdll_container *gdllc_ptr,
+                                    void *from_data_ptr, long from_data_size,
+                                    void *to_data_ptr, long to_data_size,
+                                    compare_elements_function comp_func,
+                                    int search_strategy,
+                                    struct element **range_first_ptr,
+                                    struct element **range_last_ptr,
+                                    long *memory_size_ptr)
+{
+
+    struct element from_key_elem = {0};
+    struct element to_key_elem = {0};
+
+    if ((!range_first_ptr) || (!range_last_ptr)) {
+        return 0;
+    }
+
+    *range_first_ptr = NULL;
+    *range_last_ptr = NULL;
+
+    if ((!gdllc_ptr) || (!comp_func)) {
+        return 0;
+    }
+
+    if ((!from_data_ptr) || (from_data_size <= 0) ||
+        (!to_data_ptr) || (to_data_size <= 0)) {
+        return 0;
+    }
+
+    if ((search_strategy != GDLLL_SEARCH_SORTED_ASCENDING) &&
+        (search_strategy != GDLLL_SEARCH_SORTED_DESCENDING)) {
+        return 0;
+    }
+
+    if (gdllc_ptr->total_number_of_elements == 0) {
+        return 0;
+    }
+
+    from_key_elem.data_ptr = from_data_ptr;
+    from_key_elem.data_size = from_data_size;
+    to_key_elem.data_ptr = to_data_ptr;
+    to_key_elem.data_size = to_data_size;
+
+    return gdlll_find_range(gdllc_ptr, &from_key_elem, &to_key_elem,
+                    comp_func,
+                    (search_strategy == GDLLL_SEARCH_SORTED_ASCENDING) ?
+                    GDLLL_ASCENDING_ORDER : GDLLL_DESCENDING_ORDER,
+                    range_first_ptr, range_last_ptr, memory_size_ptr);
+
+} // end of gdlll_peek_range_and_memory_size() function
+
+long gdlll_get_range(struct gdll_container *gdllc_ptr,
+                     void *from_data_ptr, long from_data_size,
+                     void *to_data_ptr, long to_data_size,
+                     compare_elements_function comp_func,
+                     int search_strategy,
+                     struct gdll_container *dest_gdllc_ptr)
+{
+
+    struct element *range_first = NULL;
+    struct element *range_last = NULL;
+    struct element *before = NULL;
+    struct element *after = NULL;
+    struct element *temp = NULL;
+    struct element *next = NULL;
+    long count = 0;
+    long range_memory_size = 0;
+
+    if ((!dest_gdllc_ptr) || (gdllc_ptr == dest_gdllc_ptr)) {
+        return 0;
+    }
+
+    if ((gdllc_ptr) &&
+        ((gdlll_container_owns_element_memory(gdllc_ptr)) ||
+         (gdlll_container_owns_element_memory(dest_gdllc_ptr)))) {
+        return 0;
+    }
+
+    // the snapshots that have been released don't matter
+    if ((gdllc_ptr) && (gdllc_ptr->snapshots)) {
+        gdlll_reclaim_snapshots(gdllc_ptr);
+    }
+
+    // the elements that a snapshot has must stay in this container
+    if ((gdllc_ptr) && (gdllc_ptr->snapshots)) {
+        return 0;
+    }
+
+    // this also checks the rest of the arguments
+    count = gdlll_peek_range_and_memory_size(gdllc_ptr, from_data_ptr,
+                                             from_data_size, to_data_ptr,
+                                             to_data_size, comp_func,
+                                             search_strategy, &range_first,
+                                             &range_last, &range_memory_size);
+
+    if (count == 0) {
+        return 0;
+    }
+
+    if ((gdlll_has_no_per_element_state(gdllc_ptr)) &&
+        (gdlll_has_no_per_element_state(dest_gdllc_ptr))) {
+
+        // The elements of the range are adjacent and no index has to be told
+        // about them, so the whole range is relinked at once.
+        before = range_first->prev;
+        after = range_last->next;
+
+        gdllc_ptr->sorted_insertion_finger = (after) ? after : before;
+
+        // the next element of a relayout in progress may be in the range
+        if (gdllc_ptr->relayout_next_element) {
+            gdllc_ptr->relayout_next_element = after;
+        }
+
+        // only the cursors that are on the elements of the range are moved
+        if (gdllc_ptr->continuations) {
+            for (temp = range_first; temp != after; temp = temp->next) {
+                gdlll_replace_element_in_continuations(gdllc_ptr, temp, after);
+            }
+        }
+
+        if (before) {
+            before->next = after;
+        } else {
+            gdllc_ptr->first = after;
+        }
+        if (after) {
+            after->prev = before;
+        } else {
+            gdllc_ptr->last = before;
+        }
+
+        range_first->prev = dest_gdllc_ptr->last;
+        range_last->next = NULL;
+        if (dest_gdllc_ptr->last) {
+            dest_gdllc_ptr->last->next = range_first;
+        } else {
+            dest_gdllc_ptr->first = range_first;
+        }
+        dest_gdllc_ptr->last = range_last;
+
+        // the memory of the range (added up while the range was being found)
+        // moves to the destination container
+        gdllc_ptr->memory_in_use = gdllc_ptr->memory_in_use - range_memory_size;
+        dest_gdllc_ptr->memory_in_use =
+                            dest_gdllc_ptr->memory_in_use + range_memory_size;
+
+    } else {
+
+        // All that the indexes of the destination container need is allocated
+        // first, so either the whole range is moved or nothing is.
+        for (temp = range_first; temp != range_last->next; temp = temp->next) {
+            if (gdlll_make_room_in_indexes(dest_gdllc_ptr, temp, count) !=
+                                                            GDLLL_SUCCESS) {
+                return 0;
+            }
+        }
+
+        // Removing an element may move the tombstones next to it out of the
+        // list, so 'next' is the next element that is not a tombstone.
+        temp = range_first;
+        while (1) {
+            next = gdlll_peek_next_element(gdllc_ptr, temp);
+            gdlll_remove_element_from_list(gdllc_ptr, temp);
+            gdlll_insert_element_before_element(dest_gdllc_ptr, temp, NULL);
+            if (temp == range_last) {
+                break;
+            }
+            temp = next;
+        }
+
+    }
+
+    gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements - count;
+    dest_gdllc_ptr->total_number_of_elements =
+                            dest_gdllc_ptr->total_number_of_elements + count;
+
+    return count;
+
+} // end of gdlll_get_range() function
+
+long gdlll_delete_range(struct gdll_container *gdllc_ptr,
+                        void *from_data_ptr, long from_data_size,
+                        void *to_data_ptr, long to_data_size,
+                        compare_elements_function comp_func,
+                        int search_strategy)
+{
+
+    struct element *range_first = NULL;
+    struct element *range_last = NULL;
+    struct element *temp = NULL;
+    struct element *next = NULL;
+    long count = 0;
+
+    // this also checks the arguments
+    count = gdlll_peek_range(gdllc_ptr, from_data_ptr, from_data_size,
+                             to_data_ptr, to_data_size, comp_func,
+                             search_strategy, &range_first, &range_last);
+
+    if (count == 0) {
+        return 0;
+    }
+
+    temp = range_first;
+    while (1) {
+        next = gdlll_peek_next_element(gdllc_ptr, temp);
+        gdlll_delete_element_in_list(gdllc_ptr, temp);
+        if (temp == range_last) {
+            break;
+        }
+        temp = next;
+    }
+
+    return count;
+
+} // end of gdlll_delete_range() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function should not be called if the number of
+// elements in the container is 0. The list must be sorted in 'sorting_order'.
+// If 'upper_bound' is 0 then this function returns the first element that
+// 'key_elem_ptr' doesn't go after, otherwise it returns the first element that
+// 'key_elem_ptr' goes before. NULL is returned if there is no such element.
+// The tombstones are never returned. If the order statistic index is enabled
+// then it is searched (O(log n)), otherwise the list is scanned (see
+// gdlll_find_lower_bound()).
+static struct element *gdlll_find_bound(struct gdll_container *gdllc_ptr,
+                                        struct element *key_elem_ptr,
+                                        compare_elements_function comp_func,
+                                        int sorting_order, int upper_bound)
+{
+
+    struct gdll_order_node *node_ptr = NULL;
+    struct element *temp = NULL;
+    int comp_result = 0;
+
+    if (gdlll_order_statistic_index_is_usable(gdllc_ptr)) {
+
+        // the nodes are in list order, so this is a binary search
+        node_ptr = gdllc_ptr->order_root;
+        while (node_ptr) {
+            comp_result = comp_func(key_elem_ptr, node_ptr->elem_ptr);
+            if ((gdlll_element_goes_after(comp_result, sorting_order)) ||
+                ((upper_bound) && (comp_result == 0))) {
+                node_ptr = node_ptr->right;
+            } else {
+                temp = node_ptr->elem_ptr;
+                node_ptr = node_ptr->left;
+            }
+        }
+
+        return temp;
+
+    }
+
+    temp = gdlll_find_lower_bound(gdllc_ptr, key_elem_ptr, comp_func,
+                                  sorting_order);
+
+    while ((temp) && ((GDLLL_IS_TOMBSTONE(temp)) ||
+                      ((upper_bound) &&
+                       (comp_func(key_elem_ptr, temp) == 0)))) {
+        temp = temp->next;
+    }
+
+    return temp;
+
+} // end of gdlll_find_bound() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function should not be called if the number of
+// elements in the container is 0. The list must be sorted in 'sorting_order'.
+// This function finds the elements from the lower bound of 'from_key_elem_ptr'
+// to the last element that 'to_key_elem_ptr' doesn't go before, stores the
+// first and the last of them in '*range_first_ptr' and '*range_last_ptr', and
+// returns their number (tombstones are not counted). The scan stops as soon as
+// it passes 'to_key_elem_ptr'. If 'memory_size_ptr' is not NULL then the
+// memory of the elements that have been scanned is stored in
+// '*memory_size_ptr'. With the order statistic index, the elements are not
+// scanned at all (the number comes from their positions and '*memory_size_ptr'
+// is 0).
+static long gdlll_find_range(struct gdll_container *gdllc_ptr,
+                             struct element *from_key_elem_ptr,
+                             struct element *to_key_elem_ptr,
+                             compare_elements_function comp_func,
+                             int sorting_order,
+                             struct element **range_first_ptr,
+                             struct element **range_last_ptr,
+                             long *memory_size_ptr)
+{
+
+    struct element *first_elem_ptr = NULL;
+    struct element *end_elem_ptr = NULL;
+    struct element *temp = NULL;
+    long first_position = 0;
+    long end_position = 0;
+    long count = 0;
+    int comp_result = 0;
+
+    *range_first_ptr = NULL;
+    *range_last_ptr = NULL;
+
+    if (memory_size_ptr) {
+        *memory_size_ptr = 0;
+    }
+
+    first_elem_ptr = gdlll_find_bound(gdllc_ptr, from_key_elem_ptr, comp_func,
+                                      sorting_order, 0);
+
+    if (first_elem_ptr == NULL) {
+        return 0;
+    }
+
+    if (gdlll_order_statistic_index_is_usable(gdllc_ptr)) {
+
+        end_elem_ptr = gdlll_find_bound(gdllc_ptr, to_key_elem_ptr, comp_func,
+                                        sorting_order, 1);
+
+        first_position = gdlll_get_position_of_element(gdllc_ptr,
+                                                       first_elem_ptr);
+        end_position = gdllc_ptr->total_number_of_elements;
+        if (end_elem_ptr) {
+            end_position = gdlll_get_position_of_element(gdllc_ptr,
+                                                         end_elem_ptr);
+        }
+
+        if (end_position <= first_position) {
+            return 0;
+        }
+
+        *range_first_ptr = first_elem_ptr;
+        if (end_elem_ptr) {
+            *range_last_ptr = gdlll_peek_prev_element(gdllc_ptr, end_elem_ptr);
+        } else {
+            *range_last_ptr = gdllc_ptr->last;
+        }
+
+        return end_position - first_position;
+
+    }
+
+    for (temp = first_elem_ptr; temp != NULL; temp = temp->next) {
+        if (GDLLL_IS_TOMBSTONE(temp)) {
+            continue;
+        }
+        comp_result = comp_func(to_key_elem_ptr, temp);
+        if ((comp_result != 0) &&
+            (!gdlll_element_goes_after(comp_result, sorting_order))) {
+            // passed 'to_key_elem_ptr'
+            break;
+        }
+        if (count == 0) {
+            *range_first_ptr = temp;
+        }
+        *range_last_ptr = temp;
+        count = count + 1;
+        if (memory_size_ptr) {
+            *memory_size_ptr = *memory_size_ptr +
+                                GDLLL_MEMORY_SIZE_OF_ELEMENT(temp->data_size);
+        }
+    }
+
+    return count;
+
+} // end of gdlll_find_range() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function returns 1 if nothing but the list itself
+// knows about the elements of the container (no index, no tombstones, no
+// epoch readers and no snapshot versions, see
+// gdlll_remove_element_from_list()), so that a run of elements can be
+// relinked at once.
+static int gdlll_has_no_per_element_state(struct gdll_container *gdllc_ptr)
+{
+
+    if ((gdllc_ptr->integer_key_index_enabled) ||
+        (gdllc_ptr->priority_queue_enabled) ||
+        (gdllc_ptr->order_statistic_index_enabled) ||
+        (gdllc_ptr->epoch_reclamation_enabled) ||
+        (gdllc_ptr->number_of_tombstones != 0) ||
+        (gdllc_ptr->snapshot_version != 0)) {
+        return 0;
+    }
+
+    return 1;
+
+} // end of gdlll_has_no_per_element_state() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function returns 1 if the memory of the elements of
+// the container belongs to the container (the elements are freed with it), so
+// that its elements can't be moved to another container and elements of
+// another container can't be moved to it.
+static int gdlll_container_owns_element_memory(
+                                        struct gdll_container *gdllc_ptr)
+{
+
+    // the arena of a disabled arena mode is freed when its last block is freed
+    if ((gdllc_ptr->arena_mode_enabled) || (gdllc_ptr->arena_regions)) {
+        return 1;
+    }
+
+    // the same goes for the slots of a disabled ring
+    if ((gdllc_ptr->ring_capacity > 0) || (gdllc_ptr->ring_disabled_slots)) {
+        return 1;
+    }
+
+    return 0;
+
+} // end of gdlll_container_owns_element_memory() function
+
+long gdlll_get_all_matching_elements(struct gdll_container *gdllc_ptr,
+                                     void *data_ptr, long data_size,
+                                     compare_elements_function comp_func,
+                                     struct gdll_container *dest_gdllc_ptr)
+{
+
+    struct element key_elem = {0};
+    struct element *temp = NULL;
+    struct element *next = NULL;
+    long count = 0;
+
+    if ((!gdllc_ptr) || (!dest_gdllc_ptr)) {
+        return 0;
+    }
+
+    if (gdllc_ptr == dest_gdllc_ptr) {
+        return 0;
+    }
+
+    if ((gdlll_container_owns_element_memory(gdllc_ptr)) ||
+        (gdlll_container_owns_element_memory(dest_gdllc_ptr))) {
+        return 0;
+    }
+
+    // the snapshots that have been released don't matter
+    if (gdllc_ptr->snapshots) {
+        gdlll_reclaim_snapshots(gdllc_ptr);
+    }
+
+    // the elements that a snapshot has must stay in this container
+    if (gdllc_ptr->snapshots) {
+        return 0;
+    }
+
+    if (!data_ptr) {
+        return 0;
+    }
+
+    if (data_size <= 0) {
+        return 0;
+    }
+
+    if (!comp_func) {
+        return 0;
+    }
+
+    key_elem.data_ptr = data_ptr;
+    key_elem.data_size = data_size;
+
+    temp = gdllc_ptr->first;
+
+    // Removing an element may move the tombstones next to it out of the list,
+    // so 'next' is the next element that is not a tombstone.
+    while (temp) {
+        next = gdlll_peek_next_element(gdllc_ptr, temp);
+        if ((!GDLLL_IS_TOMBSTONE(temp)) && (comp_func(&key_elem, temp) == 0)) {
+            if (gdlll_make_room_in_indexes(dest_gdllc_ptr, temp, 1) !=
+                                                            GDLLL_SUCCESS) {
+                break;
+            }
+            // move the element to the back of the destination container
+            gdlll_remove_element_from_list(gdllc_ptr, temp);
+            gdllc_ptr->total_number_of_elements =
+                                    gdllc_ptr->total_number_of_elements - 1;
+            gdlll_insert_element_before_element(dest_gdllc_ptr, temp, NULL);
+            dest_gdllc_ptr->total_number_of_elements =
+                                dest_gdllc_ptr->total_number_of_elements + 1;
+            count = count + 1;
+        }
+        temp = next;
+    }
+
+    return count;
+
+} // end of gdlll_get_all_matching_elements() function
+
+long gdlll_delete_all_matching_elements(struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func)
+{
+
+    struct element key_elem = {0};
+    struct element *temp = NULL;
+    struct element *next = NULL;
+    long count = 0;
+
+    if (!gdllc_ptr) {
+        return 0;
+    }
+
+    if (!data_ptr) {
+        return 0;
+    }
+
+    if (data_size <= 0) {
+        return 0;
+    }
+
+    if (!comp_func) {
+        return 0;
+    }
+
+    key_elem.data_ptr = data_ptr;
+    key_elem.data_size = data_size;
+
+    temp = gdllc_ptr->first;
+
+    // Deleting an element may move the tombstones next to it out of the list
+    // (or purge them), so 'next' is the next element that is not a tombstone.
+    while (temp) {
+        next = gdlll_peek_next_element(gdllc_ptr, temp);
+        if ((!GDLLL_IS_TOMBSTONE(temp)) && (comp_func(&key_elem, temp) == 0)) {
+            gdlll_delete_element_in_list(gdllc_ptr, temp);
+            count = count + 1;
+        }
+        temp = next;
+    }
+
+    return count;
+
+} // end of gdlll_delete_all_matching_elements() function
+
+void gdlll_delete_standalone_element(struct gdll_container *gdllc_ptr,
+                                     struct element *element_to_delete)
+{
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    if (!element_to_delete) {
+        return;
+    }
+
+    // If lazy deletion is enabled then the element is freed later, with the
+    // other tombstones.
+    if (gdllc_ptr->lazy_deletion_enabled) {
+        element_to_delete->flags =
+                        element_to_delete->flags | GDLLL_ELEMENT_IS_TOMBSTONE;
+        element_to_delete->next = gdllc_ptr->tombstone_list;
+        gdllc_ptr->tombstone_list = element_to_delete;
+        gdllc_ptr->number_of_tombstones = gdllc_ptr->number_of_tombstones + 1;
+        gdlll_purge_tombstones_if_needed(gdllc_ptr);
+        return;
+    }
+
+    // Call the call_function_before_deleting_data() for 'data_ptr' of
+    // 'element_to_delete' and then free the 'data_ptr' of 'element_to_delete'.
+    // Then free the 'element_to_delete'.
+    gdlll_destroy_element(gdllc_ptr, element_to_delete);
+
+    return;
+
+} // end of gdlll_delete_standalone_element() function
+
+void gdlll_delete_all_elements_in_gdll_container(
+                                            struct gdll_container *gdllc_ptr)
+{
+
+    struct element *temp_elem_ptr = NULL;
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    if (gdllc_ptr->total_number_of_elements == 0) {
+        return;
+    }
+
+    // Nothing else knows about the elements, so they can be freed without
+    // unlinking them one by one.
+    if ((gdllc_ptr->arena_mode_enabled) &&
+        (gdlll_has_no_per_element_state(gdllc_ptr)) &&
+        (!gdllc_ptr->snapshots) && (!gdllc_ptr->async_deleter)) {
+        gdlll_arena_delete_all_elements(gdllc_ptr);
+        return;
+    }
+
+    temp_elem_ptr = gdllc_ptr->first;
+
+    while (temp_elem_ptr) {
+        gdlll_delete_front_element(gdllc_ptr);
+        temp_elem_ptr = gdllc_ptr->first;
+    }
+
+    gdlll_purge_tombstones(gdllc_ptr);
+
+    return;
+
+} // end of gdlll_delete_all_elements_in_gdll_container() function
+
+void gdlll_init_continuation(struct gdll_continuation *cont_ptr)
+{
+
+    if (!cont_ptr) {
+        return;
+    }
+
+    memset(cont_ptr, 0, sizeof(*cont_ptr));
+
+    return;
+
+} // end of gdlll_init_continuation() function
+
+void gdlll_cancel_continuation(struct gdll_continuation *cont_ptr)
+{
+
+    if (!cont_ptr) {
+        return;
+    }
+
+    if (cont_ptr->operation == GDLLL_CONTINUATION_IS_UNUSED) {
+        return;
+    }
+
+    gdlll_free_pending_elements(cont_ptr->gdllc_ptr, cont_ptr);
+
+    gdlll_end_continuation(cont_ptr);
+
+    return;
+
+} // end of gdlll_cancel_continuation() function
+
+int gdlll_peek_matching_element_incrementally(
+                                    struct gdll_container *gdllc_ptr,
+                                    struct gdll_continuation *cont_ptr,
+                                    void *data_ptr, long data_size,
+                                    compare_elements_function comp_func,
+                                    long max_elements, long max_microseconds,
+                                    struct element **matching_elem_ptr_ptr)
+{
+
+    struct element key_elem = {0};
+    struct element *temp = NULL;
+    long num_processed = 0;
+    long start_time = 0;
+    int retval = GDLLL_ERROR_INIT_VALUE;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!data_ptr) {
+        return GDLLL_DATA_PTR_IS_NULL;
+    }
+
+    if (data_size <= 0) {
+        return GDLLL_DATA_SIZE_IS_INVALID;
+    }
+
+    if (!comp_func) {
+        return GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL;
+    }
+
+    if (!matching_elem_ptr_ptr) {
+        return GDLLL_ELEMENT_PTR_IS_NULL;
+    }
+
+    if ((max_elements < 0) || (max_microseconds < 0)) {
+        return GDLLL_NUM_ELEMENTS_IS_INVALID;
+    }
+
+    *matching_elem_ptr_ptr = NULL;
+
+    retval = gdlll_resume_continuation(gdllc_ptr, cont_ptr,
+                                       GDLLL_CONTINUATION_OF_SCAN);
+    if (retval != GDLLL_SUCCESS) {
+        return retval;
+    }
+
+    if (cont_ptr->phase == GDLLL_PHASE_STARTING) {
+        cont_ptr->cursors[0] = gdllc_ptr->first;
+        cont_ptr->phase = GDLLL_PHASE_SCANNING;
+    }
+
+    if (max_microseconds > 0) {
+        start_time = gdlll_get_time_in_microseconds();
+    }
+
+    key_elem.data_ptr = data_ptr;
+    key_elem.data_size = data_size;
+
+    while (cont_ptr->cursors[0]) {
+
+        if (gdlll_budget_is_used_up(num_processed, max_elements,
+                                    max_microseconds, start_time)) {
+            return GDLLL_OPERATION_IS_NOT_COMPLETE;
+        }
+
+        temp = cont_ptr->cursors[0];
+        cont_ptr->cursors[0] = temp->next;
+        num_processed = num_processed + 1;
+
+        if ((!GDLLL_IS_TOMBSTONE(temp)) &&
+            (comp_func(&key_elem, temp) == 0)) {
+            *matching_elem_ptr_ptr = temp;
+            break;
+        }
+
+    } // end of while loop
+
+    gdlll_end_continuation(cont_ptr);
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_peek_matching_element_incrementally() function
+
+int gdlll_delete_all_elements_incrementally(struct gdll_container *gdllc_ptr,
+                                            struct gdll_continuation *cont_ptr,
+                                            long max_elements,
+                                            long max_microseconds)
+{
+
+    struct element *temp = NULL;
+    long num_processed = 0;
+    long start_time = 0;
+    int retval = GDLLL_ERROR_INIT_VALUE;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if ((max_elements < 0) || (max_microseconds < 0)) {
+        return GDLLL_NUM_ELEMENTS_IS_INVALID;
+    }
+
+    retval = gdlll_resume_continuation(gdllc_ptr, cont_ptr,
+                                       GDLLL_CONTINUATION_OF_DELETE_ALL);
+    if (retval != GDLLL_SUCCESS) {
+        return retval;
+    }
+
+    if (cont_ptr->phase == GDLLL_PHASE_STARTING) {
+        // Nothing else knows about the elements, so the whole list can be
+        // removed at once and freed later.
+        if ((gdlll_has_no_per_element_state(gdllc_ptr)) &&
+            (!gdllc_ptr->snapshots) && (!gdllc_ptr->async_deleter) &&
+            (gdllc_ptr->ring_capacity == 0)) {
+            cont_ptr->pending_elements = gdllc_ptr->first;
+            GDLLL_STORE_RELEASE(gdllc_ptr->first, NULL);
+            gdllc_ptr->last = NULL;
+            gdllc_ptr->sorted_insertion_finger = NULL;
+            gdllc_ptr->relayout_next_element = NULL;
+            gdllc_ptr->total_number_of_elements = 0;
+            gdlll_move_continuations(gdllc_ptr, NULL);
+            gdlll_count_memory(gdllc_ptr, -(gdllc_ptr->memory_in_use));
+            cont_ptr->phase = GDLLL_PHASE_FREEING_REMOVED_ELEMENTS;
+        } else {
+            cont_ptr->phase = GDLLL_PHASE_DELETING_FRONT_ELEMENTS;
+        }
+    }
+
+    if (max_microseconds > 0) {
+        start_time = gdlll_get_time_in_microseconds();
+    }
+
+    if (cont_ptr->phase == GDLLL_PHASE_FREEING_REMOVED_ELEMENTS) {
+
+        while (cont_ptr->pending_elements) {
+            if (gdlll_budget_is_used_up(num_processed, max_elements,
+                                        max_microseconds, start_time)) {
+                return GDLLL_OPERATION_IS_NOT_COMPLETE;
+            }
+            temp = cont_ptr->pending_elements;
+            cont_ptr->pending_elements = temp->next;
+            if (gdllc_ptr->call_function_before_deleting_data) {
+                gdllc_ptr->call_function_before_deleting_data(temp->data_ptr);
+            }
+            gdlll_release_element_memory(gdllc_ptr, temp);
+            num_processed = num_processed + 1;
+        }
+
+        if ((gdllc_ptr->arena_mode_enabled) &&
+            (gdllc_ptr->arena_number_of_blocks_in_use == 0)) {
+            gdlll_arena_reset(gdllc_ptr);
+        }
+
+    } else {
+
+        while (gdllc_ptr->first) {
+            if (gdlll_budget_is_used_up(num_processed, max_elements,
+                                        max_microseconds, start_time)) {
+                return GDLLL_OPERATION_IS_NOT_COMPLETE;
+            }
+            gdlll_delete_front_element(gdllc_ptr);
+            num_processed = num_processed + 1;
+        }
+
+        gdlll_purge_tombstones(gdllc_ptr);
+
+    }
+
+    gdlll_end_continuation(cont_ptr);
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_delete_all_elements_incrementally() function
+
+int gdlll_sort_incrementally(struct gdll_container *gdllc_ptr,
+                             struct gdll_continuation *cont_ptr,
+                             compare_elements_function comp_func,
+                             long max_elements, long max_microseconds)
+{
+
+    struct element **cursors = NULL;
+    struct element *temp = NULL;
+    long num_processed = 0;
+    long start_time = 0;
+    int pass_is_complete = 0;
+    int retval = GDLLL_ERROR_INIT_VALUE;
+
+    if (!gdllc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!comp_func) {
+        return GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL;
+    }
+
+    if ((max_elements < 0) || (max_microseconds < 0)) {
+        return GDLLL_NUM_ELEMENTS_IS_INVALID;
+    }
+
+    if (gdllc_ptr->epoch_reclamation_enabled) {
+        return GDLLL_CONTAINER_IS_SHARED;
+    }
+
+    retval = gdlll_resume_continuation(gdllc_ptr, cont_ptr,
+                                       GDLLL_CONTINUATION_OF_SORT);
+    if (retval != GDLLL_SUCCESS) {
+        return retval;
+    }
+
+    // the positions of the elements change
+    if (gdllc_ptr->order_statistic_index_enabled) {
+        gdlll_free_order_statistic_index(gdllc_ptr);
+        gdllc_ptr->order_statistic_index_is_stale = 1;
+    }
+
+    if (max_microseconds > 0) {
+        start_time = gdlll_get_time_in_microseconds();
+    }
+
+    cursors = cont_ptr->cursors;
+
+    while (1) {
+
+        if (gdlll_budget_is_used_up(num_processed, max_elements,
+                                    max_microseconds, start_time)) {
+            retval = GDLLL_OPERATION_IS_NOT_COMPLETE;
+            break;
+        }
+
+        num_processed = num_processed + 1;
+        pass_is_complete = 0;
+
+        if (cont_ptr->phase == GDLLL_PHASE_STARTING) {
+
+            cursors[0] = gdllc_ptr->first;
+            cursors[2] = gdllc_ptr->first;
+            cont_ptr->number_of_merges = 0;
+            cont_ptr->phase = GDLLL_PHASE_FINDING_FIRST_RUN;
+
+        } else if (cont_ptr->phase == GDLLL_PHASE_FINDING_FIRST_RUN) {
+
+            temp = cursors[2];
+            if ((!cursors[0]) || (!temp) || (!temp->next)) {
+                // the first run goes till the end of the list
+                pass_is_complete = 1;
+            } else if (comp_func(temp->next, temp) >= 0) {
+                cursors[2] = temp->next;
+            } else {
+                cursors[1] = temp->next;
+                cursors[2] = temp->next;
+                cont_ptr->phase = GDLLL_PHASE_FINDING_SECOND_RUN;
+            }
+
+        } else if (cont_ptr->phase == GDLLL_PHASE_FINDING_SECOND_RUN) {
+
+            temp = cursors[2];
+            if ((temp) && (temp->next) && (comp_func(temp->next, temp) >= 0)) {
+                cursors[2] = temp->next;
+            } else {
+                cursors[2] = (temp) ? temp->next : NULL;
+                cont_ptr->phase = GDLLL_PHASE_MERGING_RUNS;
+            }
+
+        } else {
+
+            // An element of the second run is moved before the next element of
+            // the first run only if it is smaller, so the sort is stable.
+            if ((!cursors[0]) || (!cursors[1]) || (cursors[1] == cursors[2]) ||
+                (cursors[0] == cursors[1])) {
+                cont_ptr->number_of_merges = cont_ptr->number_of_merges + 1;
+                cursors[0] = cursors[2];
+                cont_ptr->phase = GDLLL_PHASE_FINDING_FIRST_RUN;
+            } else if (comp_func(cursors[1], cursors[0]) < 0) {
+                temp = cursors[1];
+                cursors[1] = temp->next;
+                gdlll_move_element_before_element(gdllc_ptr, temp, cursors[0]);
+            } else {
+                cursors[0] = cursors[0]->next;
+            }
+
+        }
+
+        if (pass_is_complete) {
+            if (cont_ptr->number_of_merges == 0) {
+                retval = GDLLL_SUCCESS;
+                break;
+            }
+            cont_ptr->phase = GDLLL_PHASE_STARTING;
+        }
+
+    } // end of while loop
+
+    // a tombstone may have been moved to an end of the list
+    if (gdllc_ptr->number_of_tombstones != 0) {
+        gdlll_trim_tombstones(gdllc_ptr);
+    }
+
+    if (retval == GDLLL_SUCCESS) {
+        gdlll_end_continuation(cont_ptr);
+    }
+
+    return retval;
+
+} // end of gdlll_sort_incrementally() function
+
+void gdlll_set_memory_limit(struct gdll_container *gdllc_ptr, long max_bytes,
+                            choose_element_to_evict_function evict_func)
+{
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    if (max_bytes < 0) {
+        max_bytes = 0;
+    }
+
+    gdllc_ptr->memory_limit = max_bytes;
+    gdllc_ptr->choose_element_to_evict = evict_func;
+
+    return;
+
+} // end of gdlll_set_memory_limit() function
+
+long gdlll_get_memory_in_use(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return 0;
+    }
+
+    return (gdllc_ptr->memory_in_use);
+
+} // end of gdlll_get_memory_in_use() function
+
+long gdlll_get_global_memory_in_use(void)
+{
+
+    // the change of this thread that has not been added yet is included
+    return GDLLL_LOAD_RELAXED(gdlll_global_memory_in_use) +
+           gdlll_global_memory_change_of_thread;
+
+} // end of gdlll_get_global_memory_in_use() function
+
+struct element *gdlll_choose_front_element_to_evict(
+                                            struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return NULL;
+    }
+
+    return gdllc_ptr->first;
+
+} // end of gdlll_choose_front_element_to_evict() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. If 'cont_ptr' is not in use then this function starts
+// using it for 'operation' on the container (in GDLLL_PHASE_STARTING). It
+// returns GDLLL_CONTINUATION_IS_INVALID if 'cont_ptr' is NULL or is in use by
+// another operation.
+static int gdlll_resume_continuation(struct gdll_container *gdllc_ptr,
+                                     struct gdll_continuation *cont_ptr,
+                                     int operation)
+{
+
+    if (!cont_ptr) {
+        return GDLLL_CONTINUATION_IS_INVALID;
+    }
+
+    if (cont_ptr->operation != GDLLL_CONTINUATION_IS_UNUSED) {
+        if ((cont_ptr->operation != operation) ||
+            (cont_ptr->gdllc_ptr != gdllc_ptr)) {
+            return GDLLL_CONTINUATION_IS_INVALID;
+        }
+        return GDLLL_SUCCESS;
+    }
+
+    gdlll_init_continuation(cont_ptr);
+
+    cont_ptr->gdllc_ptr = gdllc_ptr;
+    cont_ptr->operation = operation;
+    cont_ptr->phase = GDLLL_PHASE_STARTING;
+
+    cont_ptr->next = gdllc_ptr->continuations;
+    if (gdllc_ptr->continuations) {
+        gdllc_ptr->continuations->prev = cont_ptr;
+    }
+    gdllc_ptr->continuations = cont_ptr;
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_resume_continuation() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function removes a continuation that is in use from
+// the list of its container and marks it unused.
+static void gdlll_end_continuation(struct gdll_continuation *cont_ptr)
+{
+
+    if (cont_ptr->prev) {
+        cont_ptr->prev->next = cont_ptr->next;
+    } else {
+        cont_ptr->gdllc_ptr->continuations = cont_ptr->next;
+    }
+    if (cont_ptr->next) {
+        cont_ptr->next->prev = cont_ptr->prev;
+    }
+
+    gdlll_init_continuation(cont_ptr);
+
+} // end of gdlll_end_continuation() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function makes the cursors of the continuations of
+// the container that are on 'old_elem_ptr' point to 'new_elem_ptr' (the next
+// element when 'old_elem_ptr' is removed from the list, the new copy when it
+// is moved by a relayout).
+static void gdlll_replace_element_in_continuations(
+                                            struct gdll_container *gdllc_ptr,
+                                            struct element *old_elem_ptr,
+                                            struct element *new_elem_ptr)
+{
+
+    struct gdll_continuation *cont_ptr = NULL;
+    int i = 0;
+
+    for (cont_ptr = gdllc_ptr->continuations; cont_ptr;
+                                                cont_ptr = cont_ptr->next) {
+        for (i = 0; i < 3; i = i + 1) {
+            if (cont_ptr->cursors[i] == old_elem_ptr) {
+                cont_ptr->cursors[i] = new_elem_ptr;
+            }
+        }
+    }
+
+} // end of gdlll_replace_element_in_continuations() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function is called when many elements have been
+// removed from the list at once (without gdlll_unlink_element()). The cursors
+// of the continuations of the container that are on elements are moved to
+// 'elem_ptr' (an element that is still in the list, or NULL). A sort in
+// progress can't know whether it has skipped a part of the list, so it is
+// made to do another pass.
+static void gdlll_move_continuations(struct gdll_container *gdllc_ptr,
+                                     struct element *elem_ptr)
+{
+
+    struct gdll_continuation *cont_ptr = NULL;
+    int i = 0;
+
+    for (cont_ptr = gdllc_ptr->continuations; cont_ptr;
+                                                cont_ptr = cont_ptr->next) {
+        for (i = 0; i < 3; i = i + 1) {
+            if (cont_ptr->cursors[i]) {
+                cont_ptr->cursors[i] = elem_ptr;
+            }
+        }
+        if (cont_ptr->operation == GDLLL_CONTINUATION_OF_SORT) {
+            cont_ptr->number_of_merges = cont_ptr->number_of_merges + 1;
+        }
+    }
+
+} // end of gdlll_move_continuations() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function frees the elements that an incremental
+// delete has removed from the list and not freed yet.
+static void gdlll_free_pending_elements(struct gdll_container *gdllc_ptr,
+                                        struct gdll_continuation *cont_ptr)
+{
+
+    struct element *temp = NULL;
+
+    while (cont_ptr->pending_elements) {
+        temp = cont_ptr->pending_elements;
+        cont_ptr->pending_elements = temp->next;
+        if (gdllc_ptr->call_function_before_deleting_data) {
+            gdllc_ptr->call_function_before_deleting_data(temp->data_ptr);
+        }
+        gdlll_release_element_memory(gdllc_ptr, temp);
+    }
+
+} // end of gdlll_free_pending_elements() function
+
+// This function returns the time of the monotonic clock in microseconds. On
+// systems without CLOCK_MONOTONIC, the processor time used by the program is
+// returned instead (wall-clock time can jump).
+static long gdlll_get_time_in_microseconds(void)
+{
+
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts = {0};
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((long)(ts.tv_sec)) * 1000000L) + (((long)(ts.tv_nsec)) / 1000L);
+#else
+    return (long)(((double)(clock())) * (1000000.0 / CLOCKS_PER_SEC));
+#endif
+
+} // end of gdlll_get_time_in_microseconds() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function returns 1 if an incremental operation that
+// has processed 'num_processed' elements since 'start_time' has used up its
+// budget, otherwise it returns 0 (see struct gdll_continuation).
+static int gdlll_budget_is_used_up(long num_processed, long max_elements,
+                                   long max_microseconds, long start_time)
+{
+
+    if ((max_elements > 0) && (num_processed >= max_elements)) {
+        return 1;
+    }
+
+    if ((max_microseconds > 0) && (num_processed > 0) &&
+        ((num_processed % GDLLL_ELEMENTS_PER_CLOCK_READ) == 0) &&
+        ((gdlll_get_time_in_microseconds() - start_time) >=
+                                                        max_microseconds)) {
+        return 1;
+    }
+
+    return 0;
+
+} // end of gdlll_budget_is_used_up() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function moves 'elem_ptr' just before
+// 'before_elem_ptr' in the list ('elem_ptr' must come after 'before_elem_ptr'
+// in the list). Only the links are changed, so the continuations and the
+// indexes don't need to know about it.
+static void gdlll_move_element_before_element(
+                                        struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr,
+                                        struct element *before_elem_ptr)
+{
+
+    elem_ptr->prev->next = elem_ptr->next;
+    if (elem_ptr->next) {
+        elem_ptr->next->prev = elem_ptr->prev;
+    } else {
+        gdllc_ptr->last = elem_ptr->prev;
+    }
+
+    elem_ptr->prev = before_elem_ptr->prev;
+    elem_ptr->next = before_elem_ptr;
+    if (before_elem_ptr->prev) {
+        before_elem_ptr->prev->next = elem_ptr;
+    } else {
+        GDLLL_STORE_RELEASE(gdllc_ptr->first, elem_ptr);
+    }
+    before_elem_ptr->prev = elem_ptr;
+
+} // end of gdlll_move_element_before_element() function
+
+void gdlll_delete_gdll_container(struct gdll_container *gdllc_ptr)
+{
+
+    if (!gdllc_ptr) {
+        return;
+    }
+
+    while (gdllc_ptr->continuations) {
+        gdlll_cancel_continuation(gdllc_ptr->continuations);
+    }
+
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+
+    gdlll_disable_lazy_deletion(gdllc_ptr);
+
+    // the elements kept for the snapshots go to the epoch retired lists
+    gdlll_free_all_snapshots(gdllc_ptr);
+
+    gdlll_disable_epoch_reclamation(gdllc_ptr);
+
+    gdlll_disable_integer_key_index(gdllc_ptr);
+
+    gdlll_disable_priority_queue_mode(gdllc_ptr);
+
+    gdlll_disable_order_statistic_index(gdllc_ptr);
+
+    // the reclaimer thread frees the elements queued above before it stops
+    gdlll_disable_async_deletion(gdllc_ptr);
+
+    // the retired and purged elements have been put back in the ring (or the
+    // arena) above
+    gdlll_disable_ring_mode(gdllc_ptr);
+
+    gdlll_disable_arena_mode(gdllc_ptr);
+
+    // the elements removed by gdlll_get_* functions can't be used any more
+    free(gdllc_ptr->ring_disabled_slots);
+    if (gdllc_ptr->arena_regions) {
+        gdlll_arena_free_all_regions(gdllc_ptr);
+    }
+
+    free(gdllc_ptr);
+
+    return;
+
+} // end of gdlll_delete_gdll_container() function
+
+struct gdll_compact_container *gdlll_compact_init_gdll_container(
+                            void *function_ptr_to_call_before_deleting_data)
+{
+
+    struct gdll_compact_container *gdllcc_ptr = calloc(sizeof(*gdllcc_ptr), 1);
+
+    if (!gdllcc_ptr)
+        return NULL;
+
+    gdllcc_ptr->elements = NULL;
+    gdllcc_ptr->elements_capacity = 0;
+    gdllcc_ptr->first = GDLLL_COMPACT_INVALID_INDEX;
+    gdllcc_ptr->last = GDLLL_COMPACT_INVALID_INDEX;
+    gdllcc_ptr->free_list = GDLLL_COMPACT_INVALID_INDEX;
+    gdllcc_ptr->total_number_of_elements = 0;
+    gdllcc_ptr->data_pool = NULL;
+    gdllcc_ptr->data_pool_used_bytes = 0;
+    gdllcc_ptr->data_pool_capacity = 0;
+    gdllcc_ptr->data_pool_wasted_bytes = 0;
+    gdllcc_ptr->call_function_before_deleting_data =
+                                    function_ptr_to_call_before_deleting_data;
+
+    return gdllcc_ptr;
+
+} // end of gdlll_compact_init_gdll_container() function
+
+long gdlll_compact_get_total_number_of_elements_in_gdll_container(
+                                    struct gdll_compact_container *gdllcc_ptr)
+{
+
+    if (!gdllcc_ptr) {
+        return 0;
+    }
+
+    return (gdllcc_ptr->total_number_of_elements);
+
+} // end of gdlll_compact_get_total_number_of_elements_in_gdll_container()
+
+int gdlll_compact_add_element_to_front(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    void *data_ptr, long data_size)
+{
+
+    unsigned int index = GDLLL_COMPACT_INVALID_INDEX;
+    struct compact_element *elem_ptr = NULL;
+
+    if (!gdllcc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!data_ptr) {
+        return GDLLL_DATA_PTR_IS_NULL;
+    }
+
+    if ((data_size <= 0) ||
+        ((unsigned long)(data_size) > GDLLL_COMPACT_MAX_DATA_POOL_SIZE)) {
+        return GDLLL_DATA_SIZE_IS_INVALID;
+    }
+
+    index = gdlll_compact_create_standalone_element(gdllcc_ptr, data_ptr,
+                                                    data_size);
+
+    if (index == GDLLL_COMPACT_INVALID_INDEX) {
+        return GDLLL_NO_MEMORY;
+    }
+
+    elem_ptr = &(gdllcc_ptr->elements[index]);
+
+    if (gdllcc_ptr->first == GDLLL_COMPACT_INVALID_INDEX) {
+        gdllcc_ptr->first = index;
+        gdllcc_ptr->last = index;
+    } else {
+        elem_ptr->next = gdllcc_ptr->first;
+        gdllcc_ptr->elements[gdllcc_ptr->first].prev = index;
+        gdllcc_ptr->first = index;
+    }
+
+    gdllcc_ptr->total_number_of_elements =
+                                    gdllcc_ptr->total_number_of_elements + 1;
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_compact_add_element_to_front() function
+
+int gdlll_compact_add_element_to_back(struct gdll_compact_container *gdllcc_ptr,
+                                      void *data_ptr, long data_size)
+{
+
+    unsigned int index = GDLLL_COMPACT_INVALID_INDEX;
+    struct compact_element *elem_ptr = NULL;
+
+    if (!gdllcc_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!data_ptr) {
+        return GDLLL_DATA_PTR_IS_NULL;
+    }
+
+    if ((data_size <= 0) ||
+        ((unsigned long)(data_size) > GDLLL_COMPACT_MAX_DATA_POOL_SIZE)) {
+        return GDLLL_DATA_SIZE_IS_INVALID;
+    }
+
+    index = gdlll_compact_create_standalone_element(gdllcc_ptr, data_ptr,
+                                                    data_size);
+
+    if (index == GDLLL_COMPACT_INVALID_INDEX) {
+        return GDLLL_NO_MEMORY;
+    }
+
+    elem_ptr = &(gdllcc_ptr->elements[index]);
+
+    if (gdllcc_ptr->first == GDLLL_COMPACT_INVALID_INDEX) {
+        gdllcc_ptr->first = index;
+        gdllcc_ptr->last = index;
+    } else {
+        gdllcc_ptr->elements[gdllcc_ptr->last].next = index;
+        elem_ptr->prev = gdllcc_ptr->last;
+        gdllcc_ptr->last = index;
+    }
+
+    gdllcc_ptr->total_number_of_elements =
+                                    gdllcc_ptr->total_number_of_elements + 1;
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_compact_add_element_to_back() function
+
+unsigned int gdlll_compact_peek_front_element(
+                                    struct gdll_compact_container *gdllcc_ptr)
+{
+
+    if (!gdllcc_ptr) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    return (gdllcc_ptr->first);
+
+} // end of gdlll_compact_peek_front_element() function
+
+unsigned int gdlll_compact_peek_last_element(
+                                    struct gdll_compact_container *gdllcc_ptr)
+{
+
+    if (!gdllcc_ptr) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    return (gdllcc_ptr->last);
+
+} // end of gdlll_compact_peek_last_element() function
+
+unsigned int gdlll_compact_peek_next_element(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    unsigned int index)
+{
+
+    if (!gdllcc_ptr) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    if (!gdlll_compact_is_valid_index(gdllcc_ptr, index)) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    return (gdllcc_ptr->elements[index].next);
+
+} // end of gdlll_compact_peek_next_element() function
+
+unsigned int gdlll_compact_peek_prev_element(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    unsigned int index)
+{
+
+    if (!gdllcc_ptr) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    if (!gdlll_compact_is_valid_index(gdllcc_ptr, index)) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    return (gdllcc_ptr->elements[index].prev);
+
+} // end of gdlll_compact_peek_prev_element() function
+
+unsigned int gdlll_compact_peek_matching_element(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    void *data_ptr, long data_size,
+                                    compare_elements_function comp_func)
+{
+
+    struct element key_elem = {0};
+    struct element temp_elem = {0};
+    unsigned int index = GDLLL_COMPACT_INVALID_INDEX;
+
+    if (!gdllcc_ptr) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    if (!data_ptr) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    if (data_size <= 0) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    if (!comp_func) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    // The comparator only reads the elements, so the user's data can be
+    // compared in place without copying it into a new element.
+    key_elem.data_ptr = data_ptr;
+    key_elem.data_size = data_size;
+
+    index = gdllcc_ptr->first;
+
+    while (index != GDLLL_COMPACT_INVALID_INDEX) {
+        temp_elem.data_ptr = gdllcc_ptr->data_pool +
+                                    gdllcc_ptr->elements[index].data_offset;
+        temp_elem.data_size = gdllcc_ptr->elements[index].data_size;
+        if (comp_func(&key_elem, &temp_elem) == 0) {
+            break;
+        }
+        index = gdllcc_ptr->elements[index].next;
+    }
+
+    return index;
+
+} // end of gdlll_compact_peek_matching_element() function
+
+void *gdlll_compact_get_data_ptr(struct gdll_compact_container *gdllcc_ptr,
+                                 unsigned int index)
+{
+
+    if (!gdllcc_ptr) {
+        return NULL;
+    }
+
+    if (!gdlll_compact_is_valid_index(gdllcc_ptr, index)) {
+        return NULL;
+    }
+
+    return (gdllcc_ptr->data_pool + gdllcc_ptr->elements[index].data_offset);
+
+} // end of gdlll_compact_get_data_ptr() function
+
+long gdlll_compact_get_data_size(struct gdll_compact_container *gdllcc_ptr,
+                                 unsigned int index)
+{
+
+    if (!gdllcc_ptr) {
+        return 0;
+    }
+
+    if (!gdlll_compact_is_valid_index(gdllcc_ptr, index)) {
+        return 0;
+    }
+
+    return ((long)(gdllcc_ptr->elements[index].data_size));
+
+} // end of gdlll_compact_get_data_size() function
+
+void gdlll_compact_delete_front_element(
+                                    struct gdll_compact_container *gdllcc_ptr)
+{
+
+    if (!gdllcc_ptr) {
+        return;
+    }
+
+    gdlll_compact_delete_element(gdllcc_ptr, gdllcc_ptr->first);
+
+    return;
+
+} // end of gdlll_compact_delete_front_element() function
+
+void gdlll_compact_delete_last_element(
+                                    struct gdll_compact_container *gdllcc_ptr)
+{
+
+    if (!gdllcc_ptr) {
+        return;
+    }
+
+    gdlll_compact_delete_element(gdllcc_ptr, gdllcc_ptr->last);
+
+    return;
+
+} // end of gdlll_compact_delete_last_element() function
+
+void gdlll_compact_delete_element(struct gdll_compact_container *gdllcc_ptr,
+                                  unsigned int index)
+{
+
+    struct compact_element *elem_ptr = NULL;
+
+    if (!gdllcc_ptr) {
+        return;
+    }
+
+    if (!gdlll_compact_is_valid_index(gdllcc_ptr, index)) {
+        return;
+    }
+
+    elem_ptr = &(gdllcc_ptr->elements[index]);
+
+    // remove the element from the list
+    if (elem_ptr->prev == GDLLL_COMPACT_INVALID_INDEX) {
+        gdllcc_ptr->first = elem_ptr->next;
+    } else {
+        gdllcc_ptr->elements[elem_ptr->prev].next = elem_ptr->next;
+    }
+
+    if (elem_ptr->next == GDLLL_COMPACT_INVALID_INDEX) {
+        gdllcc_ptr->last = elem_ptr->prev;
+    } else {
+        gdllcc_ptr->elements[elem_ptr->next].prev = elem_ptr->prev;
+    }
+
+    if (gdllcc_ptr->call_function_before_deleting_data) {
+        gdllcc_ptr->call_function_before_deleting_data(
+                        gdllcc_ptr->data_pool + elem_ptr->data_offset);
+    }
+
+    gdllcc_ptr->data_pool_wasted_bytes = gdllcc_ptr->data_pool_wasted_bytes +
+                        GDLLL_COMPACT_ALIGNED_DATA_SIZE(elem_ptr->data_size);
+
+    // A 'data_size' of 0 marks the element as free.
+    elem_ptr->data_size = 0;
+    elem_ptr->data_offset = 0;
+    elem_ptr->prev = GDLLL_COMPACT_INVALID_INDEX;
+    elem_ptr->next = gdllcc_ptr->free_list;
+    gdllcc_ptr->free_list = index;
+
+    gdllcc_ptr->total_number_of_elements =
+                                    gdllcc_ptr->total_number_of_elements - 1;
+
+    // If the container has become empty then the whole data pool can be reused.
+    if (gdllcc_ptr->total_number_of_elements == 0) {
+        gdllcc_ptr->data_pool_used_bytes = 0;
+        gdllcc_ptr->data_pool_wasted_bytes = 0;
+    }
+
+    return;
+
+} // end of gdlll_compact_delete_element() function
+
+void gdlll_compact_delete_all_elements_in_gdll_container(
+                                    struct gdll_compact_container *gdllcc_ptr)
+{
+
+    if (!gdllcc_ptr) {
+        return;
+    }
+
+    while (gdllcc_ptr->first != GDLLL_COMPACT_INVALID_INDEX) {
+        gdlll_compact_delete_element(gdllcc_ptr, gdllcc_ptr->first);
+    }
+
+    return;
+
+} // end of gdlll_compact_delete_all_elements_in_gdll_container() function
+
+void gdlll_compact_delete_gdll_container(
+                                    struct gdll_compact_container *gdllcc_ptr)
+{
+
+    if (!gdllcc_ptr) {
+        return;
+    }
+
+    gdlll_compact_delete_all_elements_in_gdll_container(gdllcc_ptr);
+
+    free(gdllcc_ptr->elements);
+    free(gdllcc_ptr->data_pool);
+
+    free(gdllcc_ptr);
+
+    return;
+
+} // end of gdlll_compact_delete_gdll_container() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function returns 1 if 'index' refers to an element
+// that is in the list, otherwise it returns 0.
+static int gdlll_compact_is_valid_index(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    unsigned int index)
+{
+
+    if (index >= gdllcc_ptr->elements_capacity) {
+        return 0;
+    }
+
+    // free elements have 'data_size' 0
+    if (gdllcc_ptr->elements[index].data_size == 0) {
+        return 0;
+    }
+
+    return 1;
+
+} // end of gdlll_compact_is_valid_index() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function makes sure that at least 'num_bytes' bytes
+// are free at the end of the data pool. It first tries to compact the data pool
+// (if enough bytes are wasted) and then grows the data pool. It returns 1 on
+// success and 0 if there is no memory.
+static int gdlll_compact_reserve_data_pool_bytes(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    unsigned long num_bytes)
+{
+
+    unsigned long new_capacity = 0;
+    unsigned char *new_data_pool = NULL;
+
+    if ((gdllcc_ptr->data_pool_capacity - gdllcc_ptr->data_pool_used_bytes) >=
+                                                                    num_bytes) {
+        return 1;
+    }
+
+    // Compact only if at least half of the used bytes are wasted, so that the
+    // cost of compaction is amortized over the deletes that wasted the bytes.
+    if ((gdllcc_ptr->data_pool_wasted_bytes >= num_bytes) &&
+        ((gdllcc_ptr->data_pool_wasted_bytes * 2) >=
+                                        gdllcc_ptr->data_pool_used_bytes)) {
+        gdlll_compact_compact_data_pool(gdllcc_ptr);
+        if ((gdllcc_ptr->data_pool_capacity -
+                            gdllcc_ptr->data_pool_used_bytes) >= num_bytes) {
+            return 1;
+        }
+    }
+
+    if ((GDLLL_COMPACT_MAX_DATA_POOL_SIZE - gdllcc_ptr->data_pool_used_bytes) <
+                                                                    num_bytes) {
+        return 0;
+    }
+
+    new_capacity = gdllcc_ptr->data_pool_capacity * 2;
+    if (new_capacity < (gdllcc_ptr->data_pool_used_bytes + num_bytes)) {
+        new_capacity = gdllcc_ptr->data_pool_used_bytes + num_bytes;
+    }
+    if (new_capacity > GDLLL_COMPACT_MAX_DATA_POOL_SIZE) {
+        new_capacity = GDLLL_COMPACT_MAX_DATA_POOL_SIZE;
+    }
+
+    new_data_pool = realloc(gdllcc_ptr->data_pool, (size_t)(new_capacity));
+    if (!new_data_pool) {
+        return 0;
+    }
+
+    gdllcc_ptr->data_pool = new_data_pool;
+    gdllcc_ptr->data_pool_capacity = new_capacity;
+
+    return 1;
+
+} // end of gdlll_compact_reserve_data_pool_bytes() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function copies the data of all elements (in list
+// order) into a new data pool so that the bytes of deleted elements are
+// reclaimed. If there is no memory for the new data pool then the data pool is
+// left as it is.
+static void gdlll_compact_compact_data_pool(
+                                    struct gdll_compact_container *gdllcc_ptr)
+{
+
+    unsigned char *new_data_pool = NULL;
+    unsigned long offset = 0;
+    unsigned int index = GDLLL_COMPACT_INVALID_INDEX;
+    struct compact_element *elem_ptr = NULL;
+
+    new_data_pool = malloc((size_t)(gdllcc_ptr->data_pool_capacity));
+    if (!new_data_pool) {
+        return;
+    }
+
+    index = gdllcc_ptr->first;
+
+    while (index != GDLLL_COMPACT_INVALID_INDEX) {
+        elem_ptr = &(gdllcc_ptr->elements[index]);
+        memcpy(new_data_pool + offset,
+               gdllcc_ptr->data_pool + elem_ptr->data_offset,
+               (size_t)(elem_ptr->data_size));
+        elem_ptr->data_offset = (unsigned int)(offset);
+        offset = offset + GDLLL_COMPACT_ALIGNED_DATA_SIZE(elem_ptr->data_size);
+        index = elem_ptr->next;
+    }
+
+    free(gdllcc_ptr->data_pool);
+
+    gdllcc_ptr->data_pool = new_data_pool;
+    gdllcc_ptr->data_pool_used_bytes = offset;
+    gdllcc_ptr->data_pool_wasted_bytes = 0;
+
+    return;
+
+} // end of gdlll_compact_compact_data_pool() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function takes a free element (growing the 'elements'
+// array if needed), copies the data into the data pool and returns the index
+// of the element. The element is not linked into the list. If there is no
+// memory then GDLLL_COMPACT_INVALID_INDEX is returned.
+static unsigned int gdlll_compact_create_standalone_element(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    void *data_ptr, long data_size)
+{
+
+    unsigned long aligned_data_size = GDLLL_COMPACT_ALIGNED_DATA_SIZE(data_size);
+    unsigned int index = GDLLL_COMPACT_INVALID_INDEX;
+    unsigned int new_capacity = 0;
+    unsigned int i = 0;
+    struct compact_element *new_elements = NULL;
+    struct compact_element *elem_ptr = NULL;
+
+    if (!gdlll_compact_reserve_data_pool_bytes(gdllcc_ptr, aligned_data_size)) {
+        return GDLLL_COMPACT_INVALID_INDEX;
+    }
+
+    if (gdllcc_ptr->free_list == GDLLL_COMPACT_INVALID_INDEX) {
+
+        if (gdllcc_ptr->elements_capacity >= (GDLLL_COMPACT_INVALID_INDEX / 2)) {
+            if (gdllcc_ptr->elements_capacity == GDLLL_COMPACT_INVALID_INDEX) {
+                return GDLLL_COMPACT_INVALID_INDEX;
+            }
+            new_capacity = GDLLL_COMPACT_INVALID_INDEX;
+        } else if (gdllcc_ptr->elements_capacity == 0) {
+            new_capacity = GDLLL_COMPACT_INITIAL_CAPACITY;
+        } else {
+            new_capacity = gdllcc_ptr->elements_capacity * 2;
+        }
+
+        new_elements = realloc(gdllcc_ptr->elements,
+                               sizeof(*new_elements) * (size_t)(new_capacity));
+        if (!new_elements) {
+            return GDLLL_COMPACT_INVALID_INDEX;
+        }
+
+        // chain the new elements into the free list (lowest index first)
+        for (i = new_capacity; i > gdllcc_ptr->elements_capacity; i = i - 1) {
+            new_elements[i - 1].prev = GDLLL_COMPACT_INVALID_INDEX;
+            new_elements[i - 1].next = gdllcc_ptr->free_list;
+            new_elements[i - 1].data_size = 0;
+            new_elements[i - 1].data_offset = 0;
+            gdllcc_ptr->free_list = i - 1;
+        }
+
+        gdllcc_ptr->elements = new_elements;
+        gdllcc_ptr->elements_capacity = new_capacity;
+
+    }
+
+    index = gdllcc_ptr->free_list;
+    elem_ptr = &(gdllcc_ptr->elements[index]);
+    gdllcc_ptr->free_list = elem_ptr->next;
+
+    memmove(gdllcc_ptr->data_pool + gdllcc_ptr->data_pool_used_bytes, data_ptr,
+            (size_t)(data_size));
+    elem_ptr->data_offset = (unsigned int)(gdllcc_ptr->data_pool_used_bytes);
+    elem_ptr->data_size = (unsigned int)(data_size);
+    gdllcc_ptr->data_pool_used_bytes = gdllcc_ptr->data_pool_used_bytes +
+                                                            aligned_data_size;
+
+    elem_ptr->prev = GDLLL_COMPACT_INVALID_INDEX;
+    elem_ptr->next = GDLLL_COMPACT_INVALID_INDEX;
+
+    return index;
+
+} // end of gdlll_compact_create_standalone_element() function
+
+struct gdll_timer_wheel *gdlll_timer_wheel_init(
+                            void *function_ptr_to_call_before_deleting_data,
+                            long start_time)
+{
+
+    struct gdll_timer_wheel *gdlltw_ptr = calloc(sizeof(*gdlltw_ptr), 1);
+    long i = 0;
+
+    if (!gdlltw_ptr)
+        return NULL;
+
+    gdlltw_ptr->buckets = calloc(GDLLL_TIMER_WHEEL_NUM_BUCKETS,
+                                 sizeof(*(gdlltw_ptr->buckets)));
+    if (!gdlltw_ptr->buckets) {
+        free(gdlltw_ptr);
+        return NULL;
+    }
+
+    for (i = 0; i < GDLLL_TIMER_WHEEL_NUM_BUCKETS; i = i + 1) {
+        gdlltw_ptr->buckets[i] = gdlll_init_gdll_container(
+                                    function_ptr_to_call_before_deleting_data);
+        if (!gdlltw_ptr->buckets[i]) {
+            gdlll_timer_wheel_delete(gdlltw_ptr);
+            return NULL;
+        }
+    }
+
+    for (i = 0; i < GDLLL_TIMER_WHEEL_LEVELS; i = i + 1) {
+        gdlltw_ptr->number_of_timers_in_level[i] = 0;
+    }
+
+    gdlltw_ptr->current_time = start_time;
+    gdlltw_ptr->total_number_of_timers = 0;
+    gdlltw_ptr->call_function_before_deleting_data =
+                                    function_ptr_to_call_before_deleting_data;
+
+    return gdlltw_ptr;
+
+} // end of gdlll_timer_wheel_init() function
+
+long gdlll_timer_wheel_get_total_number_of_timers(
+                                        struct gdll_timer_wheel *gdlltw_ptr)
+{
+
+    if (!gdlltw_ptr) {
+        return 0;
+    }
+
+    return (gdlltw_ptr->total_number_of_timers);
+
+} // end of gdlll_timer_wheel_get_total_number_of_timers() function
+
+struct element *gdlll_timer_wheel_arm(struct gdll_timer_wheel *gdlltw_ptr,
+                                      void *data_ptr, long data_size,
+                                      long expiry_time)
+{
+
+    struct element *elem_ptr = NULL;
+
+    if (!gdlltw_ptr) {
+        return NULL;
+    }
+
+    if (!data_ptr) {
+        return NULL;
+    }
+
+    if (data_size <= 0) {
+        return NULL;
+    }
+
+    // the expiry time and the bucket of the timer are kept in the extension
+    // of the element (in the memory block of the element)
+    elem_ptr = gdlll_create_element(NULL, data_ptr, data_size, 1);
+
+    if (!elem_ptr) {
+        return NULL;
+    }
+
+    elem_ptr->extension->timer_expiry_time = expiry_time;
+
+    gdlll_timer_wheel_add_timer(gdlltw_ptr, elem_ptr,
+                                gdlltw_ptr->current_time + 1);
+
+    return elem_ptr;
+
+} // end of gdlll_timer_wheel_arm() function
+
+int gdlll_timer_wheel_arm_element(struct gdll_timer_wheel *gdlltw_ptr,
+                                  struct element *elem_ptr, long expiry_time)
+{
+
+    if (!gdlltw_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!elem_ptr) {
+        return GDLLL_ELEMENT_PTR_IS_NULL;
+    }
+
+    // 'elem_ptr' must not be in a list already
+    if ((elem_ptr->prev) || (elem_ptr->next)) {
+        return GDLLL_ELEMENT_IS_NOT_STANDALONE;
+    }
+
+    if (!gdlll_get_element_extension(elem_ptr)) {
+        return GDLLL_NO_MEMORY;
+    }
+
+    elem_ptr->extension->timer_expiry_time = expiry_time;
+
+    gdlll_timer_wheel_add_timer(gdlltw_ptr, elem_ptr,
+                                gdlltw_ptr->current_time + 1);
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_timer_wheel_arm_element() function
+
+int gdlll_timer_wheel_rearm(struct gdll_timer_wheel *gdlltw_ptr,
+                            struct element *elem_ptr, long expiry_time)
+{
+
+    if (!gdlltw_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!elem_ptr) {
+        return GDLLL_ELEMENT_PTR_IS_NULL;
+    }
+
+    if (!gdlll_timer_wheel_is_armed(elem_ptr)) {
+        return GDLLL_ELEMENT_IS_NOT_ARMED;
+    }
+
+    gdlll_timer_wheel_remove_timer(gdlltw_ptr, elem_ptr);
+
+    elem_ptr->extension->timer_expiry_time = expiry_time;
+
+    gdlll_timer_wheel_add_timer(gdlltw_ptr, elem_ptr,
+                                gdlltw_ptr->current_time + 1);
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_timer_wheel_rearm() function
+
+int gdlll_timer_wheel_cancel(struct gdll_timer_wheel *gdlltw_ptr,
+                             struct element *elem_ptr)
+{
+
+    struct gdll_container *bucket_ptr = NULL;
+
+    if (!gdlltw_ptr) {
+        return GDLLL_GDLLC_PTR_IS_NULL;
+    }
+
+    if (!elem_ptr) {
+        return GDLLL_ELEMENT_PTR_IS_NULL;
+    }
+
+    if (!gdlll_timer_wheel_is_armed(elem_ptr)) {
+        return GDLLL_ELEMENT_IS_NOT_ARMED;
+    }
+
+    bucket_ptr = gdlltw_ptr->buckets[elem_ptr->extension->timer_bucket];
+
+    gdlll_timer_wheel_remove_timer(gdlltw_ptr, elem_ptr);
+
+    gdlll_delete_standalone_element(bucket_ptr, elem_ptr);
+
+    return GDLLL_SUCCESS;
+
+} // end of gdlll_timer_wheel_cancel() function
+
+long gdlll_timer_wheel_get_expiry_time(struct element *elem_ptr)
+{
+
+    if ((!elem_ptr) || (!elem_ptr->extension)) {
+        return 0;
+    }
+
+    return (elem_ptr->extension->timer_expiry_time);
+
+} // end of gdlll_timer_wheel_get_expiry_time() function
+
+long gdlll_timer_wheel_advance(struct gdll_timer_wheel *gdlltw_ptr, long time,
+                               struct gdll_container *expired_gdllc_ptr)
+{
+
+    struct gdll_container *bucket_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    unsigned long now = 0;
+    unsigned long skip_to = 0;
+    long count = 0;
+    long level = 0;
+    long bucket = 0;
+
+    if ((!gdlltw_ptr) || (!expired_gdllc_ptr)) {
+        return 0;
+    }
+
+    if (time < gdlltw_ptr->current_time) {
+        return 0;
+    }
+
+    while (gdlltw_ptr->current_time < time) {
+
+        // Nothing happens until the next tick at which the lowest level that
+        // has timers is cascaded, so jump to the tick before it.
+        level = 0;
+        while ((level < GDLLL_TIMER_WHEEL_LEVELS) &&
+               (gdlltw_ptr->number_of_timers_in_level[level] == 0)) {
+            level = level + 1;
+        }
+
+        if (level == GDLLL_TIMER_WHEEL_LEVELS) {
+            gdlltw_ptr->current_time = time;
+            break;
+        }
+
+        if (level > 0) {
+            skip_to = ((unsigned long)(gdlltw_ptr->current_time)) |
+                    ((1UL << (GDLLL_TIMER_WHEEL_SLOT_BITS * level)) - 1);
+            if ((long)(skip_to) >= time) {
+                gdlltw_ptr->current_time = time;
+                break;
+            }
+            gdlltw_ptr->current_time = (long)(skip_to);
+        }
+
+        gdlltw_ptr->current_time = gdlltw_ptr->current_time + 1;
+        now = (unsigned long)(gdlltw_ptr->current_time);
+
+        // When a level wraps around, the bucket of the next level that covers
+        // the next ticks is cascaded (its timers are put in the lower levels).
+        for (level = 1; level < GDLLL_TIMER_WHEEL_LEVELS; level = level + 1) {
+
+            if ((now & ((1UL << (GDLLL_TIMER_WHEEL_SLOT_BITS * level)) - 1))
+                                                                        != 0) {
+                break;
+            }
+
+            bucket = (level * GDLLL_TIMER_WHEEL_SLOTS) +
+                     (long)((now >> (GDLLL_TIMER_WHEEL_SLOT_BITS * level)) &
+                            (GDLLL_TIMER_WHEEL_SLOTS - 1));
+            bucket_ptr = gdlltw_ptr->buckets[bucket];
+
+            while (bucket_ptr->first) {
+                elem_ptr = bucket_ptr->first;
+                gdlll_timer_wheel_remove_timer(gdlltw_ptr, elem_ptr);
+                gdlll_timer_wheel_add_timer(gdlltw_ptr, elem_ptr,
+                                            gdlltw_ptr->current_time);
+            }
+
+        }
+
+        // all the timers in the bucket of this tick have expired
+        bucket_ptr = gdlltw_ptr->buckets[now & (GDLLL_TIMER_WHEEL_SLOTS - 1)];
+
+        while (bucket_ptr->first) {
+            elem_ptr = bucket_ptr->first;
+            // this tick is done again by the next call
+            if (gdlll_make_room_in_indexes(expired_gdllc_ptr, elem_ptr, 1) !=
+                                                            GDLLL_SUCCESS) {
+                gdlltw_ptr->current_time = gdlltw_ptr->current_time - 1;
+                return count;
+            }
+            gdlll_timer_wheel_remove_timer(gdlltw_ptr, elem_ptr);
+            gdlll_insert_element_before_element(expired_gdllc_ptr, elem_ptr,
+                                                NULL);
+            expired_gdllc_ptr->total_number_of_elements =
+                            expired_gdllc_ptr->total_number_of_elements + 1;
+            count = count + 1;
+        }
+
+    }
+
+    return count;
+
+} // end of gdlll_timer_wheel_advance() function
+
+void gdlll_timer_wheel_delete(struct gdll_timer_wheel *gdlltw_ptr)
+{
+
+    long i = 0;
+
+    if (!gdlltw_ptr) {
+        return;
+    }
+
+    if (gdlltw_ptr->buckets) {
+        for (i = 0; i < GDLLL_TIMER_WHEEL_NUM_BUCKETS; i = i + 1) {
+            gdlll_delete_gdll_container(gdlltw_ptr->buckets[i]);
+        }
+    }
+
+    free(gdlltw_ptr->buckets);
+
+    free(gdlltw_ptr);
+
+    return;
+
+} // end of gdlll_timer_wheel_delete() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function adds the timer (whose expiry time is in
+// 'timer_expiry_time' of the extension of the element, which the element must
+// have) to the bucket that covers max(expiry time, 'min_time'), and stores the
+// bucket in 'timer_bucket' of the extension. 'min_time' must not be before
+// the current time.
+static void gdlll_timer_wheel_add_timer(struct gdll_timer_wheel *gdlltw_ptr,
+                                        struct element *elem_ptr,
+                                        long min_time)
+{
+
+    struct gdll_container *bucket_ptr = NULL;
+    unsigned long when = (unsigned long)(elem_ptr->extension->timer_expiry_time);
+    unsigned long delta = 0;
+    long level = 0;
+    long bucket = 0;
+
+    if (elem_ptr->extension->timer_expiry_time < min_time) {
+        when = (unsigned long)(min_time);
+    }
+
+    delta = when - (unsigned long)(gdlltw_ptr->current_time);
+
+    if (delta > GDLLL_TIMER_WHEEL_MAX_DELTA) {
+        delta = GDLLL_TIMER_WHEEL_MAX_DELTA;
+        when = (unsigned long)(gdlltw_ptr->current_time) + delta;
+    }
+
+    while (delta >= (1UL << (GDLLL_TIMER_WHEEL_SLOT_BITS * (level + 1)))) {
+        level = level + 1;
+    }
+
+    bucket = (level * GDLLL_TIMER_WHEEL_SLOTS) +
+             (long)((when >> (GDLLL_TIMER_WHEEL_SLOT_BITS * level)) &
+                    (GDLLL_TIMER_WHEEL_SLOTS - 1));
+    bucket_ptr = gdlltw_ptr->buckets[bucket];
+
+    gdlll_insert_element_before_element(bucket_ptr, elem_ptr, NULL);
+    bucket_ptr->total_number_of_elements =
+                                    bucket_ptr->total_number_of_elements + 1;
+
+    elem_ptr->extension->timer_bucket = bucket;
+
+    gdlltw_ptr->number_of_timers_in_level[level] =
+                            gdlltw_ptr->number_of_timers_in_level[level] + 1;
+    gdlltw_ptr->total_number_of_timers = gdlltw_ptr->total_number_of_timers + 1;
+
+} // end of gdlll_timer_wheel_add_timer() function
+
+// This function doesn't check the validity of its arguments. It is the
+// responsibility of the calling function to check the arguments it is passing
+// to this function. This function removes an armed timer from its bucket.
+static void gdlll_timer_wheel_remove_timer(struct gdll_timer_wheel *gdlltw_ptr,
+                                           struct element *elem_ptr)
+{
+
+    long bucket = elem_ptr->extension->timer_bucket;
+    long level = bucket / GDLLL_TIMER_WHEEL_SLOTS;
+    struct gdll_container *bucket_ptr = gdlltw_ptr->buckets[bucket];
+
+    gdlll_remove_element_from_list(bucket_ptr, elem_ptr);
+    bucket_ptr->total_number_of_elements =
+                                    bucket_ptr->total_number_of_elements - 1;
+
+    elem_ptr->extension->timer_bucket = -1;
+
+    gdlltw_ptr->number_of_timers_in_level[level] =
+                            gdlltw_ptr->number_of_timers_in_level[level] - 1;
+    gdlltw_ptr->total_number_of_timers = gdlltw_ptr->total_number_of_timers - 1;
+
+} // end of gdlll_timer_wheel_remove_timer() function
+
+// This function returns 1 if 'elem_ptr' is in a bucket of a timer wheel,
+// otherwise it returns 0.
+static int gdlll_timer_wheel_is_armed(struct element *elem_ptr)
+{
+
+    if (GDLLL_TIMER_BUCKET(elem_ptr) < 0) {
+        return 0;
+    }
+
+    return 1;
 
+} // end of gdlll_timer_wheel_is_armed() function
@@ -22,6 +22,10 @@
 #ifndef _GENERIC_DOUBLY_LINKED_LIST_LIBRARY_H_
 #define _GENERIC_DOUBLY_LINKED_LIST_LIBRARY_H_
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 // gdlll means generic doubly linked list library.
 // gdllc means generic doubly linked list container.
 // gdll means generic doubly linked list.
@@ -29,6 +33,11 @@
 // Everything happened successfully.
 #define GDLLL_SUCCESS 0
 
+// This is not an error. The budget of an incremental operation has been used
+// up before the operation could be completed (see struct gdll_continuation),
+// so the function must be called again to continue the operation.
+#define GDLLL_OPERATION_IS_NOT_COMPLETE 1
+
 // 'gdllc_ptr' argument is NULL.
 #define GDLLL_GDLLC_PTR_IS_NULL -1
 
@@ -50,15 +59,143 @@
 // The function pointer given by the user for comparing elements is NULL.
 #define GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL -7
 
+// The element pointer given by the user is NULL.
+#define GDLLL_ELEMENT_PTR_IS_NULL -8
+
+// The element given by the user is already in a list.
+#define GDLLL_ELEMENT_IS_NOT_STANDALONE -9
+
+// 'num_elements' argument is <= 0.
+#define GDLLL_NUM_ELEMENTS_IS_INVALID -10
+
+// A percentage argument is not in the range 0 to 100.
+#define GDLLL_PERCENT_IS_INVALID -11
+
+// 'max_readers' argument is <= 0.
+#define GDLLL_NUM_READERS_IS_INVALID -12
+
+// 'reader_id' argument is not in the range 0 to ('max_readers' - 1), or epoch
+// based reclamation is not enabled.
+#define GDLLL_READER_ID_IS_INVALID -13
+
+// The element given by the user is not armed in the timer wheel.
+#define GDLLL_ELEMENT_IS_NOT_ARMED -14
+
+// The container is in ring mode and all its slots are in use.
+#define GDLLL_CONTAINER_IS_FULL -15
+
+// The container has elements (and the function needs an empty container).
+#define GDLLL_CONTAINER_IS_NOT_EMPTY -16
+
+// 'when_full' argument is not one of the GDLLL_RING_*_WHEN_FULL values.
+#define GDLLL_WHEN_FULL_IS_INVALID -17
+
+// 'position' argument is not in the range 0 to 'total_number_of_elements'.
+#define GDLLL_POSITION_IS_INVALID -18
+
+// A thread could not be created (or the library was built with
+// GDLLL_NO_THREADS).
+#define GDLLL_THREAD_CREATION_FAILED -19
+
+// 'numa_node' argument is not GDLLL_NO_NUMA_NODE or a NUMA node that the
+// memory can be bound to.
+#define GDLLL_NUMA_NODE_IS_INVALID -20
+
+// The elements of the container can't be moved in memory because other threads
+// or snapshots may be reading them (epoch based reclamation is enabled or there
+// are snapshots).
+#define GDLLL_CONTAINER_IS_SHARED -21
+
+// 'cont_ptr' argument is NULL or it is in use by another incremental operation
+// (or by the same operation on another container).
+#define GDLLL_CONTINUATION_IS_INVALID -22
+
+// The element can't be added because the memory limit of the container would
+// be exceeded and no element could be evicted (see gdlll_set_memory_limit()).
+#define GDLLL_MEMORY_LIMIT_IS_REACHED -23
+
 // This is used only for initializing error variables.
 #define GDLLL_ERROR_INIT_VALUE -99
 
+// Payloads of up to these many bytes are stored inside the element itself (just
+// after 'struct element' in the same memory block) instead of in a separate
+// heap allocation. 'data_ptr' points to the stored payload in both cases, so
+// the users of this library don't need to know where the payload is stored.
+// The memory block of an element with a bigger payload has no room for inline
+// data (so it is not bigger than it needs to be).
+#define GDLLL_INLINE_DATA_SIZE 24
+
+// What the add functions do when a container in ring mode is full (see
+// gdlll_enable_ring_mode()).
+//
+// GDLLL_RING_REJECT_WHEN_FULL: Return GDLLL_CONTAINER_IS_FULL.
+//
+// GDLLL_RING_OVERWRITE_OLDEST_WHEN_FULL: Delete the first element of the list
+// (the oldest one for a queue) and reuse its slot.
+#define GDLLL_RING_REJECT_WHEN_FULL 1
+#define GDLLL_RING_OVERWRITE_OLDEST_WHEN_FULL 2
+
+// The memory of an arena is not bound to any NUMA node (see
+// gdlll_enable_arena_mode()).
+#define GDLLL_NO_NUMA_NODE -1
+
+// In arena mode, the payloads of up to these many bytes are also allocated
+// from the arena.
+#define GDLLL_ARENA_MAX_PAYLOAD_SIZE 4096
+
+// Search strategies for the gdlll_*_matching_element_using_strategy functions.
+//
+// GDLLL_SEARCH_FORWARD: Scan from the first element to the last element. This
+// is what gdlll_peek_matching_element(), etc. do.
+//
+// GDLLL_SEARCH_BACKWARD: Scan from the last element to the first element. Use
+// it for recency-ordered lists (recent elements added to back). If there are
+// many matching elements then the last one is found.
+//
+// GDLLL_SEARCH_FROM_BOTH_ENDS: Scan from both ends towards the middle.
+//
+// GDLLL_SEARCH_SORTED_ASCENDING, GDLLL_SEARCH_SORTED_DESCENDING: The list must
+// be sorted in ascending/descending order (with the same comparator). The
+// search returns NULL at once if the key is beyond the last element and stops
+// as soon as it passes the key. It starts from the element that was inserted
+// last by a gdlll_add_element_sorted_* function (if there is one) and scans in
+// the right direction. If there are many matching elements then the first one
+// is found.
+#define GDLLL_SEARCH_FORWARD           1
+#define GDLLL_SEARCH_BACKWARD          2
+#define GDLLL_SEARCH_FROM_BOTH_ENDS    3
+#define GDLLL_SEARCH_SORTED_ASCENDING  4
+#define GDLLL_SEARCH_SORTED_DESCENDING 5
+
+struct gdll_order_node;
+struct gdll_element_extension;
+struct gdll_snapshot;
+struct gdll_async_deleter;
+struct gdll_arena_region;
+struct gdll_continuation;
+struct gdll_container;
+
 struct element
 {
+    // Points to the copy of the user's data. This may point inside the memory
+    // block of the element itself (see GDLLL_INLINE_DATA_SIZE), so the user
+    // should never free or reallocate 'data_ptr'.
     void *data_ptr;
     long data_size;
     struct element *prev;
     struct element *next;
+    // Used internally by the library, the user should not modify it. This is
+    // the state of this element that only some features need (NULL if no such
+    // feature has needed it yet).
+    struct gdll_element_extension *extension;
+    // Used internally by the library, the user should not modify it (for
+    // example, it tells whether the element is a tombstone, see
+    // gdlll_enable_lazy_deletion()).
+    unsigned int flags;
+    // Used internally by the library, the user should not modify it. This is
+    // the version of the newest snapshot that has the element (0 if no
+    // snapshot has it, see gdlll_take_snapshot()).
+    unsigned int snapshot_version;
 };
 
 /*
@@ -73,11 +210,139 @@ struct element
 typedef int (*compare_elements_function)(struct element *first,
                                          struct element *second);
 
+/*
+ * The user may give a function pointer to choose the element to evict when the
+ * memory limit of a container is reached (see gdlll_set_memory_limit()). Below
+ * is the signature of the eviction policy function.
+ *
+ * The return value of this function should be an element in the list of the
+ * container, or NULL if no element should be evicted (then the element being
+ * added is rejected).
+ */
+typedef struct element *(*choose_element_to_evict_function)(
+                                            struct gdll_container *gdllc_ptr);
+
 struct gdll_container
 {
     struct element *first;
     struct element *last;
     long total_number_of_elements;
+    // The element that was inserted last by a gdlll_add_element_sorted_*
+    // function. The gdlll_add_element_sorted_*_near_hint functions start
+    // scanning from here when the user doesn't give a hint. If this element
+    // is removed from the list then a neighbor of it becomes the finger.
+    struct element *sorted_insertion_finger;
+    // Integer key index (see gdlll_enable_integer_key_index()). The key of the
+    // element 'integer_key_elems[i]' is 'integer_keys[i]'. The elements are
+    // not in list order in these arrays. If 'integer_key_index_is_stale' is 1
+    // then these arrays are not up to date and will be rebuilt from the list
+    // by the next search.
+    int integer_key_index_enabled;
+    int integer_key_index_is_stale;
+    long *integer_keys;
+    struct element **integer_key_elems;
+    long integer_key_index_size;
+    long integer_key_index_capacity;
+    // Lazy deletion (see gdlll_enable_lazy_deletion()). 'number_of_tombstones'
+    // is the number of deleted elements that have not been freed yet. Some of
+    // them are still in the list and the others are in 'tombstone_list' (linked
+    // by 'next'). The tombstones are not counted in 'total_number_of_elements'.
+    int lazy_deletion_enabled;
+    int tombstone_purge_threshold_percent;
+    long number_of_tombstones;
+    struct element *tombstone_list;
+    // Epoch based reclamation (see gdlll_enable_epoch_reclamation()).
+    // 'epoch_reader_slots' has one slot (on its own cache line) per reader. An
+    // element deleted in epoch 'e' is kept in 'epoch_retired_lists[e % 3]'
+    // (linked by 'prev') until no reader can be using it.
+    int epoch_reclamation_enabled;
+    int epoch_max_readers;
+    unsigned long global_epoch;
+    unsigned long *epoch_reader_slots;
+    struct element *epoch_retired_lists[3];
+    long epoch_number_of_retired_elements;
+    long epoch_retired_since_last_reclaim;
+    // Priority queue mode (see gdlll_enable_priority_queue_mode()). 'heap' is
+    // a 4-ary min-heap (as per 'priority_queue_comp_func') of the elements in
+    // the list. If 'heap_is_stale' is 1 then 'heap' is not up to date and will
+    // be rebuilt from the list (in O(n)) by the next peek/get of the minimum.
+    int priority_queue_enabled;
+    int heap_is_stale;
+    compare_elements_function priority_queue_comp_func;
+    struct element **heap;
+    long heap_size;
+    long heap_capacity;
+    // Ring mode (see gdlll_enable_ring_mode()). 'ring_slots' is one memory
+    // block of 'ring_capacity' elements (every element has room for
+    // 'ring_max_data_size' bytes of data). The free slots are linked by 'next'
+    // in 'ring_free_list'. The slots of a ring that has been disabled while
+    // some of them were still in use (see gdlll_disable_ring_mode()) are
+    // 'ring_disabled_slots' ('ring_disabled_slots_size' bytes), and they are
+    // freed when 'ring_disabled_number_of_slots_in_use' becomes 0.
+    long ring_capacity;
+    long ring_max_data_size;
+    long ring_slot_size;
+    int ring_when_full;
+    char *ring_slots;
+    struct element *ring_free_list;
+    long ring_number_of_free_slots;
+    char *ring_disabled_slots;
+    long ring_disabled_slots_size;
+    long ring_disabled_number_of_slots_in_use;
+    // Order statistic index (see gdlll_enable_order_statistic_index()).
+    // 'order_root' is the root of a treap of the elements in list order. If
+    // 'order_statistic_index_is_stale' is 1 then there are no nodes and the
+    // treap will be rebuilt from the list by the next positional access.
+    int order_statistic_index_enabled;
+    int order_statistic_index_is_stale;
+    struct gdll_order_node *order_root;
+    unsigned long order_random_state;
+    // Snapshots (see gdlll_take_snapshot()). 'snapshots' is the list of the
+    // snapshots that have not been freed yet (linked by 'next'). No snapshot
+    // older than 'oldest_snapshot_version_in_use' is in use. An element that
+    // has been deleted while a snapshot had it is kept in
+    // 'snapshot_retired_list' (linked by 'prev') until the snapshot is
+    // released.
+    struct gdll_snapshot *snapshots;
+    unsigned int snapshot_version;
+    unsigned int oldest_snapshot_version_in_use;
+    struct element *snapshot_retired_list;
+    long snapshot_number_of_retired_elements;
+    long snapshot_retired_since_last_reclaim;
+    // The reclaimer thread (see gdlll_enable_async_deletion()), NULL if
+    // asynchronous deletion is not enabled.
+    struct gdll_async_deleter *async_deleter;
+    // 1 if the elements are recycled through the node cache of the thread
+    // (see gdlll_enable_node_cache()).
+    int node_cache_enabled;
+    // Arena mode (see gdlll_enable_arena_mode()). 'arena_regions' is the list
+    // of the regions of the arena (the newest first). The free blocks
+    // (element blocks and payload blocks) of every size (a multiple of 16
+    // bytes) are linked by their first pointer in an array of lists,
+    // 'arena_free_blocks'. The blocks of the newest region from
+    // 'arena_next_free_block' to 'arena_end' have not been used yet.
+    int arena_mode_enabled;
+    int arena_numa_node;
+    struct gdll_arena_region *arena_regions;
+    long arena_number_of_regions;
+    long arena_number_of_blocks_in_use;
+    void **arena_free_blocks;
+    char *arena_next_free_block;
+    char *arena_end;
+    // Relayout (see gdlll_relayout_container_incrementally()). If a pass is in
+    // progress then 'relayout_next_element' is the next element to be moved
+    // (NULL if the pass has reached the end of the list).
+    int relayout_in_progress;
+    struct element *relayout_next_element;
+    // The continuations of the incremental operations in progress on this
+    // container (see struct gdll_continuation), linked by 'next'.
+    struct gdll_continuation *continuations;
+    // Memory accounting (see gdlll_set_memory_limit()). 'memory_in_use' is the
+    // number of bytes of the elements in the list. 'memory_limit' is 0 if
+    // there is no limit.
+    long memory_in_use;
+    long memory_limit;
+    choose_element_to_evict_function choose_element_to_evict;
     // This function pointer will be called before freeing 'data_ptr' member of
     // the element structure. This will be needed if the user has allocated some
     // memory in 'data_ptr' and the user wants to free it before the 'data_ptr'
@@ -110,6 +375,77 @@ int gdlll_add_element_sorted_descending(struct gdll_container *gdllc_ptr,
                                         void *data_ptr, long data_size,
                                         compare_elements_function comp_func);
 
+// These functions are same as gdlll_add_element_sorted_ascending() and
+// gdlll_add_element_sorted_descending() except that the scan for the insertion
+// point doesn't start from the first element. The 'last' element is checked
+// first (so appending in sorted order is O(1)) and then the scan starts from
+// 'hint_elem_ptr' in the right direction. If 'hint_elem_ptr' is NULL then the
+// scan starts from the element that was inserted last by a
+// gdlll_add_element_sorted_* function ('sorted_insertion_finger'). So,
+// nearly-sorted or time-ordered insertion runs in amortized O(1).
+//
+// 'hint_elem_ptr' (if not NULL) must be an element that is in the list of this
+// container (for example, an element returned by a gdlll_peek_* function).
+int gdlll_add_element_sorted_ascending_near_hint(
+                                        struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        struct element *hint_elem_ptr);
+
+int gdlll_add_element_sorted_descending_near_hint(
+                                        struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        struct element *hint_elem_ptr);
+
+// This function allocates a standalone element (an element that is not in any
+// list) with 'data_size' bytes of data and returns it. The data of the element
+// is not initialized, so the user can build the data directly in
+// 'data_ptr' of the element (instead of building it somewhere else and then
+// letting the library copy it). The element can then be added to the list by
+// calling gdlll_insert_standalone_element_before_element(), or it can be
+// deleted by calling gdlll_delete_standalone_element(). If there is no memory
+// (or any argument is invalid) then NULL is returned.
+struct element *gdlll_allocate_standalone_element(
+                                            struct gdll_container *gdllc_ptr,
+                                            long data_size);
+
+// This function inserts a standalone element (for example, an element
+// returned by gdlll_allocate_standalone_element() or by a gdlll_get_*
+// function) in the list before 'elem_before_which_to_insert_ptr'. If
+// 'elem_before_which_to_insert_ptr' is NULL then the element is added to the
+// back of the list. 'elem_before_which_to_insert_ptr' (if not NULL) must be an
+// element that is in the list of this container. If there is no memory for
+// the indexes of this container then GDLLL_NO_MEMORY is returned (and the
+// element remains standalone).
+int gdlll_insert_standalone_element_before_element(
+                                struct gdll_container *gdllc_ptr,
+                                struct element *elem_to_insert_ptr,
+                                struct element *elem_before_which_to_insert_ptr);
+
+// The gdlll_emplace_* functions add an element with 'data_size' bytes of
+// uninitialized data to the list and return 'data_ptr' of the element. The
+// user then builds the data directly in the returned memory. So, there is no
+// need to build the data in a temporary buffer and have the library copy it.
+// The data must be filled in before any other function is called on the
+// container (the comparators and 'call_function_before_deleting_data' will see
+// the data). gdlll_emplace_element_to_front() and
+// gdlll_emplace_element_to_back() return NULL if there is no memory (or any
+// argument is invalid).
+void *gdlll_emplace_element_to_front(struct gdll_container *gdllc_ptr,
+                                     long data_size);
+
+void *gdlll_emplace_element_to_back(struct gdll_container *gdllc_ptr,
+                                    long data_size);
+
+// This function adds 'num_elements' elements (each with 'data_size' bytes of
+// uninitialized data) to the back of the list and stores their 'data_ptr' in
+// 'data_ptrs' (which must have room for 'num_elements' pointers). Either all
+// elements are added or (if there is no memory) none is added.
+int gdlll_emplace_elements_to_back(struct gdll_container *gdllc_ptr,
+                                   long data_size, long num_elements,
+                                   void **data_ptrs);
+
 // All gdlll_get_* functions remove the element from the list and then return
 // the element. If you don't want the element to be removed from the list then
 // use gdlll_peek_* functions. If there are no elements in the container
@@ -122,6 +458,19 @@ struct element *gdlll_get_matching_element(struct gdll_container *gdllc_ptr,
                                            void *data_ptr, long data_size,
                                            compare_elements_function comp_func);
 
+struct element *gdlll_get_matching_element_using_strategy(
+                                        struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        int search_strategy);
+
+// This function removes 'elem_ptr' from the list and returns it. 'elem_ptr'
+// must be an element that is in the list of this container (for example, an
+// element returned by a gdlll_peek_* function). If any argument is NULL then
+// NULL is returned.
+struct element *gdlll_get_given_element(struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr);
+
 // All gdlll_peek_* functions return the element without removing it from the
 // list. If there are no elements in the container then NULL is returned.
 struct element *gdlll_peek_front_element(struct gdll_container *gdllc_ptr);
@@ -132,6 +481,495 @@ struct element *gdlll_peek_matching_element(struct gdll_container *gdllc_ptr,
                                             void *data_ptr, long data_size,
                                            compare_elements_function comp_func);
 
+struct element *gdlll_peek_matching_element_using_strategy(
+                                        struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        int search_strategy);
+
+// This function looks up 'num_keys' keys ('data_ptrs[i]' and 'data_sizes[i]')
+// in one traversal of the list (instead of one traversal per key). For every
+// key, the first matching element is stored in 'matching_elem_ptrs[i]' (or
+// NULL if no element matches). 'matching_elem_ptrs' must have room for
+// 'num_keys' pointers.
+int gdlll_peek_matching_elements(struct gdll_container *gdllc_ptr,
+                                 void **data_ptrs, long *data_sizes,
+                                 long num_keys,
+                                 compare_elements_function comp_func,
+                                 struct element **matching_elem_ptrs);
+
+// Integer key index.
+//
+// If the data of the elements starts with a 'long' key (like the 'long' list
+// in test_generic_doubly_linked_list_library_as_list.c), then the container can
+// keep a contiguous array of these keys (a shadow of the keys in the elements)
+// that is searched with SIMD (AVX2 or SSE4.2, chosen at runtime) instead of
+// calling a comparator on every element. The index is kept up to date by all
+// the add/remove/replace functions of this library. Elements whose data is
+// smaller than a 'long' are not in the index. The user must not change the key
+// of an element in place (use gdlll_replace_data_in_matching_element()).
+//
+// gdlll_enable_integer_key_index() builds the index from the elements already
+// in the list. It returns GDLLL_NO_MEMORY if there is no memory for the index.
+int gdlll_enable_integer_key_index(struct gdll_container *gdllc_ptr);
+
+void gdlll_disable_integer_key_index(struct gdll_container *gdllc_ptr);
+
+// This function returns an element whose key is 'key' (if there are many such
+// elements then any one of them is returned), or NULL if there is no such
+// element. If the integer key index is not enabled then NULL is returned.
+struct element *gdlll_peek_element_with_integer_key(
+                                            struct gdll_container *gdllc_ptr,
+                                            long key);
+
+// This function returns an element with the smallest key that is >= 'key', or
+// NULL if there is no such element. If the integer key index is not enabled
+// then NULL is returned.
+struct element *gdlll_peek_lower_bound_element_with_integer_key(
+                                            struct gdll_container *gdllc_ptr,
+                                            long key);
+
+// Priority queue mode.
+//
+// In priority queue mode, the container keeps a 4-ary min-heap of its elements
+// (ordered by 'comp_func'), so that:
+//
+// gdlll_add_element_to_front(), gdlll_add_element_to_back(), etc. (push) take
+// O(log n) time (plus the time to add the element to the list).
+// gdlll_peek_front_element() (peek-min) takes O(1) time and returns the element
+// with the smallest data.
+// gdlll_get_front_element() and gdlll_delete_front_element() (pop-min) remove
+// the element with the smallest data in O(log n) time.
+//
+// All the other functions work as before (for example, gdlll_get_last_element()
+// still returns the last element of the list and the list is not sorted).
+// Removing any element (gdlll_get_given_element(), etc.) takes O(log n) time.
+// The elements added by the gdlll_emplace_* functions are not in the heap
+// until the heap is rebuilt (in O(n) time) by the next peek/get of the minimum,
+// because their data is not filled in when they are added.
+//
+// gdlll_enable_priority_queue_mode() builds the heap from the elements already
+// in the list in O(n) time (heapify). It returns GDLLL_NO_MEMORY if there is no
+// memory for the heap.
+int gdlll_enable_priority_queue_mode(struct gdll_container *gdllc_ptr,
+                                     compare_elements_function comp_func);
+
+void gdlll_disable_priority_queue_mode(struct gdll_container *gdllc_ptr);
+
+// If the user changes the data of an element in place (for example, to
+// decrease the priority (key) of the element), then the user must call this
+// function so that the element is moved to its right place in the heap. This
+// takes O(log n) time.
+int gdlll_update_element_priority(struct gdll_container *gdllc_ptr,
+                                  struct element *elem_ptr);
+
+// Ring mode.
+//
+// In ring mode, the container has a fixed capacity and all its elements come
+// from one preallocated contiguous block of 'capacity' slots (every slot is an
+// element with room for 'max_data_size' bytes of data). So, the front/back
+// functions (gdlll_add_element_to_back(), gdlll_get_front_element(),
+// gdlll_delete_standalone_element(), etc.) don't call malloc() or free(), and
+// a bounded producer/consumer queue (or deque) doesn't allocate anything in
+// its steady state. All the other functions work as before.
+//
+// An element removed by a gdlll_get_* function keeps its slot until it is
+// deleted by gdlll_delete_standalone_element() (with this container), so it
+// must not be added to another container. If the data is bigger than
+// 'max_data_size' then the add functions return GDLLL_DATA_SIZE_IS_INVALID.
+// When all the slots are in use, the add functions do what 'when_full' says
+// (see GDLLL_RING_*_WHEN_FULL). With GDLLL_RING_OVERWRITE_OLDEST_WHEN_FULL,
+// any add function may delete the first element of the list, so the user must
+// not keep pointers to it. Ring mode should not be used with lazy deletion or
+// epoch based reclamation (the slots of the deleted elements are not free
+// until they are purged or reclaimed).
+//
+// gdlll_enable_ring_mode() can be called only when the container is empty
+// (otherwise GDLLL_CONTAINER_IS_NOT_EMPTY is returned). It returns
+// GDLLL_CONTAINER_IS_SHARED if the slots of the ring that the container
+// already has (or had) can't be freed yet (see gdlll_disable_ring_mode()).
+int gdlll_enable_ring_mode(struct gdll_container *gdllc_ptr, long capacity,
+                           long max_data_size, int when_full);
+
+// This function deletes all the elements in the container and then frees the
+// slots. If some slots are still in use (by the elements kept for snapshots or
+// for epoch based reclamation, or removed by gdlll_get_* functions) then the
+// slots are freed when the last of these elements is freed
+// (gdlll_delete_gdll_container() frees them in any case).
+void gdlll_disable_ring_mode(struct gdll_container *gdllc_ptr);
+
+// Positional access.
+//
+// The positions of the elements are 0 to (total_number_of_elements - 1) in list
+// order (the tombstones, see gdlll_enable_lazy_deletion(), are not counted).
+// So, in a sorted container, the position of an element is its rank.
+//
+// These functions work on any container. Without the order statistic index
+// they walk the list (O(n)). With the index (see
+// gdlll_enable_order_statistic_index()) they take O(log n) time.
+//
+// gdlll_peek_element_at_position() and gdlll_get_element_at_position() return
+// NULL if 'position' is not valid. gdlll_add_element_at_position() adds the
+// element so that it is at 'position' (0 to total_number_of_elements, the
+// latter means the back of the list). gdlll_get_position_of_element() returns
+// the position of the element or GDLLL_MATCHING_ELEMENT_NOT_FOUND if the
+// element is not in the list of this container (or another error code).
+struct element *gdlll_peek_element_at_position(struct gdll_container *gdllc_ptr,
+                                               long position);
+
+struct element *gdlll_get_element_at_position(struct gdll_container *gdllc_ptr,
+                                              long position);
+
+void gdlll_delete_element_at_position(struct gdll_container *gdllc_ptr,
+                                      long position);
+
+int gdlll_add_element_at_position(struct gdll_container *gdllc_ptr,
+                                  long position, void *data_ptr,
+                                  long data_size);
+
+long gdlll_get_position_of_element(struct gdll_container *gdllc_ptr,
+                                   struct element *elem_ptr);
+
+// Order statistic index.
+//
+// The index is a treap (a randomized balanced binary tree) of all the elements
+// in list order, where every node knows the number of nodes in its subtree. It
+// is updated by all the functions that add elements to the list or remove
+// elements from it (O(log n) expected time each), and it makes the positional
+// access functions above O(log n). The node of an element is in the extension
+// of the element (see 'extension' in struct element), which is in the memory
+// block of an element that is added while the index is enabled, so the index
+// doesn't need any allocation of its own. An element that was already in the
+// container gets its extension from malloc() when the index is enabled (or
+// rebuilt). If there is no memory for it then the index is dropped and it is
+// rebuilt from the list (in O(n log n)) by the next positional access.
+//
+// Use it for pagination ("elements 1000 to 1019") and for percentiles in
+// sorted containers (the element at position (n * p / 100)).
+int gdlll_enable_order_statistic_index(struct gdll_container *gdllc_ptr);
+
+void gdlll_disable_order_statistic_index(struct gdll_container *gdllc_ptr);
+
+// Snapshots.
+//
+// A snapshot is a frozen, point-in-time view of the elements of the container
+// (in list order) that a reader thread can read without any lock while the
+// writer keeps changing the container. Taking a snapshot doesn't copy any data:
+// the snapshot is an array of pointers to the elements (so the reader gets
+// O(1) positional access too). While an element is in a snapshot that is in
+// use, the writer doesn't change it in place or free it:
+//
+// A deleted element is only removed from the list, and it is freed when all
+// the snapshots that have it are released.
+// gdlll_replace_data_in_matching_element() puts a new element with the new
+// data in the place of the old element (copy-on-write), so only the elements
+// that are changed are copied.
+//
+// So, the user must not change the data of an element in place (or call
+// gdlll_update_element_priority()) while a snapshot may have the element. For
+// the same reason, an element that a gdlll_get_* function has removed while a
+// snapshot may have it must be deleted with gdlll_delete_standalone_element()
+// on the same container (and not added to another container).
+//
+// gdlll_take_snapshot() (O(n)) and gdlll_reclaim_snapshots() must be called
+// by the writer (like all the other functions that change the container).
+// gdlll_take_snapshot() returns NULL if there is no memory. The reader reads
+// the snapshot with gdlll_snapshot_get_total_number_of_elements() and
+// gdlll_snapshot_peek_element_at_position() (only the 'data_ptr' and
+// 'data_size' of the returned elements may be used) and then calls
+// gdlll_release_snapshot() (from any thread). The snapshot must not be used
+// after it has been released. The writer frees the released snapshots (and the
+// elements that only they were keeping) in gdlll_take_snapshot(), after every
+// few deletions, and in gdlll_reclaim_snapshots() (which returns the number of
+// elements freed). gdlll_delete_gdll_container() frees all the snapshots, so
+// they must have been released before.
+struct gdll_snapshot
+{
+    struct element **elements;
+    long total_number_of_elements;
+    unsigned int version;
+    int is_released;
+    struct gdll_snapshot *next;
+};
+
+struct gdll_snapshot *gdlll_take_snapshot(struct gdll_container *gdllc_ptr);
+
+long gdlll_snapshot_get_total_number_of_elements(
+                                        struct gdll_snapshot *snapshot_ptr);
+
+struct element *gdlll_snapshot_peek_element_at_position(
+                                        struct gdll_snapshot *snapshot_ptr,
+                                        long position);
+
+void gdlll_release_snapshot(struct gdll_snapshot *snapshot_ptr);
+
+long gdlll_reclaim_snapshots(struct gdll_container *gdllc_ptr);
+
+// Asynchronous deletion.
+//
+// When asynchronous deletion is enabled, the container has a reclaimer thread.
+// The delete functions (and gdlll_replace_data_in_matching_element()) only
+// unlink the element and push it on a lock-free stack, and the reclaimer
+// thread calls call_function_before_deleting_data() for the data and frees the
+// element. So, a slow callback (for example, one that frees a deep structure)
+// doesn't slow down the deletes. call_function_before_deleting_data() must be
+// safe to call from the reclaimer thread while the writer is using the
+// container. gdlll_replace_data_in_matching_element() puts a new element with
+// the new data in the place of the old element (so the element pointers that
+// the user has for it are not valid any more).
+//
+// gdlll_enable_async_deletion() starts the reclaimer thread (it returns
+// GDLLL_THREAD_CREATION_FAILED if the thread can't be created).
+// gdlll_flush_async_deletion() waits until all the deleted elements have been
+// freed (a barrier, for example, before checking memory usage or before
+// freeing something that the callback uses). gdlll_disable_async_deletion()
+// frees all the deleted elements and stops the reclaimer thread (it is called
+// by gdlll_delete_gdll_container()). The slots of a container in ring mode
+// are always freed by the writer.
+int gdlll_enable_async_deletion(struct gdll_container *gdllc_ptr);
+
+void gdlll_flush_async_deletion(struct gdll_container *gdllc_ptr);
+
+void gdlll_disable_async_deletion(struct gdll_container *gdllc_ptr);
+
+// Node caches.
+//
+// Every thread has a node cache (a magazine) of free element blocks and of
+// free small payload blocks. When the node cache of a container is enabled,
+// the element and payload blocks freed by a thread for the container are kept
+// in the node cache of the thread (up to a limit), and the new elements of the
+// container that the thread adds take their blocks from there. So, a thread
+// that keeps adding and deleting elements reuses the memory that it has used
+// recently (which is in its cache and on its NUMA node) instead of calling
+// malloc() and free() (and contending for the locks of the allocator) every
+// time. The small payloads (up to 256 bytes) get a block whose size is a power
+// of 2, so that the blocks can be reused for payloads of other sizes.
+//
+// The node cache of a thread is freed when the thread exits (the main thread
+// can call gdlll_free_node_cache_of_current_thread() before it exits). The
+// elements freed by the reclaimer thread (see gdlll_enable_async_deletion())
+// don't go to any node cache.
+int gdlll_enable_node_cache(struct gdll_container *gdllc_ptr);
+
+void gdlll_disable_node_cache(struct gdll_container *gdllc_ptr);
+
+void gdlll_free_node_cache_of_current_thread(void);
+
+// Arena mode.
+//
+// In arena mode, the elements of the container and their payloads (up to
+// GDLLL_ARENA_MAX_PAYLOAD_SIZE bytes) are allocated from large contiguous
+// regions (2 MB each) that belong to the container, instead of every element
+// being a separate malloc(). On Linux, every region is one 2 MB huge page
+// (from hugetlbfs if there are free huge pages, otherwise a transparent huge
+// page is asked for with madvise(), and normal pages are used if the kernel
+// can't give one), so a traversal of a very large list has far fewer TLB
+// misses. The blocks of the deleted elements are reused by the container. So,
+// the elements of a list that grows by appending are next to each other in
+// memory.
+//
+// gdlll_delete_all_elements_in_gdll_container() doesn't unlink the elements
+// one by one in arena mode (if no index, lazy deletion, epoch based
+// reclamation, snapshot or asynchronous deletion is in use), and if no block
+// of the arena is in use after that then all the regions except one are given
+// back to the system and the arena starts again from the beginning.
+//
+// If 'numa_node' is not GDLLL_NO_NUMA_NODE then the regions are bound to that
+// NUMA node (with mbind(), Linux only), so the list can be traversed from the
+// threads of that node with local memory.
+//
+// An element removed by a gdlll_get_* function keeps its block until it is
+// deleted by gdlll_delete_standalone_element() (with this container), so it
+// must not be added to another container.
+//
+// gdlll_enable_arena_mode() can be called only when the container is empty
+// (otherwise GDLLL_CONTAINER_IS_NOT_EMPTY is returned). It returns
+// GDLLL_NUMA_NODE_IS_INVALID if the memory can't be bound to 'numa_node', and
+// GDLLL_CONTAINER_IS_SHARED if the arena that the container already has can't
+// be freed yet (see gdlll_disable_arena_mode()).
+int gdlll_enable_arena_mode(struct gdll_container *gdllc_ptr, int numa_node);
+
+// This function deletes all the elements in the container and then frees the
+// regions. If some blocks of the arena are still in use (by the elements kept
+// for snapshots or for epoch based reclamation, or removed by gdlll_get_*
+// functions) then the regions are freed when the last of these elements is
+// freed (gdlll_delete_gdll_container() frees them in any case).
+void gdlll_disable_arena_mode(struct gdll_container *gdllc_ptr);
+
+// Relayout.
+//
+// A relayout moves the elements of the container (and their payloads of up to
+// GDLLL_ARENA_MAX_PAYLOAD_SIZE bytes) to new blocks of the arena, in list
+// order, so after a complete pass the elements are next to each other in memory
+// in the same order as in the list (each element followed by its payload) and
+// a traversal reads memory sequentially again. The regions of the arena that
+// have no block in use after the pass are given back to the system. The
+// container is put in arena mode (with GDLLL_NO_NUMA_NODE) if it isn't in arena
+// mode already.
+//
+// An element is moved by copying its header and payload and relinking its
+// neighbours ('first' and 'last' of the container are updated too, and so are
+// the indexes). call_function_before_deleting_data() is not called for the old
+// payload. So, the pointers to the elements in the list (for example, the ones
+// returned by the gdlll_peek_* functions) and to their data are not valid
+// after a relayout, and the data must be something that can be moved with
+// memcpy(). The elements removed by gdlll_get_* functions are not moved.
+//
+// gdlll_relayout_container_incrementally() moves at most 'max_elements'
+// elements and returns, so the work can be spread across idle periods. The
+// next call continues the same pass (the container can be modified in
+// between; the elements added in between behind the point that the pass has
+// reached are not moved in this pass). A new pass is started if no pass is in
+// progress. gdlll_relayout_container() completes the pass in progress (or does
+// a complete pass).
+//
+// These functions return GDLLL_CONTAINER_IS_SHARED if epoch based reclamation
+// is enabled or there are snapshots, and GDLLL_NO_MEMORY if a new block
+// couldn't be allocated (the elements moved till then stay where they are and
+// the pass can be continued later). A container in ring mode is not changed
+// (its slots are contiguous already).
+int gdlll_relayout_container(struct gdll_container *gdllc_ptr);
+
+int gdlll_relayout_container_incrementally(struct gdll_container *gdllc_ptr,
+                                           long max_elements);
+
+// This function returns 1 if a pass of relayout has been started and not
+// completed yet, otherwise it returns 0.
+int gdlll_relayout_is_in_progress(struct gdll_container *gdllc_ptr);
+
+// Incremental operations.
+//
+// The functions below are resumable versions of a scan, of
+// gdlll_delete_all_elements_in_gdll_container() and of a sort, for loops that
+// can't block for the time that a whole operation takes on a huge container
+// (for example, an event loop). Every call processes at most 'max_elements'
+// elements or runs for at most about 'max_microseconds' microseconds
+// (whichever comes first, 0 means no limit) and then returns
+// GDLLL_OPERATION_IS_NOT_COMPLETE. The state of the operation is kept in a
+// 'struct gdll_continuation' (the continuation token) of the user, which must
+// be initialized with gdlll_init_continuation() and given to every call of the
+// same operation. When the operation is complete, the function returns
+// GDLLL_SUCCESS (or an error) and the continuation can be used for another
+// operation.
+//
+// The container can be modified between the calls. The library keeps the
+// continuations of a container up to date when elements are removed from the
+// list (a continuation that was on a removed element goes on from the next
+// element), so a continuation never points to a freed element. An operation
+// that is not going to be completed must be cancelled with
+// gdlll_cancel_continuation() (gdlll_delete_gdll_container() cancels all the
+// operations on the container). The memory of a continuation must not be
+// freed or reused while its operation is in progress.
+struct gdll_continuation
+{
+    // Used internally by the library, the user should not modify these.
+    // 'cursors' are the elements of the list where the operation is (for
+    // example, the next element to be compared by a scan). The elements that
+    // an incremental delete has removed from the list, and not freed yet, are
+    // in 'pending_elements' (linked by 'next').
+    struct gdll_container *gdllc_ptr;
+    int operation;
+    int phase;
+    long number_of_merges;
+    struct element *cursors[3];
+    struct element *pending_elements;
+    struct gdll_continuation *prev;
+    struct gdll_continuation *next;
+};
+
+void gdlll_init_continuation(struct gdll_continuation *cont_ptr);
+
+// This function stops the operation of 'cont_ptr' (if there is one). If the
+// operation is an incremental delete then the elements that it has removed
+// from the list are freed now.
+void gdlll_cancel_continuation(struct gdll_continuation *cont_ptr);
+
+// This function scans the list forward for an element that matches 'data_ptr'
+// (like gdlll_peek_matching_element()). When the scan is complete,
+// GDLLL_SUCCESS is returned and '*matching_elem_ptr_ptr' is the matching
+// element (NULL if no element matches). Till then '*matching_elem_ptr_ptr' is
+// NULL. The same data must be given to every call of the same scan.
+int gdlll_peek_matching_element_incrementally(
+                                    struct gdll_container *gdllc_ptr,
+                                    struct gdll_continuation *cont_ptr,
+                                    void *data_ptr, long data_size,
+                                    compare_elements_function comp_func,
+                                    long max_elements, long max_microseconds,
+                                    struct element **matching_elem_ptr_ptr);
+
+// This function deletes all the elements in the container. If no index, lazy
+// deletion, epoch based reclamation, snapshot, asynchronous deletion or ring
+// mode is in use then the first call removes all the elements from the list
+// at once (so the container is empty and can be used again right away) and
+// the calls free them. Otherwise, the calls delete the elements from the
+// front of the list until the list is empty (the elements added in between
+// are deleted too).
+int gdlll_delete_all_elements_incrementally(struct gdll_container *gdllc_ptr,
+                                            struct gdll_continuation *cont_ptr,
+                                            long max_elements,
+                                            long max_microseconds);
+
+// This function sorts the list in ascending order (as per 'comp_func') with a
+// stable natural merge sort that relinks the elements (the data is not moved
+// and the elements are not reallocated). Every pass merges the adjacent
+// ascending runs of the list in pairs, and the sort is complete when a pass
+// finds only one run. If the list is modified between the calls then the sort
+// goes on and the list is sorted at the end (as long as the list stops
+// changing). The order statistic index is rebuilt by the next positional
+// access after every call. GDLLL_CONTAINER_IS_SHARED is returned if epoch
+// based reclamation is enabled (the readers don't hold a lock).
+int gdlll_sort_incrementally(struct gdll_container *gdllc_ptr,
+                             struct gdll_continuation *cont_ptr,
+                             compare_elements_function comp_func,
+                             long max_elements, long max_microseconds);
+
+// Memory accounting.
+//
+// Every container counts the bytes of the elements in its list: the element
+// itself (GDLLL_ELEMENT_HEADER_SIZE bytes) plus GDLLL_INLINE_DATA_SIZE bytes
+// for a payload that fits in the element, or 'data_size' bytes for a payload
+// that doesn't fit in the element. The count is kept up to date when the
+// elements are linked into and unlinked from the list, so it costs a few
+// additions per add and delete and is always on. The elements removed by
+// gdlll_get_* functions (and the elements waiting to be freed by epoch based
+// reclamation, snapshots or the asynchronous deleter) are not counted. The library also keeps a process wide count of the bytes of
+// the elements in the lists of all the containers. To keep it cheap, every
+// thread adds its changes to the process wide count in batches of about 64 KB,
+// so the process wide count may be off by that much per thread.
+//
+// If a container has a memory limit then the add functions (and
+// gdlll_allocate_standalone_element()) first make sure that the new element
+// fits under the limit. If it doesn't fit then the elements chosen by
+// 'evict_func' are deleted (like the gdlll_delete_* functions do) until it
+// fits. If 'evict_func' is NULL or it returns NULL (or an element that has
+// been lazily deleted already) then the add functions return
+// GDLLL_MEMORY_LIMIT_IS_REACHED (the emplace functions return NULL). So, the
+// pointers to the elements in the list are not valid after an add if an
+// eviction policy is set. An element that is bigger than the limit can't be
+// added. The limit is soft: the standalone elements inserted with
+// gdlll_insert_standalone_element_before_element() and the payloads made
+// bigger by gdlll_replace_data_in_matching_element() are counted but not
+// checked against the limit.
+
+// This function sets the memory limit of the container to 'max_bytes' (0 or a
+// negative value means no limit) and the eviction policy to 'evict_func'. The
+// elements already in the list are not evicted by this function.
+void gdlll_set_memory_limit(struct gdll_container *gdllc_ptr, long max_bytes,
+                            choose_element_to_evict_function evict_func);
+
+// This function returns the number of bytes of the elements in the list of the
+// container.
+long gdlll_get_memory_in_use(struct gdll_container *gdllc_ptr);
+
+// This function returns the number of bytes of the elements in the lists of
+// all the containers in the process (approximate, see above).
+long gdlll_get_global_memory_in_use(void);
+
+// An eviction policy that evicts the front element of the list (the oldest
+// element if the elements are added to the back).
+struct element *gdlll_choose_front_element_to_evict(
+                                            struct gdll_container *gdllc_ptr);
+
 int gdlll_replace_data_in_matching_element(struct gdll_container *gdllc_ptr,
                                          void *old_data_ptr, long old_data_size,
                                          void *new_data_ptr, long new_data_size,
@@ -145,13 +983,443 @@ void gdlll_delete_matching_element(struct gdll_container *gdllc_ptr,
                                    void *data_ptr, long data_size,
                                    compare_elements_function comp_func);
 
+void gdlll_delete_matching_element_using_strategy(
+                                        struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        int search_strategy);
+
+// The functions below are for using this library as a multimap/multiset. They
+// handle all the matching elements in one traversal of the list.
+
+// This function returns the number of elements that match the given data. If
+// any argument is invalid then 0 is returned.
+long gdlll_count_matching_elements(struct gdll_container *gdllc_ptr,
+                                   void *data_ptr, long data_size,
+                                   compare_elements_function comp_func);
+
+// This function is for sorted lists only. 'search_strategy' must be
+// GDLLL_SEARCH_SORTED_ASCENDING or GDLLL_SEARCH_SORTED_DESCENDING (as per the
+// sorting order of the list). All the matching elements are adjacent in a
+// sorted list, so this function stores the first matching element in
+// '*range_first_ptr' and the last matching element in '*range_last_ptr'. The
+// user can then go from '*range_first_ptr' to '*range_last_ptr' using 'next'
+// (or gdlll_peek_next_element() if lazy deletion is enabled).
+// This function returns the number of matching elements. If there are no
+// matching elements (or any argument is invalid) then 0 is returned and both
+// '*range_first_ptr' and '*range_last_ptr' are set to NULL.
+long gdlll_peek_equal_range(struct gdll_container *gdllc_ptr,
+                            void *data_ptr, long data_size,
+                            compare_elements_function comp_func,
+                            int search_strategy,
+                            struct element **range_first_ptr,
+                            struct element **range_last_ptr);
+
+// The functions below are for sorted lists only (range queries and seeking).
+// 'search_strategy' must be GDLLL_SEARCH_SORTED_ASCENDING or
+// GDLLL_SEARCH_SORTED_DESCENDING (as per the sorting order of the list). If
+// the order statistic index is enabled (see
+// gdlll_enable_order_statistic_index()) then the start of the range is found by
+// a binary search in O(log n), otherwise the list is scanned starting from
+// 'sorted_insertion_finger' (or from the first element). If any argument is
+// invalid then NULL or 0 is returned.
+
+// gdlll_peek_lower_bound_element() returns the first element that doesn't go
+// before the given data (for ascending order, the first element that is >= the
+// data), and gdlll_peek_upper_bound_element() returns the first element that
+// goes after the given data (for ascending order, the first element that is >
+// the data). NULL is returned if there is no such element. The user can then
+// walk the list from the returned element using gdlll_peek_next_element() (a
+// cursor).
+struct element *gdlll_peek_lower_bound_element(struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        int search_strategy);
+
+struct element *gdlll_peek_upper_bound_element(struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func,
+                                        int search_strategy);
+
+// The range is all the elements from the lower bound of the 'from' data up to
+// the last element that doesn't go after the 'to' data (for ascending order,
+// all the elements that are >= 'from' and <= 'to'). The scan stops as soon as
+// it passes the 'to' data.
+//
+// gdlll_peek_range() stores the first and the last element of the range in
+// '*range_first_ptr' and '*range_last_ptr' (both are set to NULL if the range
+// is empty) and returns the number of elements in the range.
+long gdlll_peek_range(struct gdll_container *gdllc_ptr,
+                      void *from_data_ptr, long from_data_size,
+                      void *to_data_ptr, long to_data_size,
+                      compare_elements_function comp_func,
+                      int search_strategy,
+                      struct element **range_first_ptr,
+                      struct element **range_last_ptr);
+
+// This function removes all the elements of the range from 'gdllc_ptr' and adds
+// them (in the same order) to the back of 'dest_gdllc_ptr'. The elements are
+// moved, not copied. If neither container has an index, lazy deletion or epoch
+// based reclamation enabled then the whole range is relinked in O(1) once it
+// has been found. 'dest_gdllc_ptr' should have the same
+// 'call_function_before_deleting_data' as 'gdllc_ptr'. The elements of a
+// container in arena mode or ring mode are freed with its arena or ring, so if
+// either container is in arena mode or ring mode (or still has elements in the
+// arena or ring of a disabled mode) then nothing is moved. If there is no
+// memory for the indexes of 'dest_gdllc_ptr', or if 'gdllc_ptr' has snapshots
+// that have not been released (see gdlll_take_snapshot()), then nothing is
+// moved either. This function returns the number of elements moved.
+long gdlll_get_range(struct gdll_container *gdllc_ptr,
+                     void *from_data_ptr, long from_data_size,
+                     void *to_data_ptr, long to_data_size,
+                     compare_elements_function comp_func,
+                     int search_strategy,
+                     struct gdll_container *dest_gdllc_ptr);
+
+// This function deletes all the elements of the range and returns the number of
+// elements deleted.
+long gdlll_delete_range(struct gdll_container *gdllc_ptr,
+                        void *from_data_ptr, long from_data_size,
+                        void *to_data_ptr, long to_data_size,
+                        compare_elements_function comp_func,
+                        int search_strategy);
+
+// This function removes all the matching elements from 'gdllc_ptr' and adds
+// them (in the same order) to the back of 'dest_gdllc_ptr'. The elements are
+// moved, not copied. 'dest_gdllc_ptr' should have the same
+// 'call_function_before_deleting_data' as 'gdllc_ptr'. If either container is
+// in arena mode or ring mode (or still has elements in the arena or ring of a
+// disabled mode), or if 'gdllc_ptr' has snapshots that have not been released,
+// then nothing is moved (see gdlll_get_range()). If there is no memory for the
+// indexes of 'dest_gdllc_ptr' then the elements that have not been moved yet
+// stay in 'gdllc_ptr'. This function returns the number of elements moved. If
+// any argument is invalid then 0 is returned.
+long gdlll_get_all_matching_elements(struct gdll_container *gdllc_ptr,
+                                     void *data_ptr, long data_size,
+                                     compare_elements_function comp_func,
+                                     struct gdll_container *dest_gdllc_ptr);
+
+// This function deletes all the matching elements and returns the number of
+// elements deleted. If any argument is invalid then 0 is returned.
+long gdlll_delete_all_matching_elements(struct gdll_container *gdllc_ptr,
+                                        void *data_ptr, long data_size,
+                                        compare_elements_function comp_func);
+
 void gdlll_delete_standalone_element(struct gdll_container *gdllc_ptr,
                                      struct element *element_to_delete);
 
+// Lazy deletion.
+//
+// When lazy deletion is enabled, the gdlll_delete_* functions don't unlink and
+// free the element right away. The element is only marked as a tombstone
+// (constant time, no call to free()), and it is skipped by all the peek, get,
+// search, count and delete functions of this library. The tombstones are then
+// unlinked and freed in one batch (this is when
+// 'call_function_before_deleting_data' is called for them) by
+// gdlll_purge_tombstones(), or automatically when the tombstones become
+// 'dead_ratio_threshold_percent' percent (1 to 100) of all the elements
+// (tombstones + live elements). If 'dead_ratio_threshold_percent' is 0 then
+// the tombstones are purged only when the user calls gdlll_purge_tombstones().
+// The first and the last elements of the list are never tombstones.
+//
+// Since tombstones stay in the list, the user must walk the list using
+// gdlll_peek_next_element() and gdlll_peek_prev_element() (instead of 'next'
+// and 'prev') when lazy deletion is enabled. gdlll_enable_lazy_deletion()
+// returns GDLLL_PERCENT_IS_INVALID if 'dead_ratio_threshold_percent' is not
+// in the range 0 to 100.
+int gdlll_enable_lazy_deletion(struct gdll_container *gdllc_ptr,
+                               int dead_ratio_threshold_percent);
+
+// This function purges all the tombstones and then disables lazy deletion.
+void gdlll_disable_lazy_deletion(struct gdll_container *gdllc_ptr);
+
+// This function unlinks and frees all the tombstones and returns the number of
+// tombstones freed.
+long gdlll_purge_tombstones(struct gdll_container *gdllc_ptr);
+
+// These functions return the element after (or before) 'elem_ptr' in the list,
+// skipping tombstones, or NULL if there is no such element.
+struct element *gdlll_peek_next_element(struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr);
+
+struct element *gdlll_peek_prev_element(struct gdll_container *gdllc_ptr,
+                                        struct element *elem_ptr);
+
+// Epoch based reclamation.
+//
+// This lets reader threads peek at the elements without holding a lock while
+// one writer thread changes the container. A reader calls
+// gdlll_epoch_read_lock() before peeking and gdlll_epoch_read_unlock() after it
+// is done with the peeked elements. When epoch based reclamation is enabled,
+// the elements deleted by the writer are not freed (and
+// 'call_function_before_deleting_data' is not called for them) until all the
+// readers that may be using them have called gdlll_epoch_read_unlock(). So,
+// the elements peeked inside a read section remain valid until the end of the
+// read section. A deleted element keeps its 'next', so a reader that is on a
+// deleted element can still go forward in the list.
+//
+// Inside a read section, a reader may only call gdlll_peek_front_element(),
+// gdlll_peek_next_element() and gdlll_peek_matching_element(), and only when
+// the integer key index and lazy deletion are not enabled. All the other
+// functions change the container or its indexes, so they must be called by one
+// thread at a time (the writers must still be serialized by the user).
+// gdlll_replace_data_in_matching_element() changes the data of the element in
+// place, so it must not be called while a reader may be using that element.
+// Every reader thread uses its own 'reader_id' from 0 to ('max_readers' - 1).
+//
+// The retired elements are freed in batches by the writer (while it deletes
+// elements), or by calling gdlll_epoch_reclaim(). gdlll_epoch_reclaim()
+// returns the number of elements freed. gdlll_disable_epoch_reclamation()
+// frees all the retired elements, so it must be called only when no reader is
+// in a read section.
+int gdlll_enable_epoch_reclamation(struct gdll_container *gdllc_ptr,
+                                   int max_readers);
+
+void gdlll_disable_epoch_reclamation(struct gdll_container *gdllc_ptr);
+
+int gdlll_epoch_read_lock(struct gdll_container *gdllc_ptr, int reader_id);
+
+void gdlll_epoch_read_unlock(struct gdll_container *gdllc_ptr, int reader_id);
+
+long gdlll_epoch_reclaim(struct gdll_container *gdllc_ptr);
+
 void gdlll_delete_all_elements_in_gdll_container(
                                             struct gdll_container *gdllc_ptr);
 
 void gdlll_delete_gdll_container(struct gdll_container *gdllc_ptr);
 
+/*
+ * Compact container.
+ *
+ * 'struct gdll_compact_container' is a compact representation of the generic
+ * doubly linked list container for containers that have less than 4G elements.
+ * The elements live in a growable array and are linked by 32-bit indices
+ * instead of pointers, and the payloads of the elements live in a growable
+ * data pool. So, an element takes only 16 bytes of overhead (instead of 32
+ * bytes plus two malloc headers in 'struct element'). Since there are no
+ * pointers inside the container, the container is trivially relocatable and
+ * serializable ('elements' array and 'data_pool' can be written out as is).
+ *
+ * The elements are referred to by their indices. An index remains valid until
+ * the element is deleted. A data pointer returned by
+ * gdlll_compact_get_data_ptr() remains valid only until the next add or delete
+ * operation on the container because the data pool may be reallocated or
+ * compacted by these operations.
+ */
+
+// This is returned by gdlll_compact_* functions when there is no element to
+// return (for example, when the container is empty).
+#define GDLLL_COMPACT_INVALID_INDEX 0xFFFFFFFFU
+
+struct compact_element
+{
+    unsigned int prev;
+    unsigned int next;
+    unsigned int data_size;
+    // Offset of the data of this element in the 'data_pool' of the container.
+    unsigned int data_offset;
+};
+
+struct gdll_compact_container
+{
+    struct compact_element *elements;
+    unsigned int elements_capacity;
+    unsigned int first;
+    unsigned int last;
+    // Deleted elements are chained through their 'next' member.
+    unsigned int free_list;
+    long total_number_of_elements;
+    unsigned char *data_pool;
+    unsigned long data_pool_used_bytes;
+    unsigned long data_pool_capacity;
+    // Bytes in 'data_pool' that belong to deleted elements. When these become
+    // too many, the data pool is compacted.
+    unsigned long data_pool_wasted_bytes;
+    // Same as 'call_function_before_deleting_data' of 'struct gdll_container'.
+    void (*call_function_before_deleting_data)(void *data_ptr);
+};
+
+struct gdll_compact_container *gdlll_compact_init_gdll_container(
+                            void *function_ptr_to_call_before_deleting_data);
+
+// If gdllcc_ptr is NULL, then this function returns 0
+long gdlll_compact_get_total_number_of_elements_in_gdll_container(
+                                    struct gdll_compact_container *gdllcc_ptr);
+
+// 'data_size' must be less than 4G.
+int gdlll_compact_add_element_to_front(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    void *data_ptr, long data_size);
+
+int gdlll_compact_add_element_to_back(struct gdll_compact_container *gdllcc_ptr,
+                                      void *data_ptr, long data_size);
+
+// All gdlll_compact_peek_* functions return the index of the element without
+// removing it from the list. If there is no such element then
+// GDLLL_COMPACT_INVALID_INDEX is returned.
+unsigned int gdlll_compact_peek_front_element(
+                                    struct gdll_compact_container *gdllcc_ptr);
+
+unsigned int gdlll_compact_peek_last_element(
+                                    struct gdll_compact_container *gdllcc_ptr);
+
+unsigned int gdlll_compact_peek_next_element(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    unsigned int index);
+
+unsigned int gdlll_compact_peek_prev_element(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    unsigned int index);
+
+// 'comp_func' is called with temporary 'struct element' objects whose
+// 'data_ptr' and 'data_size' describe the data being compared, so the same
+// comparator can be used for 'struct gdll_container' and
+// 'struct gdll_compact_container'.
+unsigned int gdlll_compact_peek_matching_element(
+                                    struct gdll_compact_container *gdllcc_ptr,
+                                    void *data_ptr, long data_size,
+                                    compare_elements_function comp_func);
+
+// If 'index' is not a valid index then NULL is returned.
+void *gdlll_compact_get_data_ptr(struct gdll_compact_container *gdllcc_ptr,
+                                 unsigned int index);
+
+// If 'index' is not a valid index then 0 is returned.
+long gdlll_compact_get_data_size(struct gdll_compact_container *gdllcc_ptr,
+                                 unsigned int index);
+
+void gdlll_compact_delete_front_element(
+                                    struct gdll_compact_container *gdllcc_ptr);
+
+void gdlll_compact_delete_last_element(
+                                    struct gdll_compact_container *gdllcc_ptr);
+
+void gdlll_compact_delete_element(struct gdll_compact_container *gdllcc_ptr,
+                                  unsigned int index);
+
+void gdlll_compact_delete_all_elements_in_gdll_container(
+                                    struct gdll_compact_container *gdllcc_ptr);
+
+void gdlll_compact_delete_gdll_container(
+                                    struct gdll_compact_container *gdllcc_ptr);
+
+/*
+ * Timer wheel.
+ *
+ * 'struct gdll_timer_wheel' is a hierarchical timer wheel for expiry workloads
+ * (timeouts, etc.). It has GDLLL_TIMER_WHEEL_LEVELS levels of
+ * GDLLL_TIMER_WHEEL_SLOTS buckets, and every bucket is a 'struct
+ * gdll_container'. Level 0 has one bucket per tick and every bucket of level
+ * 'l' covers GDLLL_TIMER_WHEEL_SLOTS times more ticks than a bucket of level
+ * 'l - 1'. A timer is added to the bucket that covers its expiry time, and as
+ * the time advances, the timers of the higher levels are moved down
+ * (cascaded) to the lower levels. So, arm, re-arm and cancel take O(1) time
+ * (instead of a sorted insert in a list) and advancing the time touches only
+ * the buckets that have expired.
+ *
+ * The timers are normal elements (the element given to the user is the
+ * handle of the timer). The timer wheel stores the expiry time and the bucket
+ * of the timer in the 'extension' of the element, in fields of their own, so
+ * an expired timer can be put in a container that has an integer key index,
+ * an order statistic index or is in priority queue mode (and it is not taken
+ * for an armed timer there).
+ *
+ * The time is in ticks (any unit chosen by the user). Timers that expire more
+ * than (GDLLL_TIMER_WHEEL_SLOTS ^ GDLLL_TIMER_WHEEL_LEVELS) - 1 ticks in the
+ * future are kept in the last level and cascaded again until they expire.
+ */
+
+#define GDLLL_TIMER_WHEEL_SLOT_BITS 6
+#define GDLLL_TIMER_WHEEL_SLOTS (1L << GDLLL_TIMER_WHEEL_SLOT_BITS)
+#define GDLLL_TIMER_WHEEL_LEVELS 4
+
+struct gdll_timer_wheel
+{
+    // GDLLL_TIMER_WHEEL_LEVELS * GDLLL_TIMER_WHEEL_SLOTS buckets. Bucket 's' of
+    // level 'l' is 'buckets[(l * GDLLL_TIMER_WHEEL_SLOTS) + s]'.
+    struct gdll_container **buckets;
+    // All the timers that expire at or before 'current_time' have been
+    // returned by gdlll_timer_wheel_advance().
+    long current_time;
+    long total_number_of_timers;
+    long number_of_timers_in_level[GDLLL_TIMER_WHEEL_LEVELS];
+    // This function pointer is called before freeing the data of a timer that
+    // is cancelled or deleted (see 'struct gdll_container').
+    void (*call_function_before_deleting_data)(void *data_ptr);
+};
+
+// This function returns NULL if there is no memory.
+struct gdll_timer_wheel *gdlll_timer_wheel_init(
+                            void *function_ptr_to_call_before_deleting_data,
+                            long start_time);
+
+long gdlll_timer_wheel_get_total_number_of_timers(
+                                        struct gdll_timer_wheel *gdlltw_ptr);
+
+// This function adds a timer that expires at 'expiry_time' (with a copy of the
+// user's data) and returns the element of the timer, or NULL if there is no
+// memory (or any argument is invalid). If 'expiry_time' is not after the
+// current time then the timer expires at the next call to
+// gdlll_timer_wheel_advance().
+struct element *gdlll_timer_wheel_arm(struct gdll_timer_wheel *gdlltw_ptr,
+                                      void *data_ptr, long data_size,
+                                      long expiry_time);
+
+// This function arms a standalone element (for example, an expired timer that
+// the user has removed from the container of expired timers) as a timer that
+// expires at 'expiry_time'. GDLLL_NO_MEMORY is returned if there is no memory.
+int gdlll_timer_wheel_arm_element(struct gdll_timer_wheel *gdlltw_ptr,
+                                  struct element *elem_ptr, long expiry_time);
+
+// This function changes the expiry time of an armed timer.
+int gdlll_timer_wheel_rearm(struct gdll_timer_wheel *gdlltw_ptr,
+                            struct element *elem_ptr, long expiry_time);
+
+// This function removes an armed timer from the timer wheel and deletes it.
+int gdlll_timer_wheel_cancel(struct gdll_timer_wheel *gdlltw_ptr,
+                             struct element *elem_ptr);
+
+// This function returns the expiry time of an armed timer.
+long gdlll_timer_wheel_get_expiry_time(struct element *elem_ptr);
+
+// This function advances the current time of the timer wheel to 'time' and
+// moves all the timers that expire at or before 'time' to the back of
+// 'expired_gdllc_ptr' (in the order of their expiry times). The elements are
+// moved, not copied, so 'expired_gdllc_ptr' should have the same
+// 'call_function_before_deleting_data' as the timer wheel. This function
+// returns the number of expired timers. If there is no memory for the indexes
+// of 'expired_gdllc_ptr' then the time is advanced only up to the tick whose
+// timers could not be moved (they are moved by the next call). If any argument
+// is invalid (or 'time' is before the current time) then 0 is returned.
+long gdlll_timer_wheel_advance(struct gdll_timer_wheel *gdlltw_ptr, long time,
+                               struct gdll_container *expired_gdllc_ptr);
+
+void gdlll_timer_wheel_delete(struct gdll_timer_wheel *gdlltw_ptr);
+
+#if defined(GDLLL_FAULT_INJECTION)
+
+// Allocation failure injection (only when the library is built with
+// GDLLL_FAULT_INJECTION, for fuzzing and testing the GDLLL_NO_MEMORY paths).
+//
+// After 'num_allocations_to_succeed' more element or payload blocks (or
+// extensions, snapshots or index arrays) have been allocated by this thread,
+// the next 'num_allocations_to_fail' allocations of this thread fail as if
+// there were no memory (a negative 'num_allocations_to_fail' means that all of
+// them fail). The blocks taken from the free slots of a ring don't count (they
+// aren't allocated). Calling this function with 0 and 0 stops the injection.
+// The setting is per thread, so the threads of a stress test don't disturb
+// each other.
+void gdlll_inject_allocation_failures(long num_allocations_to_succeed,
+                                      long num_allocations_to_fail);
+
+// This function returns the number of allocations that have been failed by
+// this thread since the last call of gdlll_inject_allocation_failures().
+long gdlll_get_number_of_injected_failures(void);
+
 #endif
 
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,622 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+#ifndef _GENERIC_DOUBLY_LINKED_LIST_LIBRARY_HPP_
+#define _GENERIC_DOUBLY_LINKED_LIST_LIBRARY_HPP_
+
+/*
+ * C++ wrapper.
+ *
+ * gdll::list<T> owns a 'struct gdll_container' and deletes it (and all its
+ * elements) in its destructor. The objects are constructed directly in the
+ * data of the elements (see gdlll_allocate_standalone_element()), so emplace
+ * doesn't make any extra copy, and they are destroyed (their destructors are
+ * called) when the elements are deleted.
+ *
+ * gdll::list<T>::iterator is a bidirectional iterator, so gdll::list<T> can be
+ * used with <algorithm> functions that need bidirectional iterators.
+ *
+ * gdll::element_handle<T> is a move-only owner of an element that has been
+ * removed from the list (the gdlll_get_* functions). The element is deleted
+ * when the handle is destroyed, so the user doesn't need to call
+ * gdlll_delete_standalone_element(). A handle must not outlive the list that it
+ * came from.
+ *
+ * The library may move the data of the elements in memory with memmove(), so
+ * only use the library functions that move data (for example,
+ * gdlll_replace_data_in_matching_element() and gdlll_relayout_container()) on
+ * the native container if T is trivially copyable.
+ *
+ * With C++20, gdll::incremental_operation is a coroutine that does an
+ * incremental operation of the library (see struct gdll_continuation) one
+ * budgeted slice at a time, so a coroutine of an event loop can interleave it
+ * with I/O:
+ *
+ *     gdll::incremental_operation op =
+ *                 gdll::delete_all_elements_incrementally(gdllc_ptr, 0, 200);
+ *     while (op.resume()) {
+ *         co_await next_iteration_of_event_loop();
+ *     }
+ *     // op.status() is the return value of the last call
+ *
+ * The operation is cancelled (gdlll_cancel_continuation()) if the
+ * incremental_operation is destroyed before the operation is complete.
+ */
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#include <coroutine>
+#include <exception>
+#define GDLLL_HAS_COROUTINES 1
+#endif
+
+namespace gdll {
+
+template <typename T>
+class list;
+
+template <typename T>
+class element_handle
+{
+
+public:
+
+    element_handle() noexcept : gdllc_ptr_(nullptr), elem_ptr_(nullptr) {}
+
+    element_handle(element_handle &&other) noexcept
+        : gdllc_ptr_(other.gdllc_ptr_), elem_ptr_(other.elem_ptr_)
+    {
+        other.gdllc_ptr_ = nullptr;
+        other.elem_ptr_ = nullptr;
+    }
+
+    element_handle &operator=(element_handle &&other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            gdllc_ptr_ = other.gdllc_ptr_;
+            elem_ptr_ = other.elem_ptr_;
+            other.gdllc_ptr_ = nullptr;
+            other.elem_ptr_ = nullptr;
+        }
+        return *this;
+    }
+
+    element_handle(const element_handle &) = delete;
+    element_handle &operator=(const element_handle &) = delete;
+
+    ~element_handle() { reset(); }
+
+    explicit operator bool() const noexcept { return elem_ptr_ != nullptr; }
+
+    T &operator*() const { return *static_cast<T *>(elem_ptr_->data_ptr); }
+
+    T *operator->() const { return static_cast<T *>(elem_ptr_->data_ptr); }
+
+    T *get() const noexcept
+    {
+        return elem_ptr_ ? static_cast<T *>(elem_ptr_->data_ptr) : nullptr;
+    }
+
+    // Destroys the object and deletes the element (if there is one).
+    void reset() noexcept
+    {
+        if (elem_ptr_) {
+            static_cast<T *>(elem_ptr_->data_ptr)->~T();
+            gdlll_delete_standalone_element(gdllc_ptr_, elem_ptr_);
+        }
+        gdllc_ptr_ = nullptr;
+        elem_ptr_ = nullptr;
+    }
+
+private:
+
+    friend class list<T>;
+
+    element_handle(struct gdll_container *gdllc_ptr,
+                   struct element *elem_ptr) noexcept
+        : gdllc_ptr_(gdllc_ptr), elem_ptr_(elem_ptr) {}
+
+    struct gdll_container *gdllc_ptr_;
+    struct element *elem_ptr_;
+
+}; // end of class element_handle
+
+template <typename T>
+class list
+{
+
+    // The inline data of an element is aligned to 16 bytes.
+    static_assert(alignof(T) <= 16, "gdll::list<T>: alignment of T is > 16");
+
+    template <typename U>
+    class basic_iterator
+    {
+
+    public:
+
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef U *pointer;
+        typedef U &reference;
+
+        basic_iterator() noexcept : gdllc_ptr_(nullptr), elem_ptr_(nullptr) {}
+
+        // iterator converts to const_iterator
+        operator basic_iterator<const U>() const noexcept
+        {
+            return basic_iterator<const U>(gdllc_ptr_, elem_ptr_);
+        }
+
+        reference operator*() const
+        {
+            return *static_cast<U *>(elem_ptr_->data_ptr);
+        }
+
+        pointer operator->() const
+        {
+            return static_cast<U *>(elem_ptr_->data_ptr);
+        }
+
+        // tombstones (see gdlll_enable_lazy_deletion()) are skipped
+        basic_iterator &operator++() noexcept
+        {
+            elem_ptr_ = gdlll_peek_next_element(gdllc_ptr_, elem_ptr_);
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept
+        {
+            basic_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        // decrementing end() gives the last element
+        basic_iterator &operator--() noexcept
+        {
+            if (elem_ptr_) {
+                elem_ptr_ = gdlll_peek_prev_element(gdllc_ptr_, elem_ptr_);
+            } else {
+                elem_ptr_ = gdllc_ptr_->last;
+            }
+            return *this;
+        }
+
+        basic_iterator operator--(int) noexcept
+        {
+            basic_iterator temp = *this;
+            --(*this);
+            return temp;
+        }
+
+        bool operator==(const basic_iterator &other) const noexcept
+        {
+            return elem_ptr_ == other.elem_ptr_;
+        }
+
+        bool operator!=(const basic_iterator &other) const noexcept
+        {
+            return elem_ptr_ != other.elem_ptr_;
+        }
+
+        struct element *native_handle() const noexcept { return elem_ptr_; }
+
+    private:
+
+        friend class list<T>;
+
+        basic_iterator(struct gdll_container *gdllc_ptr,
+                       struct element *elem_ptr) noexcept
+            : gdllc_ptr_(gdllc_ptr), elem_ptr_(elem_ptr) {}
+
+        struct gdll_container *gdllc_ptr_;
+        struct element *elem_ptr_;
+
+    }; // end of class basic_iterator
+
+public:
+
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T &reference;
+    typedef const T &const_reference;
+    typedef basic_iterator<T> iterator;
+    typedef basic_iterator<const T> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    // The objects are destroyed by this class itself, so the container
+    // doesn't need a function to call before deleting data.
+    list() : gdllc_ptr_(gdlll_init_gdll_container(nullptr))
+    {
+        if (!gdllc_ptr_) {
+            throw std::bad_alloc();
+        }
+    }
+
+    list(list &&other) noexcept : gdllc_ptr_(other.gdllc_ptr_)
+    {
+        other.gdllc_ptr_ = nullptr;
+    }
+
+    list &operator=(list &&other) noexcept
+    {
+        if (this != &other) {
+            destroy();
+            gdllc_ptr_ = other.gdllc_ptr_;
+            other.gdllc_ptr_ = nullptr;
+        }
+        return *this;
+    }
+
+    list(const list &) = delete;
+    list &operator=(const list &) = delete;
+
+    ~list() { destroy(); }
+
+    // A moved-from list has no container and behaves as an empty list.
+    size_type size() const noexcept
+    {
+        return static_cast<size_type>(
+                gdlll_get_total_number_of_elements_in_gdll_container(
+                                                                gdllc_ptr_));
+    }
+
+    bool empty() const noexcept { return size() == 0; }
+
+    iterator begin() noexcept { return iterator(gdllc_ptr_, first()); }
+    iterator end() noexcept { return iterator(gdllc_ptr_, nullptr); }
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(gdllc_ptr_, first());
+    }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(gdllc_ptr_, nullptr);
+    }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    T &front() { return *begin(); }
+    const T &front() const { return *begin(); }
+    T &back() { return *(--end()); }
+    const T &back() const { return *(--end()); }
+
+    // Constructs the object directly in a new element and inserts the element
+    // before 'pos'.
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args &&... args)
+    {
+        struct element *elem_ptr =
+                gdlll_allocate_standalone_element(gdllc_ptr_, sizeof(T));
+
+        if (!elem_ptr) {
+            throw std::bad_alloc();
+        }
+
+        try {
+            ::new (elem_ptr->data_ptr) T(std::forward<Args>(args)...);
+        } catch (...) {
+            gdlll_delete_standalone_element(gdllc_ptr_, elem_ptr);
+            throw;
+        }
+
+        gdlll_insert_standalone_element_before_element(gdllc_ptr_, elem_ptr,
+                                                       pos.elem_ptr_);
+
+        return iterator(gdllc_ptr_, elem_ptr);
+    }
+
+    template <typename... Args>
+    T &emplace_front(Args &&... args)
+    {
+        return *emplace(cbegin(), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    T &emplace_back(Args &&... args)
+    {
+        return *emplace(cend(), std::forward<Args>(args)...);
+    }
+
+    void push_front(const T &value) { emplace_front(value); }
+    void push_front(T &&value) { emplace_front(std::move(value)); }
+    void push_back(const T &value) { emplace_back(value); }
+    void push_back(T &&value) { emplace_back(std::move(value)); }
+
+    // Removes the element at 'pos' from the list and returns the element as a
+    // handle (the object is not copied).
+    element_handle<T> extract(const_iterator pos) noexcept
+    {
+        return element_handle<T>(gdllc_ptr_,
+                        gdlll_get_given_element(gdllc_ptr_, pos.elem_ptr_));
+    }
+
+    // front() and back() are the ends of the list (not the smallest element
+    // in priority queue mode)
+    element_handle<T> take_front() noexcept { return extract(cbegin()); }
+
+    element_handle<T> take_back() noexcept
+    {
+        return element_handle<T>(gdllc_ptr_,
+                                 gdlll_get_last_element(gdllc_ptr_));
+    }
+
+    // Inserts the element owned by 'handle' before 'pos' (the object is not
+    // copied). 'handle' must have come from this list.
+    iterator insert(const_iterator pos, element_handle<T> &&handle)
+    {
+        struct element *elem_ptr = handle.elem_ptr_;
+
+        handle.gdllc_ptr_ = nullptr;
+        handle.elem_ptr_ = nullptr;
+
+        gdlll_insert_standalone_element_before_element(gdllc_ptr_, elem_ptr,
+                                                       pos.elem_ptr_);
+
+        return iterator(gdllc_ptr_, elem_ptr);
+    }
+
+    iterator erase(const_iterator pos) noexcept
+    {
+        iterator next(gdllc_ptr_,
+                      gdlll_peek_next_element(gdllc_ptr_, pos.elem_ptr_));
+
+        extract(pos);
+
+        return next;
+    }
+
+    void pop_front() noexcept { take_front(); }
+    void pop_back() noexcept { take_back(); }
+
+    void clear() noexcept
+    {
+        while (!empty()) {
+            pop_front();
+        }
+    }
+
+    struct gdll_container *native_handle() const noexcept
+    {
+        return gdllc_ptr_;
+    }
+
+private:
+
+    // Not gdlll_peek_front_element(), that gives the smallest element in
+    // priority queue mode. The tombstones of lazy deletion (flag 0x1) are
+    // skipped.
+    struct element *first() const noexcept
+    {
+        struct element *elem_ptr = nullptr;
+
+        if (gdllc_ptr_) {
+            elem_ptr = gdllc_ptr_->first;
+        }
+
+        while ((elem_ptr) && (elem_ptr->flags & 0x1U)) {
+            elem_ptr = elem_ptr->next;
+        }
+
+        return elem_ptr;
+    }
+
+    void destroy() noexcept
+    {
+        if (gdllc_ptr_) {
+            clear();
+            gdlll_delete_gdll_container(gdllc_ptr_);
+            gdllc_ptr_ = nullptr;
+        }
+    }
+
+    struct gdll_container *gdllc_ptr_;
+
+}; // end of class list
+
+#if defined(GDLLL_HAS_COROUTINES)
+
+class incremental_operation
+{
+
+public:
+
+    struct promise_type
+    {
+        int status_ = GDLLL_OPERATION_IS_NOT_COMPLETE;
+
+        incremental_operation get_return_object() noexcept
+        {
+            return incremental_operation(
+                std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        // nothing is done till the first resume()
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        std::suspend_always yield_value(int status) noexcept
+        {
+            status_ = status;
+            return {};
+        }
+
+        void return_value(int status) noexcept { status_ = status; }
+
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    incremental_operation(incremental_operation &&other) noexcept
+        : handle_(other.handle_)
+    {
+        other.handle_ = nullptr;
+    }
+
+    incremental_operation &operator=(incremental_operation &&other) noexcept
+    {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = other.handle_;
+            other.handle_ = nullptr;
+        }
+        return *this;
+    }
+
+    incremental_operation(const incremental_operation &) = delete;
+    incremental_operation &operator=(const incremental_operation &) = delete;
+
+    ~incremental_operation()
+    {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    // Does the next slice of the operation. Returns true if the operation is
+    // not complete yet.
+    bool resume()
+    {
+        if ((handle_) && (!handle_.done())) {
+            handle_.resume();
+        }
+        return !done();
+    }
+
+    bool done() const noexcept { return (!handle_) || handle_.done(); }
+
+    // GDLLL_OPERATION_IS_NOT_COMPLETE till the operation is complete, then
+    // GDLLL_SUCCESS or an error.
+    int status() const noexcept
+    {
+        return handle_ ? handle_.promise().status_ : GDLLL_SUCCESS;
+    }
+
+private:
+
+    explicit incremental_operation(
+                        std::coroutine_handle<promise_type> handle) noexcept
+        : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+
+}; // end of class incremental_operation
+
+// The continuation of an incremental operation, cancelled when the coroutine
+// frame that has it is destroyed.
+struct continuation_guard
+{
+    continuation_guard() noexcept { gdlll_init_continuation(&cont); }
+    ~continuation_guard() { gdlll_cancel_continuation(&cont); }
+
+    continuation_guard(const continuation_guard &) = delete;
+    continuation_guard &operator=(const continuation_guard &) = delete;
+
+    struct gdll_continuation cont;
+};
+
+// '*matching_elem_ptr_ptr' is set when the scan is complete, so it must
+// outlive the incremental_operation.
+inline incremental_operation peek_matching_element_incrementally(
+                                    struct gdll_container *gdllc_ptr,
+                                    void *data_ptr, long data_size,
+                                    compare_elements_function comp_func,
+                                    long max_elements, long max_microseconds,
+                                    struct element **matching_elem_ptr_ptr)
+{
+    continuation_guard guard;
+    int retval = GDLLL_OPERATION_IS_NOT_COMPLETE;
+
+    while ((retval = gdlll_peek_matching_element_incrementally(
+                            gdllc_ptr, &guard.cont, data_ptr, data_size,
+                            comp_func, max_elements, max_microseconds,
+                            matching_elem_ptr_ptr)) ==
+                                            GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        co_yield retval;
+    }
+
+    co_return retval;
+}
+
+// The objects of a gdll::list<T> are destroyed by the list itself, so this
+// must not be used on the container of a gdll::list<T> unless T is trivially
+// destructible.
+inline incremental_operation delete_all_elements_incrementally(
+                                    struct gdll_container *gdllc_ptr,
+                                    long max_elements, long max_microseconds)
+{
+    continuation_guard guard;
+    int retval = GDLLL_OPERATION_IS_NOT_COMPLETE;
+
+    while ((retval = gdlll_delete_all_elements_incrementally(
+                            gdllc_ptr, &guard.cont, max_elements,
+                            max_microseconds)) ==
+                                            GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        co_yield retval;
+    }
+
+    co_return retval;
+}
+
+inline incremental_operation sort_incrementally(
+                                    struct gdll_container *gdllc_ptr,
+                                    compare_elements_function comp_func,
+                                    long max_elements, long max_microseconds)
+{
+    continuation_guard guard;
+    int retval = GDLLL_OPERATION_IS_NOT_COMPLETE;
+
+    while ((retval = gdlll_sort_incrementally(gdllc_ptr, &guard.cont,
+                                              comp_func, max_elements,
+                                              max_microseconds)) ==
+                                            GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        co_yield retval;
+    }
+
+    co_return retval;
+}
+
+#endif
+
+} // end of namespace gdll
+
+#endif
+
@@ -0,0 +1,478 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+#ifndef _GENERIC_DOUBLY_LINKED_LIST_LIBRARY_TYPED_H_
+#define _GENERIC_DOUBLY_LINKED_LIST_LIBRARY_TYPED_H_
+
+/*
+ * Typed containers.
+ *
+ * This header-only layer generates a doubly linked list container that is
+ * specialized for one data type. It can be used from both C and C++. The
+ * generated container has the same operations as 'struct gdll_container' but:
+ *
+ *     - The data is stored by value inside the element (no 'data_ptr' and no
+ *       separate allocation for the data).
+ *     - The data is copied by assignment of a fixed-size type instead of
+ *       memmove() of a runtime 'data_size'.
+ *     - The comparator is a macro that is expanded inline in the sorted-insert
+ *       and matching loops instead of an indirect call through a
+ *       'compare_elements_function' pointer.
+ *
+ * The data type must be copyable by assignment and must not need a
+ * constructor/destructor (in C++ it must be trivially copyable) because the
+ * elements are allocated with calloc() and freed with free(). As in
+ * 'struct gdll_container', embedded pointers in the data can be freed by the
+ * user's function 'call_function_before_deleting_data'.
+ *
+ * Usage:
+ *
+ *     GDLLL_DEFINE_TYPED_CONTAINER(gdll_long, long,
+ *                                  GDLLL_TYPED_COMPARE_SCALARS)
+ *
+ * This defines 'struct gdll_long_element', 'struct gdll_long_container' and
+ * the functions gdll_long_init_container(), gdll_long_add_element_to_back(),
+ * gdll_long_add_element_sorted_ascending(), gdll_long_peek_matching_element(),
+ * etc. The names of the functions are the names of the gdlll_* functions with
+ * 'gdlll' replaced by the given name and '_gdll' removed (for example,
+ * gdlll_delete_gdll_container() becomes gdll_long_delete_container()).
+ *
+ * The comparator macro is called with two pointers to the data type
+ * ('const type *') and must evaluate to a negative value if the first data is
+ * less than the second data, 0 if they are equal, and a positive value if the
+ * first data is greater than the second data. For example, a map of strings
+ * to long values can be defined as:
+ *
+ *     struct strmap_entry {
+ *         char *key_str;
+ *         long val;
+ *     };
+ *
+ *     #define STRMAP_COMPARE(first, second)                                  \
+ *             strcmp((first)->key_str, (second)->key_str)
+ *
+ *     GDLLL_DEFINE_TYPED_CONTAINER(gdll_strmap, struct strmap_entry,
+ *                                  STRMAP_COMPARE)
+ */
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Comparator for scalar types (integers, floating point numbers, pointers).
+#define GDLLL_TYPED_COMPARE_SCALARS(first, second)                             \
+        ((*(first) > *(second)) - (*(first) < *(second)))
+
+// Comparator for NUL terminated strings ('char *' data).
+#define GDLLL_TYPED_COMPARE_STRINGS(first, second)                             \
+        strcmp(*(first), *(second))
+
+#define GDLLL_DEFINE_TYPED_CONTAINER(name, type, compare)                      \
+                                                                               \
+struct name##_element                                                          \
+{                                                                              \
+    type data;                                                                 \
+    struct name##_element *prev;                                               \
+    struct name##_element *next;                                               \
+};                                                                             \
+                                                                               \
+struct name##_container                                                        \
+{                                                                              \
+    struct name##_element *first;                                              \
+    struct name##_element *last;                                               \
+    long total_number_of_elements;                                             \
+    void (*call_function_before_deleting_data)(type *data_ptr);                \
+};                                                                             \
+                                                                               \
+static inline struct name##_container *name##_init_container(                  \
+                void (*function_ptr_to_call_before_deleting_data)(type *))     \
+{                                                                              \
+    struct name##_container *c_ptr =                                           \
+        (struct name##_container *)calloc(1, sizeof(struct name##_container)); \
+                                                                               \
+    if (!c_ptr) {                                                              \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    c_ptr->call_function_before_deleting_data =                                \
+                                    function_ptr_to_call_before_deleting_data; \
+                                                                               \
+    return c_ptr;                                                              \
+}                                                                              \
+                                                                               \
+static inline long name##_get_total_number_of_elements_in_container(           \
+                                        struct name##_container *c_ptr)        \
+{                                                                              \
+    if (!c_ptr) {                                                              \
+        return 0;                                                              \
+    }                                                                          \
+                                                                               \
+    return c_ptr->total_number_of_elements;                                    \
+}                                                                              \
+                                                                               \
+static inline struct name##_element *name##_create_standalone_element(         \
+                                                    const type *data_ptr)      \
+{                                                                              \
+    struct name##_element *elem_ptr =                                          \
+        (struct name##_element *)calloc(1, sizeof(struct name##_element));     \
+                                                                               \
+    if (!elem_ptr) {                                                           \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    elem_ptr->data = *data_ptr;                                                \
+                                                                               \
+    return elem_ptr;                                                           \
+}                                                                              \
+                                                                               \
+/* Inserts 'elem_ptr' before 'before_ptr' ('before_ptr' NULL means back). */   \
+static inline void name##_insert_element_before_element(                       \
+                                        struct name##_container *c_ptr,        \
+                                        struct name##_element *elem_ptr,       \
+                                        struct name##_element *before_ptr)     \
+{                                                                              \
+    if (!before_ptr) {                                                         \
+        elem_ptr->prev = c_ptr->last;                                          \
+        if (c_ptr->last) {                                                     \
+            c_ptr->last->next = elem_ptr;                                      \
+        } else {                                                               \
+            c_ptr->first = elem_ptr;                                           \
+        }                                                                      \
+        c_ptr->last = elem_ptr;                                                \
+    } else {                                                                   \
+        elem_ptr->next = before_ptr;                                           \
+        elem_ptr->prev = before_ptr->prev;                                     \
+        if (before_ptr->prev) {                                                \
+            before_ptr->prev->next = elem_ptr;                                 \
+        } else {                                                               \
+            c_ptr->first = elem_ptr;                                           \
+        }                                                                      \
+        before_ptr->prev = elem_ptr;                                           \
+    }                                                                          \
+                                                                               \
+    c_ptr->total_number_of_elements = c_ptr->total_number_of_elements + 1;     \
+}                                                                              \
+                                                                               \
+static inline void name##_remove_element_from_list(                            \
+                                        struct name##_container *c_ptr,        \
+                                        struct name##_element *elem_ptr)       \
+{                                                                              \
+    if (elem_ptr->prev) {                                                      \
+        elem_ptr->prev->next = elem_ptr->next;                                 \
+    } else {                                                                   \
+        c_ptr->first = elem_ptr->next;                                         \
+    }                                                                          \
+                                                                               \
+    if (elem_ptr->next) {                                                      \
+        elem_ptr->next->prev = elem_ptr->prev;                                 \
+    } else {                                                                   \
+        c_ptr->last = elem_ptr->prev;                                          \
+    }                                                                          \
+                                                                               \
+    elem_ptr->prev = NULL;                                                     \
+    elem_ptr->next = NULL;                                                     \
+                                                                               \
+    c_ptr->total_number_of_elements = c_ptr->total_number_of_elements - 1;     \
+}                                                                              \
+                                                                               \
+static inline int name##_add_element_to_front(struct name##_container *c_ptr,  \
+                                              const type *data_ptr)            \
+{                                                                              \
+    struct name##_element *elem_ptr = NULL;                                    \
+                                                                               \
+    if (!c_ptr) {                                                              \
+        return GDLLL_GDLLC_PTR_IS_NULL;                                        \
+    }                                                                          \
+                                                                               \
+    if (!data_ptr) {                                                           \
+        return GDLLL_DATA_PTR_IS_NULL;                                         \
+    }                                                                          \
+                                                                               \
+    elem_ptr = name##_create_standalone_element(data_ptr);                     \
+    if (!elem_ptr) {                                                           \
+        return GDLLL_NO_MEMORY;                                                \
+    }                                                                          \
+                                                                               \
+    name##_insert_element_before_element(c_ptr, elem_ptr, c_ptr->first);       \
+                                                                               \
+    return GDLLL_SUCCESS;                                                      \
+}                                                                              \
+                                                                               \
+static inline int name##_add_element_to_back(struct name##_container *c_ptr,   \
+                                             const type *data_ptr)             \
+{                                                                              \
+    struct name##_element *elem_ptr = NULL;                                    \
+                                                                               \
+    if (!c_ptr) {                                                              \
+        return GDLLL_GDLLC_PTR_IS_NULL;                                        \
+    }                                                                          \
+                                                                               \
+    if (!data_ptr) {                                                           \
+        return GDLLL_DATA_PTR_IS_NULL;                                         \
+    }                                                                          \
+                                                                               \
+    elem_ptr = name##_create_standalone_element(data_ptr);                     \
+    if (!elem_ptr) {                                                           \
+        return GDLLL_NO_MEMORY;                                                \
+    }                                                                          \
+                                                                               \
+    name##_insert_element_before_element(c_ptr, elem_ptr, NULL);               \
+                                                                               \
+    return GDLLL_SUCCESS;                                                      \
+}                                                                              \
+                                                                               \
+static inline int name##_add_element_sorted_ascending(                         \
+                                        struct name##_container *c_ptr,        \
+                                        const type *data_ptr)                  \
+{                                                                              \
+    struct name##_element *elem_ptr = NULL;                                    \
+    struct name##_element *temp = NULL;                                        \
+                                                                               \
+    if (!c_ptr) {                                                              \
+        return GDLLL_GDLLC_PTR_IS_NULL;                                        \
+    }                                                                          \
+                                                                               \
+    if (!data_ptr) {                                                           \
+        return GDLLL_DATA_PTR_IS_NULL;                                         \
+    }                                                                          \
+                                                                               \
+    elem_ptr = name##_create_standalone_element(data_ptr);                     \
+    if (!elem_ptr) {                                                           \
+        return GDLLL_NO_MEMORY;                                                \
+    }                                                                          \
+                                                                               \
+    temp = c_ptr->first;                                                       \
+    while ((temp) && (compare(&(elem_ptr->data), &(temp->data)) > 0)) {        \
+        temp = temp->next;                                                     \
+    }                                                                          \
+                                                                               \
+    name##_insert_element_before_element(c_ptr, elem_ptr, temp);               \
+                                                                               \
+    return GDLLL_SUCCESS;                                                      \
+}                                                                              \
+                                                                               \
+static inline int name##_add_element_sorted_descending(                        \
+                                        struct name##_container *c_ptr,        \
+                                        const type *data_ptr)                  \
+{                                                                              \
+    struct name##_element *elem_ptr = NULL;                                    \
+    struct name##_element *temp = NULL;                                        \
+                                                                               \
+    if (!c_ptr) {                                                              \
+        return GDLLL_GDLLC_PTR_IS_NULL;                                        \
+    }                                                                          \
+                                                                               \
+    if (!data_ptr) {                                                           \
+        return GDLLL_DATA_PTR_IS_NULL;                                         \
+    }                                                                          \
+                                                                               \
+    elem_ptr = name##_create_standalone_element(data_ptr);                     \
+    if (!elem_ptr) {                                                           \
+        return GDLLL_NO_MEMORY;                                                \
+    }                                                                          \
+                                                                               \
+    temp = c_ptr->first;                                                       \
+    while ((temp) && (compare(&(elem_ptr->data), &(temp->data)) < 0)) {        \
+        temp = temp->next;                                                     \
+    }                                                                          \
+                                                                               \
+    name##_insert_element_before_element(c_ptr, elem_ptr, temp);               \
+                                                                               \
+    return GDLLL_SUCCESS;                                                      \
+}                                                                              \
+                                                                               \
+static inline struct name##_element *name##_peek_front_element(                \
+                                        struct name##_container *c_ptr)        \
+{                                                                              \
+    if (!c_ptr) {                                                              \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    return c_ptr->first;                                                       \
+}                                                                              \
+                                                                               \
+static inline struct name##_element *name##_peek_last_element(                 \
+                                        struct name##_container *c_ptr)        \
+{                                                                              \
+    if (!c_ptr) {                                                              \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    return c_ptr->last;                                                        \
+}                                                                              \
+                                                                               \
+static inline struct name##_element *name##_peek_matching_element(             \
+                                        struct name##_container *c_ptr,        \
+                                        const type *data_ptr)                  \
+{                                                                              \
+    struct name##_element *temp = NULL;                                        \
+                                                                               \
+    if ((!c_ptr) || (!data_ptr)) {                                             \
+        return NULL;                                                           \
+    }                                                                          \
+                                                                               \
+    temp = c_ptr->first;                                                       \
+    while ((temp) && (compare(data_ptr, &(temp->data)) != 0)) {                \
+        temp = temp->next;                                                     \
+    }                                                                          \
+                                                                               \
+    return temp;                                                               \
+}                                                                              \
+                                                                               \
+static inline struct name##_element *name##_get_front_element(                 \
+                                        struct name##_container *c_ptr)        \
+{                                                                              \
+    struct name##_element *temp = name##_peek_front_element(c_ptr);            \
+                                                                               \
+    if (temp) {                                                                \
+        name##_remove_element_from_list(c_ptr, temp);                          \
+    }                                                                          \
+                                                                               \
+    return temp;                                                               \
+}                                                                              \
+                                                                               \
+static inline struct name##_element *name##_get_last_element(                  \
+                                        struct name##_container *c_ptr)        \
+{                                                                              \
+    struct name##_element *temp = name##_peek_last_element(c_ptr);             \
+                                                                               \
+    if (temp) {                                                                \
+        name##_remove_element_from_list(c_ptr, temp);                          \
+    }                                                                          \
+                                                                               \
+    return temp;                                                               \
+}                                                                              \
+                                                                               \
+static inline struct name##_element *name##_get_matching_element(              \
+                                        struct name##_container *c_ptr,        \
+                                        const type *data_ptr)                  \
+{                                                                              \
+    struct name##_element *temp =                                              \
+                            name##_peek_matching_element(c_ptr, data_ptr);     \
+                                                                               \
+    if (temp) {                                                                \
+        name##_remove_element_from_list(c_ptr, temp);                          \
+    }                                                                          \
+                                                                               \
+    return temp;                                                               \
+}                                                                              \
+                                                                               \
+static inline int name##_replace_data_in_matching_element(                     \
+                                        struct name##_container *c_ptr,        \
+                                        const type *old_data_ptr,              \
+                                        const type *new_data_ptr)              \
+{                                                                              \
+    struct name##_element *temp = NULL;                                        \
+                                                                               \
+    if (!c_ptr) {                                                              \
+        return GDLLL_GDLLC_PTR_IS_NULL;                                        \
+    }                                                                          \
+                                                                               \
+    if ((!old_data_ptr) || (!new_data_ptr)) {                                  \
+        return GDLLL_DATA_PTR_IS_NULL;                                         \
+    }                                                                          \
+                                                                               \
+    if (c_ptr->total_number_of_elements == 0) {                                \
+        return GDLLL_CONTAINER_IS_EMPTY;                                       \
+    }                                                                          \
+                                                                               \
+    temp = name##_peek_matching_element(c_ptr, old_data_ptr);                  \
+    if (!temp) {                                                               \
+        return GDLLL_MATCHING_ELEMENT_NOT_FOUND;                               \
+    }                                                                          \
+                                                                               \
+    if (c_ptr->call_function_before_deleting_data) {                           \
+        c_ptr->call_function_before_deleting_data(&(temp->data));              \
+    }                                                                          \
+                                                                               \
+    temp->data = *new_data_ptr;                                                \
+                                                                               \
+    return GDLLL_SUCCESS;                                                      \
+}                                                                              \
+                                                                               \
+static inline void name##_delete_standalone_element(                           \
+                                        struct name##_container *c_ptr,        \
+                                        struct name##_element *elem_ptr)       \
+{                                                                              \
+    if ((!c_ptr) || (!elem_ptr)) {                                             \
+        return;                                                                \
+    }                                                                          \
+                                                                               \
+    if (c_ptr->call_function_before_deleting_data) {                           \
+        c_ptr->call_function_before_deleting_data(&(elem_ptr->data));          \
+    }                                                                          \
+                                                                               \
+    free(elem_ptr);                                                            \
+}                                                                              \
+                                                                               \
+static inline void name##_delete_front_element(                                \
+                                        struct name##_container *c_ptr)        \
+{                                                                              \
+    name##_delete_standalone_element(c_ptr, name##_get_front_element(c_ptr));  \
+}                                                                              \
+                                                                               \
+static inline void name##_delete_last_element(                                 \
+                                        struct name##_container *c_ptr)        \
+{                                                                              \
+    name##_delete_standalone_element(c_ptr, name##_get_last_element(c_ptr));   \
+}                                                                              \
+                                                                               \
+static inline void name##_delete_matching_element(                             \
+                                        struct name##_container *c_ptr,        \
+                                        const type *data_ptr)                  \
+{                                                                              \
+    name##_delete_standalone_element(c_ptr,                                    \
+                            name##_get_matching_element(c_ptr, data_ptr));     \
+}                                                                              \
+                                                                               \
+static inline void name##_delete_all_elements_in_container(                    \
+                                        struct name##_container *c_ptr)        \
+{                                                                              \
+    struct name##_element *temp = NULL;                                        \
+    struct name##_element *next = NULL;                                        \
+                                                                               \
+    if (!c_ptr) {                                                              \
+        return;                                                                \
+    }                                                                          \
+                                                                               \
+    for (temp = c_ptr->first; temp != NULL; temp = next) {                     \
+        next = temp->next;                                                     \
+        name##_delete_standalone_element(c_ptr, temp);                         \
+    }                                                                          \
+                                                                               \
+    c_ptr->first = NULL;                                                       \
+    c_ptr->last = NULL;                                                        \
+    c_ptr->total_number_of_elements = 0;                                       \
+}                                                                              \
+                                                                               \
+static inline void name##_delete_container(struct name##_container *c_ptr)     \
+{                                                                              \
+    if (!c_ptr) {                                                              \
+        return;                                                                \
+    }                                                                          \
+                                                                               \
+    name##_delete_all_elements_in_container(c_ptr);                            \
+                                                                               \
+    free(c_ptr);                                                               \
+}
+
+#endif
+
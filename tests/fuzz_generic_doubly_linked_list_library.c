@@ -0,0 +1,1043 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+/*
+ * Fuzz target: every input is a sequence of gdlll_* calls (one byte for the
+ * operation and the following bytes for its arguments) that is run on one
+ * container and on a simple model of its list (arrays of keys and data sizes).
+ * After every call, the list, the data of every element and the memory count
+ * of the container are checked against the model. Some bytes turn lazy
+ * deletion, arena mode, ring mode, priority queue mode, the node cache and the
+ * indexes on and off, take snapshots, and make the next allocations of the
+ * library fail (the library must be built with -DGDLLL_FAULT_INJECTION), so
+ * that the GDLLL_NO_MEMORY paths are run too. The range and multimap
+ * functions move elements to a second container, a timer wheel moves its
+ * expired timers to the container, and a compact container is run against a
+ * model of its own.
+ *
+ * Build it with libFuzzer ("make fuzz" does this):
+ *
+ *     clang -g -O1 -DGDLLL_FAULT_INJECTION \
+ *           -fsanitize=fuzzer,address,undefined \
+ *           tests/fuzz_generic_doubly_linked_list_library.c \
+ *           generic_doubly_linked_list_library.c -I. -pthread
+ *
+ * or with -DGDLLL_FUZZ_STANDALONE (any compiler), then main() below runs
+ * random inputs: ./a.out [number of inputs] [seed] (see "make fuzz-asan").
+ */
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(GDLLL_FAULT_INJECTION)
+#error "the library must be built with -DGDLLL_FAULT_INJECTION"
+#endif
+
+#define FUZZ_MAX_ELEMENTS 4096
+#define FUZZ_MAX_DATA_SIZE 5000
+#define FUZZ_NUM_KEYS 16
+#define FUZZ_NUM_OPERATIONS 28
+#define FUZZ_RING_CAPACITY 64
+#define FUZZ_MAX_TIMERS 64
+#define FUZZ_MAX_TIMER_DELAY 300
+#define FUZZ_MAX_COMPACT_ELEMENTS 256
+
+// the model of the list
+static long model_keys[FUZZ_MAX_ELEMENTS];
+static long model_sizes[FUZZ_MAX_ELEMENTS];
+static long model_num_elements;
+
+// the armed timers of the timer wheel (in no particular order)
+static struct element *timer_elems[FUZZ_MAX_TIMERS];
+static long timer_keys[FUZZ_MAX_TIMERS];
+static long timer_sizes[FUZZ_MAX_TIMERS];
+static long timer_expiry_times[FUZZ_MAX_TIMERS];
+static long num_timers;
+
+// the model of the compact container
+static long compact_keys[FUZZ_MAX_COMPACT_ELEMENTS];
+static long compact_sizes[FUZZ_MAX_COMPACT_ELEMENTS];
+static long compact_num_elements;
+
+static const long data_sizes[4] = {8, 40, 200, FUZZ_MAX_DATA_SIZE};
+static unsigned char data_buf[FUZZ_MAX_DATA_SIZE];
+
+static const uint8_t *input_ptr;
+static size_t input_left;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+static long next_byte(void);
+static int compare(struct element *first, struct element *second);
+static void *make_data(long key, long data_size);
+static void model_insert(long position, long key, long data_size);
+static void model_delete(long position);
+static long model_find(long key);
+static void model_sort(void);
+static long model_count(long from_key, long to_key);
+static long model_delete_removed_element(struct gdll_container *gdllc_ptr);
+static void check_container(struct gdll_container *gdllc_ptr);
+static void check_moved_elements(struct gdll_container *dest_gdllc_ptr,
+                                 long num_moved, long from_key, long to_key);
+static int is_allowed_add_error(int retval);
+static void run_range_operation(struct gdll_container *gdllc_ptr,
+                                struct gdll_container *dest_gdllc_ptr,
+                                long key);
+static void run_timer_wheel_operation(struct gdll_timer_wheel *gdlltw_ptr,
+                                      struct gdll_container *gdllc_ptr,
+                                      long key, long data_size);
+static void run_compact_operation(struct gdll_compact_container *gdllcc_ptr,
+                                  long key, long data_size);
+static void check_compact_container(struct gdll_compact_container *gdllcc_ptr);
+
+static long next_byte(void)
+{
+
+    if (input_left == 0) {
+        return 0;
+    }
+
+    input_left = input_left - 1;
+    input_ptr = input_ptr + 1;
+
+    return (long)(input_ptr[-1]);
+
+} // end of next_byte() function
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+// The data of an element starts with its key and the rest of it is filled
+// with the low byte of the key, so that a payload that is overwritten or
+// mixed up with another one is found by check_container().
+static void *make_data(long key, long data_size)
+{
+
+    memset(data_buf, (int)(key & 0xff), (size_t)(data_size));
+    memcpy(data_buf, &key, sizeof(key));
+
+    return data_buf;
+
+} // end of make_data() function
+
+static void model_insert(long position, long key, long data_size)
+{
+
+    long n = model_num_elements - position;
+
+    memmove(&(model_keys[position + 1]), &(model_keys[position]),
+            sizeof(long) * (size_t)(n));
+    memmove(&(model_sizes[position + 1]), &(model_sizes[position]),
+            sizeof(long) * (size_t)(n));
+
+    model_keys[position] = key;
+    model_sizes[position] = data_size;
+    model_num_elements = model_num_elements + 1;
+
+} // end of model_insert() function
+
+static void model_delete(long position)
+{
+
+    long n = model_num_elements - position - 1;
+
+    memmove(&(model_keys[position]), &(model_keys[position + 1]),
+            sizeof(long) * (size_t)(n));
+    memmove(&(model_sizes[position]), &(model_sizes[position + 1]),
+            sizeof(long) * (size_t)(n));
+
+    model_num_elements = model_num_elements - 1;
+
+} // end of model_delete() function
+
+static long model_find(long key)
+{
+
+    long i = 0;
+
+    for (i = 0; i < model_num_elements; i = i + 1) {
+        if (model_keys[i] == key) {
+            return i;
+        }
+    }
+
+    return -1;
+
+} // end of model_find() function
+
+// stable insertion sort, as gdlll_sort_incrementally() is stable
+static void model_sort(void)
+{
+
+    long i = 0;
+    long j = 0;
+    long key = 0;
+    long data_size = 0;
+
+    for (i = 1; i < model_num_elements; i = i + 1) {
+        key = model_keys[i];
+        data_size = model_sizes[i];
+        j = i - 1;
+        while ((j >= 0) && (model_keys[j] > key)) {
+            model_keys[j + 1] = model_keys[j];
+            model_sizes[j + 1] = model_sizes[j];
+            j = j - 1;
+        }
+        model_keys[j + 1] = key;
+        model_sizes[j + 1] = data_size;
+    }
+
+} // end of model_sort() function
+
+// returns the number of elements in the model with a key from 'from_key' to
+// 'to_key'
+static long model_count(long from_key, long to_key)
+{
+
+    long count = 0;
+    long i = 0;
+
+    for (i = 0; i < model_num_elements; i = i + 1) {
+        if ((model_keys[i] >= from_key) && (model_keys[i] <= to_key)) {
+            count = count + 1;
+        }
+    }
+
+    return count;
+
+} // end of model_count() function
+
+// In priority queue mode, the front element is the smallest one, wherever it
+// is in the list. This finds the element that has just been removed from the
+// list (the first position where the list and the model differ), deletes it
+// from the model and returns its position.
+static long model_delete_removed_element(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = gdllc_ptr->first;
+    long position = 0;
+
+    while ((elem_ptr) &&
+           (*(long *)(elem_ptr->data_ptr) == model_keys[position]) &&
+           (elem_ptr->data_size == model_sizes[position])) {
+        position = position + 1;
+        elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr);
+    }
+
+    assert(position < model_num_elements);
+
+    model_delete(position);
+
+    return position;
+
+} // end of model_delete_removed_element() function
+
+static void check_container(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    unsigned char *data_ptr = NULL;
+    long memory_size = 0;
+    long header_size = (long)((sizeof(struct element) + 15) & ~15UL);
+    long i = 0;
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                        model_num_elements);
+
+    // not gdlll_peek_front_element(), which is the smallest element in
+    // priority queue mode (the tombstones are never the first element)
+    elem_ptr = gdllc_ptr->first;
+
+    while (elem_ptr) {
+
+        assert(i < model_num_elements);
+        assert(*(long *)(elem_ptr->data_ptr) == model_keys[i]);
+        assert(elem_ptr->data_size == model_sizes[i]);
+
+        // the data of 8 bytes is only the key
+        data_ptr = elem_ptr->data_ptr;
+        if (model_sizes[i] > (long)(sizeof(long))) {
+            assert(data_ptr[model_sizes[i] - 1] ==
+                                    (unsigned char)(model_keys[i] & 0xff));
+        }
+
+        memory_size = memory_size + header_size;
+        if (model_sizes[i] > GDLLL_INLINE_DATA_SIZE) {
+            memory_size = memory_size + model_sizes[i];
+        } else {
+            memory_size = memory_size + GDLLL_INLINE_DATA_SIZE;
+        }
+
+        i = i + 1;
+        elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr);
+
+    }
+
+    assert(i == model_num_elements);
+
+    // the memory of a tombstone is counted until it is purged
+    if (gdllc_ptr->number_of_tombstones == 0) {
+        assert(gdlll_get_memory_in_use(gdllc_ptr) == memory_size);
+    }
+
+} // end of check_container() function
+
+// Checks that 'dest_gdllc_ptr' has 'num_moved' elements with keys from
+// 'from_key' to 'to_key', and then deletes them.
+static void check_moved_elements(struct gdll_container *dest_gdllc_ptr,
+                                 long num_moved, long from_key, long to_key)
+{
+
+    struct element *elem_ptr = NULL;
+    long key = 0;
+    long i = 0;
+
+    for (elem_ptr = gdlll_peek_front_element(dest_gdllc_ptr); elem_ptr;
+         elem_ptr = gdlll_peek_next_element(dest_gdllc_ptr, elem_ptr)) {
+        key = *(long *)(elem_ptr->data_ptr);
+        assert((key >= from_key) && (key <= to_key));
+        if (elem_ptr->data_size > (long)(sizeof(long))) {
+            assert(((unsigned char *)(elem_ptr->data_ptr))[
+                    elem_ptr->data_size - 1] == (unsigned char)(key & 0xff));
+        }
+        i = i + 1;
+    }
+
+    assert(i == num_moved);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(
+                                            dest_gdllc_ptr) == num_moved);
+
+    gdlll_delete_all_elements_in_gdll_container(dest_gdllc_ptr);
+
+} // end of check_moved_elements() function
+
+static int is_allowed_add_error(int retval)
+{
+
+    return ((retval == GDLLL_NO_MEMORY) ||
+            (retval == GDLLL_CONTAINER_IS_FULL));
+
+} // end of is_allowed_add_error() function
+
+// Sorts the container and then peeks, deletes or moves (to 'dest_gdllc_ptr')
+// the range of keys from 'key' to the key in the next byte.
+static void run_range_operation(struct gdll_container *gdllc_ptr,
+                                struct gdll_container *dest_gdllc_ptr,
+                                long key)
+{
+
+    struct gdll_continuation cont;
+    struct element *range_first_ptr = NULL;
+    struct element *range_last_ptr = NULL;
+    long from_key = key;
+    long to_key = next_byte() % FUZZ_NUM_KEYS;
+    long operation = next_byte() % 3;
+    long count = 0;
+    long n = 0;
+    long position = 0;
+    int retval = 0;
+
+    gdlll_init_continuation(&cont);
+    do {
+        retval = gdlll_sort_incrementally(gdllc_ptr, &cont, compare, 0, 0);
+    } while (retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+
+    if (retval != GDLLL_SUCCESS) {
+        assert(retval == GDLLL_CONTAINER_IS_SHARED);
+        return;
+    }
+
+    model_sort();
+
+    if (from_key > to_key) {
+        from_key = to_key;
+        to_key = key;
+    }
+
+    count = model_count(from_key, to_key);
+
+    // the range is where the first key >= 'from_key' is
+    while ((position < model_num_elements) &&
+           (model_keys[position] < from_key)) {
+        position = position + 1;
+    }
+
+    if (operation == 0) {
+        n = gdlll_peek_range(gdllc_ptr, &from_key, sizeof(from_key), &to_key,
+                             sizeof(to_key), compare,
+                             GDLLL_SEARCH_SORTED_ASCENDING, &range_first_ptr,
+                             &range_last_ptr);
+        assert(n == count);
+        if (n > 0) {
+            assert(*(long *)(range_first_ptr->data_ptr) ==
+                                                    model_keys[position]);
+            assert(*(long *)(range_last_ptr->data_ptr) ==
+                                            model_keys[position + n - 1]);
+        } else {
+            assert((!range_first_ptr) && (!range_last_ptr));
+        }
+    } else if (operation == 1) {
+        n = gdlll_delete_range(gdllc_ptr, &from_key, sizeof(from_key),
+                               &to_key, sizeof(to_key), compare,
+                               GDLLL_SEARCH_SORTED_ASCENDING);
+        assert(n == count);
+    } else {
+        // nothing is moved in arena or ring mode, or if there is no memory
+        n = gdlll_get_range(gdllc_ptr, &from_key, sizeof(from_key), &to_key,
+                            sizeof(to_key), compare,
+                            GDLLL_SEARCH_SORTED_ASCENDING, dest_gdllc_ptr);
+        assert((n == 0) || (n == count));
+        check_moved_elements(dest_gdllc_ptr, n, from_key, to_key);
+    }
+
+    if (operation != 0) {
+        while (n > 0) {
+            model_delete(position);
+            n = n - 1;
+        }
+    }
+
+} // end of run_range_operation() function
+
+// Arms, re-arms or cancels a timer, or advances the time of the timer wheel
+// (the expired timers are added to the back of 'gdllc_ptr').
+static void run_timer_wheel_operation(struct gdll_timer_wheel *gdlltw_ptr,
+                                      struct gdll_container *gdllc_ptr,
+                                      long key, long data_size)
+{
+
+    struct element *elem_ptr = NULL;
+    long operation = next_byte() % 4;
+    long expiry_time = gdlltw_ptr->current_time + 1 +
+                       (next_byte() % FUZZ_MAX_TIMER_DELAY);
+    long last_expiry_time = 0;
+    long n = 0;
+    long i = 0;
+    long j = 0;
+    int retval = 0;
+
+    if ((operation == 1) || (operation == 2)) {
+        if (num_timers == 0) {
+            return;
+        }
+        i = next_byte() % num_timers;
+    }
+
+    if (operation == 0) {
+        if (num_timers == FUZZ_MAX_TIMERS) {
+            return;
+        }
+        elem_ptr = gdlll_timer_wheel_arm(gdlltw_ptr,
+                                         make_data(key, data_size), data_size,
+                                         expiry_time);
+        if (elem_ptr) {
+            timer_elems[num_timers] = elem_ptr;
+            timer_keys[num_timers] = key;
+            timer_sizes[num_timers] = data_size;
+            timer_expiry_times[num_timers] = expiry_time;
+            num_timers = num_timers + 1;
+        }
+    } else if (operation == 1) {
+        retval = gdlll_timer_wheel_rearm(gdlltw_ptr, timer_elems[i],
+                                         expiry_time);
+        assert(retval == GDLLL_SUCCESS);
+        assert(gdlll_timer_wheel_get_expiry_time(timer_elems[i]) ==
+                                                                expiry_time);
+        timer_expiry_times[i] = expiry_time;
+    } else if (operation == 2) {
+        retval = gdlll_timer_wheel_cancel(gdlltw_ptr, timer_elems[i]);
+        assert(retval == GDLLL_SUCCESS);
+        num_timers = num_timers - 1;
+        timer_elems[i] = timer_elems[num_timers];
+        timer_keys[i] = timer_keys[num_timers];
+        timer_sizes[i] = timer_sizes[num_timers];
+        timer_expiry_times[i] = timer_expiry_times[num_timers];
+    } else {
+        // the expired timers are the last 'n' elements of the list, in the
+        // order of their expiry times
+        n = gdlll_timer_wheel_advance(gdlltw_ptr,
+                                      gdlltw_ptr->current_time +
+                                      (next_byte() % FUZZ_MAX_TIMER_DELAY),
+                                      gdllc_ptr);
+        elem_ptr = gdllc_ptr->last;
+        for (j = 1; j < n; j = j + 1) {
+            elem_ptr = gdlll_peek_prev_element(gdllc_ptr, elem_ptr);
+        }
+        for (j = 0; j < n; j = j + 1) {
+            i = 0;
+            while ((i < num_timers) && (timer_elems[i] != elem_ptr)) {
+                i = i + 1;
+            }
+            assert(i < num_timers);
+            assert(timer_expiry_times[i] <= gdlltw_ptr->current_time);
+            assert(timer_expiry_times[i] >= last_expiry_time);
+            last_expiry_time = timer_expiry_times[i];
+            model_insert(model_num_elements, timer_keys[i], timer_sizes[i]);
+            num_timers = num_timers - 1;
+            timer_elems[i] = timer_elems[num_timers];
+            timer_keys[i] = timer_keys[num_timers];
+            timer_sizes[i] = timer_sizes[num_timers];
+            timer_expiry_times[i] = timer_expiry_times[num_timers];
+            elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr);
+        }
+        // the timers that are still armed have not expired
+        for (i = 0; i < num_timers; i = i + 1) {
+            assert(timer_expiry_times[i] > gdlltw_ptr->current_time);
+        }
+    }
+
+    assert(gdlll_timer_wheel_get_total_number_of_timers(gdlltw_ptr) ==
+                                                                num_timers);
+
+} // end of run_timer_wheel_operation() function
+
+// Adds an element to the front or to the back of the compact container, or
+// deletes the front, the last or the matching element.
+static void run_compact_operation(struct gdll_compact_container *gdllcc_ptr,
+                                  long key, long data_size)
+{
+
+    unsigned int index = GDLLL_COMPACT_INVALID_INDEX;
+    long operation = next_byte() % 5;
+    long position = 0;
+    long n = 0;
+    int retval = 0;
+
+    if (compact_num_elements == FUZZ_MAX_COMPACT_ELEMENTS) {
+        gdlll_compact_delete_all_elements_in_gdll_container(gdllcc_ptr);
+        compact_num_elements = 0;
+    }
+
+    if (operation == 0) {
+        retval = gdlll_compact_add_element_to_front(gdllcc_ptr,
+                                        make_data(key, data_size), data_size);
+        if (retval == GDLLL_SUCCESS) {
+            n = compact_num_elements;
+            memmove(&(compact_keys[1]), &(compact_keys[0]),
+                    sizeof(long) * (size_t)(n));
+            memmove(&(compact_sizes[1]), &(compact_sizes[0]),
+                    sizeof(long) * (size_t)(n));
+            compact_keys[0] = key;
+            compact_sizes[0] = data_size;
+            compact_num_elements = compact_num_elements + 1;
+        } else {
+            assert(retval == GDLLL_NO_MEMORY);
+        }
+    } else if (operation == 1) {
+        retval = gdlll_compact_add_element_to_back(gdllcc_ptr,
+                                        make_data(key, data_size), data_size);
+        if (retval == GDLLL_SUCCESS) {
+            compact_keys[compact_num_elements] = key;
+            compact_sizes[compact_num_elements] = data_size;
+            compact_num_elements = compact_num_elements + 1;
+        } else {
+            assert(retval == GDLLL_NO_MEMORY);
+        }
+    } else if (compact_num_elements == 0) {
+        assert(gdlll_compact_peek_front_element(gdllcc_ptr) ==
+                                                GDLLL_COMPACT_INVALID_INDEX);
+        return;
+    } else {
+        if (operation == 2) {
+            gdlll_compact_delete_front_element(gdllcc_ptr);
+            position = 0;
+        } else if (operation == 3) {
+            gdlll_compact_delete_last_element(gdllcc_ptr);
+            position = compact_num_elements - 1;
+        } else {
+            index = gdlll_compact_peek_matching_element(gdllcc_ptr, &key,
+                                                        sizeof(key), compare);
+            position = 0;
+            while ((position < compact_num_elements) &&
+                   (compact_keys[position] != key)) {
+                position = position + 1;
+            }
+            if (position == compact_num_elements) {
+                assert(index == GDLLL_COMPACT_INVALID_INDEX);
+                return;
+            }
+            gdlll_compact_delete_element(gdllcc_ptr, index);
+        }
+        n = compact_num_elements - position - 1;
+        memmove(&(compact_keys[position]), &(compact_keys[position + 1]),
+                sizeof(long) * (size_t)(n));
+        memmove(&(compact_sizes[position]), &(compact_sizes[position + 1]),
+                sizeof(long) * (size_t)(n));
+        compact_num_elements = compact_num_elements - 1;
+    }
+
+    check_compact_container(gdllcc_ptr);
+
+} // end of run_compact_operation() function
+
+static void check_compact_container(struct gdll_compact_container *gdllcc_ptr)
+{
+
+    unsigned int index = gdlll_compact_peek_front_element(gdllcc_ptr);
+    unsigned char *data_ptr = NULL;
+    long key = 0;
+    long i = 0;
+
+    assert(gdlll_compact_get_total_number_of_elements_in_gdll_container(
+                                        gdllcc_ptr) == compact_num_elements);
+
+    while (index != GDLLL_COMPACT_INVALID_INDEX) {
+
+        assert(i < compact_num_elements);
+        // the data in the data pool may not be aligned
+        data_ptr = gdlll_compact_get_data_ptr(gdllcc_ptr, index);
+        memcpy(&key, data_ptr, sizeof(key));
+        assert(key == compact_keys[i]);
+        assert(gdlll_compact_get_data_size(gdllcc_ptr, index) ==
+                                                            compact_sizes[i]);
+        if (compact_sizes[i] > (long)(sizeof(long))) {
+            assert(data_ptr[compact_sizes[i] - 1] ==
+                                    (unsigned char)(compact_keys[i] & 0xff));
+        }
+
+        i = i + 1;
+        index = gdlll_compact_peek_next_element(gdllcc_ptr, index);
+
+    }
+
+    assert(i == compact_num_elements);
+
+} // end of check_compact_container() function
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_container *dest_gdllc_ptr = NULL;
+    struct gdll_timer_wheel *gdlltw_ptr = NULL;
+    struct gdll_compact_container *gdllcc_ptr = NULL;
+    struct gdll_snapshot *snapshot_ptr = NULL;
+    struct gdll_continuation cont;
+    struct element *elem_ptr = NULL;
+    void *data_ptrs[5];
+    long global_memory_at_start = gdlll_get_global_memory_in_use();
+    long op = 0;
+    long key = 0;
+    long new_key = 0;
+    long data_size = 0;
+    long position = 0;
+    long num_elements = 0;
+    long i = 0;
+    int lazy_deletion_enabled = 0;
+    int order_statistic_index_enabled = 0;
+    int integer_key_index_enabled = 0;
+    int node_cache_enabled = 0;
+    int retval = 0;
+
+    input_ptr = data;
+    input_left = size;
+    model_num_elements = 0;
+    num_timers = 0;
+    compact_num_elements = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    dest_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    gdlltw_ptr = gdlll_timer_wheel_init(NULL, 0);
+    gdllcc_ptr = gdlll_compact_init_gdll_container(NULL);
+    assert(gdllc_ptr && dest_gdllc_ptr && gdlltw_ptr && gdllcc_ptr);
+
+    // the elements that are moved there need room in its integer key index
+    gdlll_enable_integer_key_index(dest_gdllc_ptr);
+
+    while (input_left > 0) {
+
+        op = next_byte() % FUZZ_NUM_OPERATIONS;
+        key = next_byte() % FUZZ_NUM_KEYS;
+        data_size = data_sizes[next_byte() % 4];
+
+        switch (op) {
+
+        case 0:
+            retval = gdlll_add_element_to_front(gdllc_ptr,
+                                        make_data(key, data_size), data_size);
+            if (retval == GDLLL_SUCCESS) {
+                model_insert(0, key, data_size);
+            } else {
+                assert(is_allowed_add_error(retval));
+            }
+            break;
+
+        case 1:
+            retval = gdlll_add_element_to_back(gdllc_ptr,
+                                        make_data(key, data_size), data_size);
+            if (retval == GDLLL_SUCCESS) {
+                model_insert(model_num_elements, key, data_size);
+            } else {
+                assert(is_allowed_add_error(retval));
+            }
+            break;
+
+        case 2:
+            position = next_byte() % (model_num_elements + 1);
+            retval = gdlll_add_element_at_position(gdllc_ptr, position,
+                                        make_data(key, data_size), data_size);
+            if (retval == GDLLL_SUCCESS) {
+                model_insert(position, key, data_size);
+            } else {
+                assert(is_allowed_add_error(retval));
+            }
+            break;
+
+        case 3:
+            gdlll_delete_front_element(gdllc_ptr);
+            if (model_num_elements > 0) {
+                if (gdllc_ptr->priority_queue_enabled) {
+                    model_delete_removed_element(gdllc_ptr);
+                } else {
+                    model_delete(0);
+                }
+            }
+            break;
+
+        case 4:
+            gdlll_delete_last_element(gdllc_ptr);
+            if (model_num_elements > 0) {
+                model_delete(model_num_elements - 1);
+            }
+            break;
+
+        case 5:
+            gdlll_delete_matching_element(gdllc_ptr, &key, sizeof(key),
+                                          compare);
+            position = model_find(key);
+            if (position >= 0) {
+                model_delete(position);
+            }
+            break;
+
+        case 6:
+            new_key = next_byte() % FUZZ_NUM_KEYS;
+            retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &key,
+                                        sizeof(key),
+                                        make_data(new_key, data_size),
+                                        data_size, compare);
+            position = model_find(key);
+            if (position < 0) {
+                assert((retval == GDLLL_MATCHING_ELEMENT_NOT_FOUND) ||
+                       (retval == GDLLL_CONTAINER_IS_EMPTY));
+            } else if (retval == GDLLL_SUCCESS) {
+                model_keys[position] = new_key;
+                model_sizes[position] = data_size;
+            } else {
+                // the old data must still be there
+                assert(is_allowed_add_error(retval));
+            }
+            break;
+
+        case 7:
+            elem_ptr = gdlll_get_front_element(gdllc_ptr);
+            if (model_num_elements > 0) {
+                assert(elem_ptr);
+                if (gdllc_ptr->priority_queue_enabled) {
+                    position = model_delete_removed_element(gdllc_ptr);
+                    // the smallest key
+                    assert(model_count(0, *(long *)(elem_ptr->data_ptr) - 1)
+                                                                        == 0);
+                } else {
+                    model_delete(0);
+                }
+                gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+            } else {
+                assert(!elem_ptr);
+            }
+            break;
+
+        case 8:
+            num_elements = 1 + (next_byte() % 5);
+            retval = gdlll_emplace_elements_to_back(gdllc_ptr, data_size,
+                                                    num_elements, data_ptrs);
+            if (retval == GDLLL_SUCCESS) {
+                for (i = 0; i < num_elements; i = i + 1) {
+                    memcpy(data_ptrs[i], make_data(key, data_size),
+                           (size_t)(data_size));
+                    model_insert(model_num_elements, key, data_size);
+                }
+                // the keys were indexed before the data was written
+                if (integer_key_index_enabled) {
+                    gdlll_disable_integer_key_index(gdllc_ptr);
+                    integer_key_index_enabled = 0;
+                }
+            } else {
+                assert(is_allowed_add_error(retval));
+            }
+            break;
+
+        case 9:
+            if (lazy_deletion_enabled) {
+                gdlll_disable_lazy_deletion(gdllc_ptr);
+            } else {
+                gdlll_enable_lazy_deletion(gdllc_ptr, next_byte() % 100);
+            }
+            lazy_deletion_enabled = !lazy_deletion_enabled;
+            break;
+
+        case 10:
+            if (gdllc_ptr->arena_mode_enabled) {
+                // this deletes all the elements
+                gdlll_disable_arena_mode(gdllc_ptr);
+                model_num_elements = 0;
+            } else {
+                retval = gdlll_enable_arena_mode(gdllc_ptr,
+                                                 GDLLL_NO_NUMA_NODE);
+                assert((retval == GDLLL_SUCCESS) ||
+                       (retval == GDLLL_CONTAINER_IS_NOT_EMPTY) ||
+                       (retval == GDLLL_CONTAINER_IS_SHARED) ||
+                       (retval == GDLLL_NO_MEMORY));
+            }
+            break;
+
+        case 11:
+            if (order_statistic_index_enabled) {
+                gdlll_disable_order_statistic_index(gdllc_ptr);
+            } else {
+                gdlll_enable_order_statistic_index(gdllc_ptr);
+            }
+            order_statistic_index_enabled = !order_statistic_index_enabled;
+            break;
+
+        case 12:
+            retval = gdlll_relayout_container_incrementally(gdllc_ptr,
+                                                    1 + (next_byte() % 8));
+            assert((retval == GDLLL_SUCCESS) ||
+                   (retval == GDLLL_OPERATION_IS_NOT_COMPLETE) ||
+                   (retval == GDLLL_CONTAINER_IS_SHARED) ||
+                   (retval == GDLLL_NO_MEMORY));
+            break;
+
+        case 13:
+            if (node_cache_enabled) {
+                gdlll_disable_node_cache(gdllc_ptr);
+            } else {
+                gdlll_enable_node_cache(gdllc_ptr);
+            }
+            node_cache_enabled = !node_cache_enabled;
+            break;
+
+        case 14:
+            if (integer_key_index_enabled) {
+                gdlll_disable_integer_key_index(gdllc_ptr);
+            } else {
+                gdlll_enable_integer_key_index(gdllc_ptr);
+            }
+            integer_key_index_enabled = !integer_key_index_enabled;
+            break;
+
+        case 15:
+            // -1 makes all the allocations after the first ones fail
+            gdlll_inject_allocation_failures(next_byte() % 8,
+                                             (next_byte() % 4) - 1);
+            break;
+
+        case 16:
+            position = 0;
+            if (model_num_elements > 0) {
+                position = next_byte() % model_num_elements;
+            }
+            gdlll_delete_element_at_position(gdllc_ptr, position);
+            if (model_num_elements > 0) {
+                model_delete(position);
+            }
+            break;
+
+        case 17:
+            gdlll_init_continuation(&cont);
+            do {
+                retval = gdlll_sort_incrementally(gdllc_ptr, &cont, compare,
+                                                  next_byte() % 16, 0);
+            } while (retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+            if (retval == GDLLL_SUCCESS) {
+                model_sort();
+            } else {
+                assert(retval == GDLLL_CONTAINER_IS_SHARED);
+            }
+            break;
+
+        case 18:
+            if (snapshot_ptr) {
+                gdlll_release_snapshot(snapshot_ptr);
+                snapshot_ptr = NULL;
+            } else {
+                snapshot_ptr = gdlll_take_snapshot(gdllc_ptr);
+            }
+            break;
+
+        case 19:
+            gdlll_init_continuation(&cont);
+            do {
+                retval = gdlll_delete_all_elements_incrementally(gdllc_ptr,
+                                                &cont, next_byte() % 16, 0);
+            } while (retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+            assert(retval == GDLLL_SUCCESS);
+            model_num_elements = 0;
+            break;
+
+        case 20:
+            if (gdllc_ptr->ring_capacity > 0) {
+                // this deletes all the elements
+                gdlll_disable_ring_mode(gdllc_ptr);
+                model_num_elements = 0;
+            } else {
+                gdlll_enable_ring_mode(gdllc_ptr, FUZZ_RING_CAPACITY,
+                                       FUZZ_MAX_DATA_SIZE,
+                                       GDLLL_RING_REJECT_WHEN_FULL);
+            }
+            break;
+
+        case 21:
+            assert(gdlll_count_matching_elements(gdllc_ptr, &key, sizeof(key),
+                                        compare) == model_count(key, key));
+            break;
+
+        case 22:
+            num_elements = gdlll_delete_all_matching_elements(gdllc_ptr, &key,
+                                                    sizeof(key), compare);
+            assert(num_elements == model_count(key, key));
+            while ((position = model_find(key)) >= 0) {
+                model_delete(position);
+            }
+            break;
+
+        case 23:
+            // the first 'num_elements' matching elements are moved (not all
+            // of them if there is no memory, none in arena or ring mode)
+            num_elements = gdlll_get_all_matching_elements(gdllc_ptr, &key,
+                                        sizeof(key), compare, dest_gdllc_ptr);
+            assert(num_elements <= model_count(key, key));
+            check_moved_elements(dest_gdllc_ptr, num_elements, key, key);
+            for (i = 0; i < num_elements; i = i + 1) {
+                model_delete(model_find(key));
+            }
+            break;
+
+        case 24:
+            run_range_operation(gdllc_ptr, dest_gdllc_ptr, key);
+            break;
+
+        case 25:
+            if (gdllc_ptr->priority_queue_enabled) {
+                gdlll_disable_priority_queue_mode(gdllc_ptr);
+            } else {
+                retval = gdlll_enable_priority_queue_mode(gdllc_ptr, compare);
+                assert((retval == GDLLL_SUCCESS) ||
+                       (retval == GDLLL_NO_MEMORY));
+            }
+            break;
+
+        case 26:
+            run_timer_wheel_operation(gdlltw_ptr, gdllc_ptr, key, data_size);
+            break;
+
+        case 27:
+            run_compact_operation(gdllcc_ptr, key, data_size);
+            break;
+
+        default:
+            break;
+
+        }
+
+        // the timer wheel can add all its timers at once
+        if (model_num_elements >=
+                            (FUZZ_MAX_ELEMENTS - FUZZ_MAX_TIMERS - 8)) {
+            gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+            model_num_elements = 0;
+        }
+
+        check_container(gdllc_ptr);
+
+    }
+
+    gdlll_inject_allocation_failures(0, 0);
+
+    if (snapshot_ptr) {
+        gdlll_release_snapshot(snapshot_ptr);
+    }
+
+    gdlll_compact_delete_gdll_container(gdllcc_ptr);
+    gdlll_timer_wheel_delete(gdlltw_ptr);
+    gdlll_delete_gdll_container(dest_gdllc_ptr);
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    gdlll_free_node_cache_of_current_thread();
+
+    // nothing has been leaked from the memory count
+    assert(gdlll_get_global_memory_in_use() == global_memory_at_start);
+
+    return 0;
+
+} // end of LLVMFuzzerTestOneInput() function
+
+#if defined(GDLLL_FUZZ_STANDALONE)
+
+int main(int argc, char *argv[])
+{
+
+    uint8_t input[600];
+    unsigned long seed = 1;
+    long num_inputs = 2000;
+    long n = 0;
+    size_t i = 0;
+
+    if (argc > 1) {
+        num_inputs = atol(argv[1]);
+    }
+
+    if (argc > 2) {
+        seed = (unsigned long)(atol(argv[2]));
+    }
+
+    for (n = 0; n < num_inputs; n = n + 1) {
+        for (i = 0; i < sizeof(input); i = i + 1) {
+            seed = (seed * 1103515245UL) + 12345UL;
+            input[i] = (uint8_t)(seed >> 16);
+        }
+        LLVMFuzzerTestOneInput(input, sizeof(input));
+    }
+
+    printf("%ld inputs passed\n", num_inputs);
+
+    return 0;
+
+} // end of main() function
+
+#endif
@@ -0,0 +1,253 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+/*
+ * Multi-threaded stress test. It is meant to be run under ThreadSanitizer
+ * ("make stress-tsan") and AddressSanitizer ("make stress-asan").
+ *
+ * - The main thread adds and deletes elements in a container that has epoch
+ *   based reclamation enabled while NUM_READERS threads look up elements in
+ *   it under gdlll_epoch_read_lock().
+ *
+ * - The main thread also adds and deletes elements in a container that has
+ *   asynchronous deletion enabled, so the deleter thread frees elements at
+ *   the same time.
+ *
+ * - NUM_WORKERS threads each use their own container with the node cache, a
+ *   memory limit and (for every second worker) arena mode enabled, with
+ *   allocation failures injected in their threads.
+ *
+ * The library must be built with -DGDLLL_FAULT_INJECTION.
+ */
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#if !defined(GDLLL_FAULT_INJECTION)
+#error "the library must be built with -DGDLLL_FAULT_INJECTION"
+#endif
+
+#define NUM_READERS 3
+#define NUM_WORKERS 4
+#define NUM_KEYS 1000
+#define NUM_MAIN_ITERATIONS 30000
+#define NUM_WORKER_ROUNDS 200
+#define WORKER_MEMORY_LIMIT 200000
+
+static struct gdll_container *shared_gdllc_ptr;
+static int stop_readers;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static long next_random(unsigned long *seed_ptr);
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+static void *reader(void *arg);
+static void *worker(void *arg);
+
+static long next_random(unsigned long *seed_ptr)
+{
+
+    *seed_ptr = ((*seed_ptr) * 1103515245UL) + 12345UL;
+
+    return (long)(((*seed_ptr) >> 16) % NUM_KEYS);
+
+} // end of next_random() function
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void call_back_func(void *data_ptr)
+{
+
+    (void)(data_ptr);
+
+    return;
+
+} // end of call_back_func() function
+
+static void *reader(void *arg)
+{
+
+    struct element *elem_ptr = NULL;
+    unsigned long seed = (unsigned long)(arg) + 1;
+    long reader_id = (long)(arg);
+    long key = 0;
+
+    while (!__atomic_load_n(&stop_readers, __ATOMIC_ACQUIRE)) {
+
+        gdlll_epoch_read_lock(shared_gdllc_ptr, reader_id);
+
+        key = next_random(&seed);
+        elem_ptr = gdlll_peek_matching_element(shared_gdllc_ptr, &key,
+                                               sizeof(key), compare);
+        if (elem_ptr) {
+            assert(*(long *)(elem_ptr->data_ptr) == key);
+        }
+
+        gdlll_epoch_read_unlock(shared_gdllc_ptr, reader_id);
+
+    }
+
+    return NULL;
+
+} // end of reader() function
+
+static void *worker(void *arg)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    long worker_id = (long)(arg);
+    char data[300];
+    long round = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    gdlll_enable_node_cache(gdllc_ptr);
+
+    if (worker_id % 2) {
+        gdlll_enable_arena_mode(gdllc_ptr, GDLLL_NO_NUMA_NODE);
+    }
+
+    gdlll_set_memory_limit(gdllc_ptr, WORKER_MEMORY_LIMIT,
+                           gdlll_choose_front_element_to_evict);
+
+    memset(data, 0, sizeof(data));
+
+    for (round = 0; round < NUM_WORKER_ROUNDS; round = round + 1) {
+
+        gdlll_inject_allocation_failures(round % 50, round % 3);
+
+        for (i = 0; i < 500; i = i + 1) {
+            *(long *)(data) = i * worker_id;
+            retval = gdlll_add_element_to_back(gdllc_ptr, data,
+                                               (i % 3) ? 8 : 300);
+            assert((retval == GDLLL_SUCCESS) || (retval == GDLLL_NO_MEMORY));
+        }
+
+        for (i = 0; i < 300; i = i + 1) {
+            gdlll_delete_front_element(gdllc_ptr);
+        }
+
+        assert(gdlll_get_memory_in_use(gdllc_ptr) <= WORKER_MEMORY_LIMIT);
+
+    }
+
+    gdlll_inject_allocation_failures(0, 0);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    gdlll_free_node_cache_of_current_thread();
+
+    return NULL;
+
+} // end of worker() function
+
+int main(void)
+{
+
+    struct gdll_container *async_gdllc_ptr = NULL;
+    pthread_t readers[NUM_READERS];
+    pthread_t workers[NUM_WORKERS];
+    unsigned long seed = 1;
+    char data[100];
+    long global_memory_at_start = gdlll_get_global_memory_in_use();
+    long key = 0;
+    long i = 0;
+    int retval = 0;
+
+    shared_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(shared_gdllc_ptr);
+    retval = gdlll_enable_epoch_reclamation(shared_gdllc_ptr, NUM_READERS);
+    assert(retval == GDLLL_SUCCESS);
+
+    async_gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(async_gdllc_ptr);
+    retval = gdlll_enable_async_deletion(async_gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < NUM_READERS; i = i + 1) {
+        retval = pthread_create(&(readers[i]), NULL, reader, (void *)(i));
+        assert(retval == 0);
+    }
+
+    for (i = 0; i < NUM_WORKERS; i = i + 1) {
+        retval = pthread_create(&(workers[i]), NULL, worker, (void *)(i + 1));
+        assert(retval == 0);
+    }
+
+    memset(data, 0, sizeof(data));
+
+    for (i = 0; i < NUM_MAIN_ITERATIONS; i = i + 1) {
+
+        key = next_random(&seed);
+        gdlll_add_element_to_back(shared_gdllc_ptr, &key, sizeof(key));
+
+        key = next_random(&seed);
+        gdlll_delete_matching_element(shared_gdllc_ptr, &key, sizeof(key),
+                                      compare);
+
+        gdlll_add_element_to_back(async_gdllc_ptr, data, sizeof(data));
+        if ((i % 3) == 0) {
+            gdlll_delete_front_element(async_gdllc_ptr);
+        }
+
+    }
+
+    __atomic_store_n(&stop_readers, 1, __ATOMIC_RELEASE);
+
+    for (i = 0; i < NUM_READERS; i = i + 1) {
+        pthread_join(readers[i], NULL);
+    }
+
+    for (i = 0; i < NUM_WORKERS; i = i + 1) {
+        pthread_join(workers[i], NULL);
+    }
+
+    gdlll_flush_async_deletion(async_gdllc_ptr);
+    gdlll_delete_gdll_container(async_gdllc_ptr);
+    gdlll_delete_gdll_container(shared_gdllc_ptr);
+
+    assert(gdlll_get_global_memory_in_use() == global_memory_at_start);
+
+    printf("stress test passed\n");
+
+    return 0;
+
+} // end of main() function
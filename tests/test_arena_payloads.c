@@ -0,0 +1,165 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the payloads in arena mode (small payloads come from the huge page
+// regions of the arena and large ones from malloc()), and the reset of the
+// arena by gdlll_delete_all_elements_in_gdll_container().
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_ELEMENTS 50000
+#define MAX_DATA_SIZE 8500
+
+static long num_deleted;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+static long data_size_of(long key);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void call_back_func(void *data_ptr)
+{
+
+    (void)(data_ptr);
+
+    num_deleted = num_deleted + 1;
+
+    return;
+
+} // end of call_back_func() function
+
+// Sizes on both sides of GDLLL_ARENA_MAX_PAYLOAD_SIZE.
+static long data_size_of(long key)
+{
+
+    return (long)(sizeof(long)) + ((key * 131) % MAX_DATA_SIZE);
+
+} // end of data_size_of() function
+
+int main(void)
+{
+
+    static char data[MAX_DATA_SIZE + sizeof(long)];
+    static long new_data[600];
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *standalone_elem_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long data_size = 0;
+    long value = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_arena_mode(gdllc_ptr, GDLLL_NO_NUMA_NODE);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < NUM_ELEMENTS; i = i + 1) {
+        data_size = data_size_of(i);
+        memset(data, (int)(i), (size_t)(data_size));
+        *(long *)(data) = i;
+        retval = gdlll_add_element_to_back(gdllc_ptr, data, data_size);
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    // the element blocks and the small payload blocks
+    assert(gdllc_ptr->arena_number_of_blocks_in_use > NUM_ELEMENTS);
+
+    for (elem_ptr = gdllc_ptr->first, i = 0; elem_ptr;
+         elem_ptr = elem_ptr->next, i = i + 1) {
+        assert(*(long *)(elem_ptr->data_ptr) == i);
+        assert(elem_ptr->data_size == data_size_of(i));
+        if (elem_ptr->data_size > (long)(sizeof(long))) {
+            assert(((unsigned char *)(elem_ptr->data_ptr))[
+                        elem_ptr->data_size - 1] == (unsigned char)(i));
+        }
+    }
+
+    // the payload moves between the arena and malloc()
+    for (i = 0; i < NUM_ELEMENTS; i = i + 5) {
+        new_data[0] = i;
+        retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &i,
+                                            sizeof(i), new_data,
+                                            (long)(sizeof(long)) + (i % 4000),
+                                            compare);
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    // a standalone element keeps its block, so the arena is not reset
+    standalone_elem_ptr = gdlll_get_front_element(gdllc_ptr);
+
+    num_deleted = 0;
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    assert(num_deleted == (NUM_ELEMENTS - 1));
+    assert(gdllc_ptr->total_number_of_elements == 0);
+    assert((gdllc_ptr->first == NULL) && (gdllc_ptr->last == NULL));
+    assert(gdllc_ptr->arena_number_of_blocks_in_use >= 1);
+    assert(gdllc_ptr->arena_number_of_regions > 1);
+    assert(*(long *)(standalone_elem_ptr->data_ptr) == 0);
+
+    gdlll_delete_standalone_element(gdllc_ptr, standalone_elem_ptr);
+    assert(gdllc_ptr->arena_number_of_blocks_in_use == 0);
+
+    for (value = 0; value < 10; value = value + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    assert(gdllc_ptr->arena_number_of_regions == 1);
+
+    // with an index the elements are deleted one by one
+    gdlll_enable_order_statistic_index(gdllc_ptr);
+
+    for (value = 0; value < 1000; value = value + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    assert(gdllc_ptr->arena_number_of_blocks_in_use == 0);
+
+    gdlll_disable_order_statistic_index(gdllc_ptr);
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    printf("arena payloads test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,194 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests asynchronous deletion: the deleted elements (and the old data of
+// replaced elements) are freed by the reclaimer thread, never by the writer.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct key_value {
+    char *str;
+    long key;
+};
+
+static pthread_t writer_thread;
+static long num_deleted;
+static int freed_by_writer;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+static void add_key_value(struct gdll_container *gdllc_ptr, const char *str,
+                          long key);
+static long get_num_deleted(void);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = ((struct key_value *)(first->data_ptr))->key;
+    long j = ((struct key_value *)(second->data_ptr))->key;
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void call_back_func(void *data_ptr)
+{
+
+    free(((struct key_value *)(data_ptr))->str);
+
+    if (pthread_equal(pthread_self(), writer_thread)) {
+        __atomic_store_n(&freed_by_writer, 1, __ATOMIC_RELAXED);
+    }
+
+    __atomic_fetch_add(&num_deleted, 1, __ATOMIC_RELAXED);
+
+    return;
+
+} // end of call_back_func() function
+
+static void add_key_value(struct gdll_container *gdllc_ptr, const char *str,
+                          long key)
+{
+
+    struct key_value kv = {NULL, 0};
+    int retval = 0;
+
+    kv.str = strdup(str);
+    assert(kv.str);
+    kv.key = key;
+
+    retval = gdlll_add_element_to_back(gdllc_ptr, &kv, sizeof(kv));
+    assert(retval == GDLLL_SUCCESS);
+
+    return;
+
+} // end of add_key_value() function
+
+static long get_num_deleted(void)
+{
+
+    return __atomic_load_n(&num_deleted, __ATOMIC_RELAXED);
+
+} // end of get_num_deleted() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct key_value old_kv = {NULL, 0};
+    struct key_value new_kv = {NULL, 0};
+    long i = 0;
+    int retval = 0;
+
+    writer_thread = pthread_self();
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_async_deletion(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    // enabling it again does nothing
+    retval = gdlll_enable_async_deletion(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 20000; i = i + 1) {
+        add_key_value(gdllc_ptr, "hello", i);
+    }
+
+    for (i = 0; i < 10000; i = i + 1) {
+        gdlll_delete_front_element(gdllc_ptr);
+    }
+
+    // the old data of a replaced element is freed by the reclaimer thread too
+    for (i = 10000; i < 10100; i = i + 1) {
+        old_kv.key = i;
+        new_kv.str = strdup("new");
+        assert(new_kv.str);
+        new_kv.key = i;
+        retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &old_kv,
+                                                        sizeof(old_kv),
+                                                        &new_kv,
+                                                        sizeof(new_kv),
+                                                        compare);
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    gdlll_flush_async_deletion(gdllc_ptr);
+    assert(get_num_deleted() == 10100);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                    10000);
+    assert(strcmp(((struct key_value *)(gdlll_peek_front_element(
+                                gdllc_ptr)->data_ptr))->str, "new") == 0);
+
+    // the purged tombstones of lazy deletion
+    gdlll_enable_lazy_deletion(gdllc_ptr, 10);
+
+    for (i = 0; i < 3000; i = i + 1) {
+        gdlll_delete_last_element(gdllc_ptr);
+    }
+
+    gdlll_purge_tombstones(gdllc_ptr);
+    gdlll_flush_async_deletion(gdllc_ptr);
+    assert(get_num_deleted() == 13100);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+    assert(get_num_deleted() == 20100);
+
+    // flush when idle, and disable and enable again
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    gdlll_flush_async_deletion(gdllc_ptr);
+
+    retval = gdlll_enable_async_deletion(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    gdlll_flush_async_deletion(gdllc_ptr);
+    gdlll_disable_async_deletion(gdllc_ptr);
+
+    retval = gdlll_enable_async_deletion(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    add_key_value(gdllc_ptr, "x", 0);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+    assert(get_num_deleted() == 20101);
+
+    assert(!__atomic_load_n(&freed_by_writer, __ATOMIC_RELAXED));
+
+    printf("async deletion test passed\n");
+
+    return 0;
+
+} // end of main() function
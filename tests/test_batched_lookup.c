@@ -0,0 +1,111 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests gdlll_peek_matching_elements() (many keys in one traversal).
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+#define NUM_KEYS 150
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *matching_elem_ptrs[NUM_KEYS];
+    void *data_ptrs[NUM_KEYS];
+    long data_sizes[NUM_KEYS];
+    long keys[NUM_KEYS];
+    long value = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    // every value in 0 to 399 is in the list two or three times
+    for (i = 0; i < 1000; i = i + 1) {
+        value = i % 400;
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    // keys in 400 to 499 are not in the list, and some keys are repeated
+    for (i = 0; i < NUM_KEYS; i = i + 1) {
+        keys[i] = (i * 7) % 500;
+        data_ptrs[i] = &(keys[i]);
+        data_sizes[i] = sizeof(keys[i]);
+    }
+
+    retval = gdlll_peek_matching_elements(gdllc_ptr, data_ptrs, data_sizes,
+                                          NUM_KEYS, compare,
+                                          matching_elem_ptrs);
+    assert(retval == GDLLL_SUCCESS);
+
+    // the first match of every key, as found by one lookup per key
+    for (i = 0; i < NUM_KEYS; i = i + 1) {
+        assert(matching_elem_ptrs[i] ==
+               gdlll_peek_matching_element(gdllc_ptr, &(keys[i]),
+                                           sizeof(keys[i]), compare));
+        assert((matching_elem_ptrs[i] == NULL) == (keys[i] >= 400));
+    }
+
+    // nothing matches in an empty container
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+
+    retval = gdlll_peek_matching_elements(gdllc_ptr, data_ptrs, data_sizes,
+                                          NUM_KEYS, compare,
+                                          matching_elem_ptrs);
+
+    for (i = 0; i < NUM_KEYS; i = i + 1) {
+        assert(matching_elem_ptrs[i] == NULL);
+    }
+
+    retval = gdlll_peek_matching_elements(gdllc_ptr, data_ptrs, data_sizes,
+                                          NUM_KEYS, NULL, matching_elem_ptrs);
+    assert(retval == GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    printf("batched lookup test passed\n");
+
+    return 0;
+
+} // end of main() function
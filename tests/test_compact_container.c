@@ -0,0 +1,161 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the compact container (gdlll_compact_* functions).
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+static long num_deleted;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void call_back_func(void *data_ptr)
+{
+
+    (void)(data_ptr);
+
+    num_deleted = num_deleted + 1;
+
+    return;
+
+} // end of call_back_func() function
+
+int main(void)
+{
+
+    struct gdll_compact_container *gdllcc_ptr = NULL;
+    unsigned int index = 0;
+    long round = 0;
+    long count = 0;
+    long i = 0;
+    long j = 0;
+    int retval = 0;
+
+    gdllcc_ptr = gdlll_compact_init_gdll_container(call_back_func);
+    assert(gdllcc_ptr);
+
+    assert(gdlll_compact_peek_front_element(gdllcc_ptr) ==
+                                                GDLLL_COMPACT_INVALID_INDEX);
+
+    // odd numbers go to the back and even numbers to the front, so the list
+    // is 998, 996, ..., 2, 0, 1, 3, ..., 999
+    for (i = 0; i < 1000; i = i + 1) {
+        if (i % 2) {
+            retval = gdlll_compact_add_element_to_back(gdllcc_ptr, &i,
+                                                       sizeof(i));
+        } else {
+            retval = gdlll_compact_add_element_to_front(gdllcc_ptr, &i,
+                                                        sizeof(i));
+        }
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    assert(gdlll_compact_get_total_number_of_elements_in_gdll_container(
+                                                        gdllcc_ptr) == 1000);
+
+    index = gdlll_compact_peek_front_element(gdllcc_ptr);
+    assert(*(long *)(gdlll_compact_get_data_ptr(gdllcc_ptr, index)) == 998);
+
+    index = gdlll_compact_peek_last_element(gdllcc_ptr);
+    assert(*(long *)(gdlll_compact_get_data_ptr(gdllcc_ptr, index)) == 999);
+    assert(gdlll_compact_get_data_size(gdllcc_ptr, index) == sizeof(long));
+
+    index = gdlll_compact_peek_prev_element(gdllcc_ptr, index);
+    assert(*(long *)(gdlll_compact_get_data_ptr(gdllcc_ptr, index)) == 997);
+
+    // reuse the deleted elements and compact the data pool many times
+    for (round = 0; round < 50; round = round + 1) {
+        for (i = 0; i < 300; i = i + 1) {
+            gdlll_compact_delete_front_element(gdllcc_ptr);
+        }
+        for (i = 0; i < 300; i = i + 1) {
+            j = 5000 + i;
+            gdlll_compact_add_element_to_back(gdllcc_ptr, &j, sizeof(j));
+        }
+    }
+
+    assert(num_deleted == (50 * 300));
+
+    j = 5299;
+    index = gdlll_compact_peek_matching_element(gdllcc_ptr, &j, sizeof(j),
+                                                compare);
+    assert(index != GDLLL_COMPACT_INVALID_INDEX);
+    assert(*(long *)(gdlll_compact_get_data_ptr(gdllcc_ptr, index)) == 5299);
+
+    j = 12345;
+    assert(gdlll_compact_peek_matching_element(gdllcc_ptr, &j, sizeof(j),
+                                    compare) == GDLLL_COMPACT_INVALID_INDEX);
+
+    // the links are consistent in both directions
+    count = 0;
+    index = gdlll_compact_peek_front_element(gdllcc_ptr);
+    while (index != GDLLL_COMPACT_INVALID_INDEX) {
+        count = count + 1;
+        index = gdlll_compact_peek_next_element(gdllcc_ptr, index);
+    }
+    assert(count == 1000);
+
+    count = 0;
+    index = gdlll_compact_peek_last_element(gdllcc_ptr);
+    while (index != GDLLL_COMPACT_INVALID_INDEX) {
+        count = count + 1;
+        index = gdlll_compact_peek_prev_element(gdllcc_ptr, index);
+    }
+    assert(count == 1000);
+
+    // the data pool doesn't grow without bound
+    assert(gdllcc_ptr->data_pool_used_bytes <= (2 * 1000 * sizeof(long)));
+
+    index = gdlll_compact_peek_front_element(gdllcc_ptr);
+    gdlll_compact_delete_element(gdllcc_ptr, index);
+    gdlll_compact_delete_last_element(gdllcc_ptr);
+    assert(gdlll_compact_get_total_number_of_elements_in_gdll_container(
+                                                        gdllcc_ptr) == 998);
+
+    gdlll_compact_delete_gdll_container(gdllcc_ptr);
+
+    assert(num_deleted == ((50 * 300) + 1000));
+
+    printf("compact container test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,160 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the C++20 coroutines of the C++ wrapper (gdll::incremental_operation).
+// This test is built with -std=c++20 (see the Makefile).
+
+#include "generic_doubly_linked_list_library.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <utility>
+
+#if !defined(GDLLL_HAS_COROUTINES)
+#error "this test needs a compiler with C++20 coroutines"
+#endif
+
+namespace {
+
+long num_deleted = 0;
+
+int compare(struct element *first, struct element *second)
+{
+    long i = *static_cast<long *>(first->data_ptr);
+    long j = *static_cast<long *>(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+}
+
+void call_back_func(void *data_ptr)
+{
+    (void)(data_ptr);
+
+    num_deleted = num_deleted + 1;
+}
+
+} // end of anonymous namespace
+
+int main()
+{
+    // the library takes the callback as a 'void *'
+    struct gdll_container *gdllc_ptr = gdlll_init_gdll_container(
+                                reinterpret_cast<void *>(&call_back_func));
+    struct element *matching_elem_ptr = nullptr;
+    long num_slices = 0;
+    long value = 0;
+
+    assert(gdllc_ptr);
+
+    for (long i = 0; i < 10000; i = i + 1) {
+        value = (i * 7919) % 10007;
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    // nothing is done till the first resume()
+    {
+        gdll::incremental_operation op =
+                        gdll::sort_incrementally(gdllc_ptr, compare, 500, 0);
+        assert(gdllc_ptr->continuations == nullptr);
+        assert(op.status() == GDLLL_OPERATION_IS_NOT_COMPLETE);
+
+        while (op.resume()) {
+            num_slices = num_slices + 1;
+        }
+
+        assert(op.done() && (op.status() == GDLLL_SUCCESS));
+        assert(num_slices > 10);
+    }
+
+    for (struct element *elem_ptr = gdllc_ptr->first;
+         (elem_ptr) && (elem_ptr->next); elem_ptr = elem_ptr->next) {
+        assert(compare(elem_ptr, elem_ptr->next) <= 0);
+    }
+
+    value = 9000;
+
+    {
+        gdll::incremental_operation op =
+                        gdll::peek_matching_element_incrementally(gdllc_ptr,
+                                    &value, sizeof(value), compare, 100, 0,
+                                    &matching_elem_ptr);
+        while (op.resume()) {
+            assert(matching_elem_ptr == nullptr);
+        }
+        assert(op.status() == GDLLL_SUCCESS);
+    }
+
+    assert(matching_elem_ptr &&
+           (*static_cast<long *>(matching_elem_ptr->data_ptr) == 9000));
+
+    // an operation that is destroyed before it is complete is cancelled (and
+    // the elements removed by the delete are freed)
+    num_deleted = 0;
+
+    {
+        gdll::incremental_operation op =
+                gdll::delete_all_elements_incrementally(gdllc_ptr, 100, 0);
+        op.resume();
+        op.resume();
+        assert(!op.done());
+        assert(gdllc_ptr->continuations != nullptr);
+        assert(num_deleted == 200);
+    }
+
+    assert(gdllc_ptr->continuations == nullptr);
+    assert(num_deleted == 10000);
+
+    // an operation can be moved
+    for (long i = 0; i < 1000; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    {
+        gdll::incremental_operation op =
+                gdll::delete_all_elements_incrementally(gdllc_ptr, 100, 0);
+        op.resume();
+        assert(!op.done());
+
+        gdll::incremental_operation moved_op(std::move(op));
+        assert(op.done() && (op.status() == GDLLL_SUCCESS));
+
+        while (moved_op.resume()) {
+            ;
+        }
+
+        assert(moved_op.status() == GDLLL_SUCCESS);
+    }
+
+    assert(gdllc_ptr->total_number_of_elements == 0);
+    assert(gdllc_ptr->continuations == nullptr);
+    assert(num_deleted == 11000);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    std::printf("C++ coroutines test passed\n");
+
+    return 0;
+}
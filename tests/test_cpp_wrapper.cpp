@@ -0,0 +1,196 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the C++ wrapper (gdll::list<T> and gdll::element_handle<T>).
+
+#include "generic_doubly_linked_list_library.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// counts the live objects, so that the test can check that the wrapper
+// destroys every object that it constructs
+long num_live_objects = 0;
+
+struct item
+{
+    std::string name;
+    int value;
+
+    item(std::string name_arg, int value_arg)
+        : name(std::move(name_arg)), value(value_arg)
+    {
+        num_live_objects = num_live_objects + 1;
+    }
+
+    item(const item &other) : name(other.name), value(other.value)
+    {
+        num_live_objects = num_live_objects + 1;
+    }
+
+    ~item() { num_live_objects = num_live_objects - 1; }
+};
+
+void test_emplace_and_iterators()
+{
+    gdll::list<item> l;
+
+    assert(l.empty());
+
+    l.emplace_back("b", 2);
+    l.emplace_front("a", 1);
+    l.emplace_back("c", 3);
+
+    assert(l.size() == 3);
+    assert(num_live_objects == 3);
+    assert((l.front().name == "a") && (l.back().value == 3));
+
+    gdll::list<item>::iterator it = std::find_if(l.begin(), l.end(),
+                                    [](const item &i) { return i.value == 2; });
+    assert(it != l.end());
+
+    // erase() returns the iterator to the next element
+    it = l.erase(it);
+    assert(it->value == 3);
+    assert(num_live_objects == 2);
+
+    std::vector<int> values;
+    for (gdll::list<item>::reverse_iterator r = l.rbegin(); r != l.rend();
+         ++r) {
+        values.push_back(r->value);
+    }
+    assert((values == std::vector<int>{3, 1}));
+
+    gdll::list<item>::const_iterator ci = l.cbegin();
+    assert(ci->name == "a");
+    assert(std::distance(l.cbegin(), l.cend()) == 2);
+
+    l.emplace(std::next(l.cbegin()), "middle", 5);
+    assert(std::next(l.begin())->value == 5);
+}
+
+void test_element_handles()
+{
+    gdll::list<item> l;
+
+    l.emplace_back("a", 1);
+    l.emplace_back("b", 2);
+
+    gdll::element_handle<item> h = l.take_front();
+    assert(h && (h->name == "a"));
+    assert(l.size() == 1);
+
+    // the element is put back without constructing a new object
+    l.insert(l.cend(), std::move(h));
+    assert(!h);
+    assert((l.size() == 2) && (l.back().value == 1));
+    assert(num_live_objects == 2);
+
+    gdll::element_handle<item> e = l.extract(std::next(l.begin()));
+    assert(e->value == 1);
+
+    // a handle that goes out of scope deletes its element
+    {
+        gdll::element_handle<item> moved(std::move(e));
+        assert(!e && moved);
+    }
+    assert(num_live_objects == 1);
+
+    l.pop_back();
+    assert(l.empty());
+}
+
+void test_move_and_algorithms()
+{
+    gdll::list<item> l;
+
+    l.emplace_back("a", 1);
+    l.emplace_back("b", 2);
+
+    gdll::list<item> m(std::move(l));
+    assert(l.empty() && (m.size() == 2));
+
+    gdll::list<int> li;
+    for (int i = 0; i < 10; i = i + 1) {
+        li.push_back(9 - i);
+    }
+
+    assert(std::is_sorted(li.rbegin(), li.rend()));
+    std::reverse(li.begin(), li.end());
+    assert(std::is_sorted(li.begin(), li.end()));
+    assert((li.front() == 0) && (li.back() == 9));
+
+    m.clear();
+    assert(m.empty());
+}
+
+int compare_ints(struct element *first, struct element *second)
+{
+    int i = *static_cast<int *>(first->data_ptr);
+    int j = *static_cast<int *>(second->data_ptr);
+
+    return (i < j) ? -1 : ((i == j) ? 0 : 1);
+}
+
+// In priority queue mode the list is still iterated (and popped) in list
+// order, from the first element and not from the smallest one.
+void test_priority_queue_mode()
+{
+    gdll::list<int> li;
+
+    assert(gdlll_enable_priority_queue_mode(li.native_handle(),
+                                            compare_ints) == GDLLL_SUCCESS);
+
+    li.push_back(3);
+    li.push_back(1);
+    li.push_back(2);
+
+    std::vector<int> values(li.begin(), li.end());
+    assert((values == std::vector<int>{3, 1, 2}));
+    assert(li.front() == 3);
+
+    li.pop_front();
+    assert((li.size() == 2) && (li.front() == 1));
+    assert(*static_cast<int *>(
+            gdlll_peek_front_element(li.native_handle())->data_ptr) == 1);
+}
+
+} // end of anonymous namespace
+
+int main()
+{
+    test_emplace_and_iterators();
+    test_element_handles();
+    test_move_and_algorithms();
+    test_priority_queue_mode();
+
+    assert(num_live_objects == 0);
+
+    std::printf("C++ wrapper test passed\n");
+
+    return 0;
+}
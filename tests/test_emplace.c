@@ -0,0 +1,117 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the gdlll_emplace_* functions.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_SLOTS 5
+#define SLOT_SIZE 100
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    void *data_ptrs[NUM_SLOTS];
+    long *long_ptr = NULL;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    long_ptr = gdlll_emplace_element_to_back(gdllc_ptr, sizeof(long));
+    assert(long_ptr);
+    *long_ptr = 2;
+
+    long_ptr = gdlll_emplace_element_to_front(gdllc_ptr, sizeof(long));
+    assert(long_ptr);
+    *long_ptr = 1;
+
+    retval = gdlll_emplace_elements_to_back(gdllc_ptr, SLOT_SIZE, NUM_SLOTS,
+                                            data_ptrs);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < NUM_SLOTS; i = i + 1) {
+        memset(data_ptrs[i], (int)(i), SLOT_SIZE);
+    }
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                            2 + NUM_SLOTS);
+
+    // the data was built in place in the elements
+    elem_ptr = gdlll_peek_front_element(gdllc_ptr);
+    assert(*(long *)(elem_ptr->data_ptr) == 1);
+    assert(elem_ptr->data_size == sizeof(long));
+
+    elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr);
+    assert(*(long *)(elem_ptr->data_ptr) == 2);
+
+    for (i = 0; i < NUM_SLOTS; i = i + 1) {
+        elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr);
+        assert(elem_ptr->data_ptr == data_ptrs[i]);
+        assert(elem_ptr->data_size == SLOT_SIZE);
+        assert(((char *)(elem_ptr->data_ptr))[SLOT_SIZE - 1] == i);
+    }
+
+    assert(elem_ptr == gdlll_peek_last_element(gdllc_ptr));
+
+    // either all the elements are added or none is
+    gdlll_inject_allocation_failures(2, -1);
+    retval = gdlll_emplace_elements_to_back(gdllc_ptr, SLOT_SIZE, NUM_SLOTS,
+                                            data_ptrs);
+    gdlll_inject_allocation_failures(0, 0);
+
+    assert(retval == GDLLL_NO_MEMORY);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                            2 + NUM_SLOTS);
+    assert(gdlll_peek_last_element(gdllc_ptr) == elem_ptr);
+
+    gdlll_inject_allocation_failures(0, 1);
+    long_ptr = gdlll_emplace_element_to_front(gdllc_ptr, sizeof(long));
+    assert(long_ptr == NULL);
+    gdlll_inject_allocation_failures(0, 0);
+
+    // invalid arguments
+    retval = gdlll_emplace_elements_to_back(gdllc_ptr, sizeof(long), 0,
+                                            data_ptrs);
+    assert(retval == GDLLL_NUM_ELEMENTS_IS_INVALID);
+
+    retval = gdlll_emplace_elements_to_back(gdllc_ptr, 0, 1, data_ptrs);
+    assert(retval == GDLLL_DATA_SIZE_IS_INVALID);
+
+    assert(gdlll_emplace_element_to_back(gdllc_ptr, 0) == NULL);
+    assert(gdlll_emplace_element_to_back(NULL, sizeof(long)) == NULL);
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                            2 + NUM_SLOTS);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    printf("emplace test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,191 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests epoch based reclamation: an element that a reader may still be using
+// is not freed until the reader leaves its read section.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#define NUM_READERS 3
+#define NUM_WRITES 20000
+
+static struct gdll_container *shared_gdllc_ptr;
+static long num_deleted;
+static int stop_readers;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+static void *reader(void *arg);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+// The key is set to -1 just before the element is freed, so a reader that
+// sees -1 has read an element that was freed under it.
+static void call_back_func(void *data_ptr)
+{
+
+    *(long *)(data_ptr) = -1;
+
+    num_deleted = num_deleted + 1;
+
+    return;
+
+} // end of call_back_func() function
+
+static void *reader(void *arg)
+{
+
+    struct element *elem_ptr = NULL;
+    int reader_id = (int)(long)(arg);
+    int retval = 0;
+
+    while (!__atomic_load_n(&stop_readers, __ATOMIC_ACQUIRE)) {
+
+        retval = gdlll_epoch_read_lock(shared_gdllc_ptr, reader_id);
+        assert(retval == GDLLL_SUCCESS);
+
+        for (elem_ptr = gdlll_peek_front_element(shared_gdllc_ptr); elem_ptr;
+             elem_ptr = gdlll_peek_next_element(shared_gdllc_ptr, elem_ptr)) {
+            assert(__atomic_load_n((long *)(elem_ptr->data_ptr),
+                                   __ATOMIC_RELAXED) >= 0);
+        }
+
+        gdlll_epoch_read_unlock(shared_gdllc_ptr, reader_id);
+
+    }
+
+    return NULL;
+
+} // end of reader() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    pthread_t readers[NUM_READERS];
+    long data[8];
+    long key = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_epoch_reclamation(gdllc_ptr, 0);
+    assert(retval == GDLLL_NUM_READERS_IS_INVALID);
+
+    retval = gdlll_enable_epoch_reclamation(gdllc_ptr, NUM_READERS + 1);
+    assert(retval == GDLLL_SUCCESS);
+
+    retval = gdlll_epoch_read_lock(gdllc_ptr, NUM_READERS + 1);
+    assert(retval == GDLLL_READER_ID_IS_INVALID);
+
+    for (i = 0; i < 10; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    // a reader in its read section keeps a deleted element alive
+    retval = gdlll_epoch_read_lock(gdllc_ptr, 0);
+    assert(retval == GDLLL_SUCCESS);
+
+    elem_ptr = gdlll_peek_front_element(gdllc_ptr);
+    gdlll_delete_front_element(gdllc_ptr);
+
+    gdlll_epoch_reclaim(gdllc_ptr);
+    gdlll_epoch_reclaim(gdllc_ptr);
+
+    assert(num_deleted == 0);
+    assert(*(long *)(elem_ptr->data_ptr) == 0);
+    assert(*(long *)(gdlll_peek_next_element(gdllc_ptr,
+                                             elem_ptr)->data_ptr) == 1);
+
+    gdlll_epoch_read_unlock(gdllc_ptr, 0);
+
+    assert(gdlll_epoch_reclaim(gdllc_ptr) == 1);
+    assert(num_deleted == 1);
+
+    // readers walk the list while the main thread adds and deletes elements
+    shared_gdllc_ptr = gdllc_ptr;
+
+    for (i = 0; i < NUM_READERS; i = i + 1) {
+        retval = pthread_create(&(readers[i]), NULL, reader, (void *)(i + 1));
+        assert(retval == 0);
+    }
+
+    for (i = 0; i < NUM_WRITES; i = i + 1) {
+
+        data[0] = i;
+        gdlll_add_element_to_back(gdllc_ptr, data,
+                                  (i % 2) ? sizeof(long) : sizeof(data));
+
+        if (gdlll_get_total_number_of_elements_in_gdll_container(
+                                                        gdllc_ptr) <= 50) {
+            continue;
+        }
+
+        if ((i % 3) == 0) {
+            gdlll_delete_front_element(gdllc_ptr);
+        } else if ((i % 3) == 1) {
+            gdlll_delete_last_element(gdllc_ptr);
+        } else {
+            elem_ptr = gdlll_peek_front_element(gdllc_ptr);
+            key = *(long *)(gdlll_peek_next_element(gdllc_ptr,
+                                                    elem_ptr)->data_ptr);
+            gdlll_delete_matching_element(gdllc_ptr, &key, sizeof(key),
+                                          compare);
+        }
+
+    }
+
+    __atomic_store_n(&stop_readers, 1, __ATOMIC_RELEASE);
+
+    for (i = 0; i < NUM_READERS; i = i + 1) {
+        pthread_join(readers[i], NULL);
+    }
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    assert(num_deleted == (NUM_WRITES + 10));
+
+    printf("epoch reclamation test passed\n");
+
+    return 0;
+
+} // end of main() function
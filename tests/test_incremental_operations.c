@@ -0,0 +1,594 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the incremental (budgeted and resumable) scan, delete and sort, with
+// the container being changed between the calls (including deleting the
+// elements that a continuation is on).
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static long num_deleted;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static int compare_tens(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+static void add_random_elements(struct gdll_container *gdllc_ptr,
+                                long num_elements);
+static long check_sorted(struct gdll_container *gdllc_ptr);
+static void delete_element(struct gdll_container *gdllc_ptr,
+                           struct element *elem_ptr);
+static void test_sort(void);
+static void test_scan(void);
+static void test_delete_all(void);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+// Compares only the tens of the keys (for the test of stability).
+static int compare_tens(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr) / 10;
+    long j = *(long *)(second->data_ptr) / 10;
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare_tens() function
+
+static void call_back_func(void *data_ptr)
+{
+
+    (void)(data_ptr);
+
+    num_deleted = num_deleted + 1;
+
+    return;
+
+} // end of call_back_func() function
+
+static void add_random_elements(struct gdll_container *gdllc_ptr,
+                                long num_elements)
+{
+
+    long value = 0;
+    long i = 0;
+
+    for (i = 0; i < num_elements; i = i + 1) {
+        value = rand() % 1000000;
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    return;
+
+} // end of add_random_elements() function
+
+// Checks that the list (without the tombstones) is in ascending order and
+// returns the number of elements in it.
+static long check_sorted(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    long previous = -1;
+    long count = 0;
+
+    for (elem_ptr = gdlll_peek_front_element(gdllc_ptr); elem_ptr;
+         elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr)) {
+        assert(*(long *)(elem_ptr->data_ptr) >= previous);
+        previous = *(long *)(elem_ptr->data_ptr);
+        count = count + 1;
+    }
+
+    return count;
+
+} // end of check_sorted() function
+
+static void delete_element(struct gdll_container *gdllc_ptr,
+                           struct element *elem_ptr)
+{
+
+    elem_ptr = gdlll_get_given_element(gdllc_ptr, elem_ptr);
+    assert(elem_ptr);
+
+    gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+
+    return;
+
+} // end of delete_element() function
+
+static void test_sort(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_continuation cont;
+    struct element *elem_ptr = NULL;
+    long counts[300];
+    long num_elements = 0;
+    long num_calls = 0;
+    long value = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    gdlll_init_continuation(&cont);
+
+    srand(7);
+
+    // a budget of elements
+    add_random_elements(gdllc_ptr, 20000);
+
+    while ((retval = gdlll_sort_incrementally(gdllc_ptr, &cont, compare,
+                                              1000, 0)) ==
+                                        GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        num_calls = num_calls + 1;
+    }
+
+    assert(retval == GDLLL_SUCCESS);
+    assert(num_calls > 20);
+    assert(check_sorted(gdllc_ptr) == 20000);
+    assert(gdllc_ptr->continuations == NULL);
+
+    // a sorted list is one run
+    retval = gdlll_sort_incrementally(gdllc_ptr, &cont, compare, 0, 0);
+    assert(retval == GDLLL_SUCCESS);
+
+    // the sort is stable: the units digit of the keys with the same tens is
+    // the count of the elements with those tens before them (modulo 10)
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+
+    for (i = 0; i < 300; i = i + 1) {
+        counts[i] = 0;
+    }
+
+    for (i = 0; i < 5000; i = i + 1) {
+        value = rand() % 300;
+        counts[value] = counts[value] + 1;
+        value = (value * 10) + ((counts[value] - 1) % 10);
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    retval = gdlll_sort_incrementally(gdllc_ptr, &cont, compare_tens, 0, 0);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 300; i = i + 1) {
+        counts[i] = 0;
+    }
+
+    for (elem_ptr = gdllc_ptr->first; elem_ptr; elem_ptr = elem_ptr->next) {
+        value = *(long *)(elem_ptr->data_ptr);
+        assert((value % 10) == (counts[value / 10] % 10));
+        counts[value / 10] = counts[value / 10] + 1;
+        if (elem_ptr->next) {
+            assert(compare_tens(elem_ptr, elem_ptr->next) <= 0);
+        }
+    }
+
+    // a budget of time, with elements added and deleted (including the ones
+    // that the sort is on) between the calls
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    add_random_elements(gdllc_ptr, 50000);
+    num_elements = 50000;
+    num_calls = 0;
+
+    while ((retval = gdlll_sort_incrementally(gdllc_ptr, &cont, compare, 0,
+                                              100)) ==
+                                        GDLLL_OPERATION_IS_NOT_COMPLETE) {
+
+        num_calls = num_calls + 1;
+
+        if (num_calls >= 200) {
+            continue;
+        }
+
+        add_random_elements(gdllc_ptr, 1);
+        gdlll_delete_front_element(gdllc_ptr);
+
+        for (i = 0; i < 3; i = i + 1) {
+            if (cont.cursors[i]) {
+                delete_element(gdllc_ptr, cont.cursors[i]);
+                num_elements = num_elements - 1;
+            }
+        }
+
+    }
+
+    assert(retval == GDLLL_SUCCESS);
+    assert(check_sorted(gdllc_ptr) == num_elements);
+
+    // with lazy deletion (the tombstones are skipped)
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    gdlll_enable_lazy_deletion(gdllc_ptr, 50);
+    add_random_elements(gdllc_ptr, 3000);
+    num_elements = 3000;
+    num_calls = 0;
+
+    while ((retval = gdlll_sort_incrementally(gdllc_ptr, &cont, compare, 200,
+                                              0)) ==
+                                        GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        num_calls = num_calls + 1;
+        if ((num_calls % 3) == 0) {
+            gdlll_delete_last_element(gdllc_ptr);
+            num_elements = num_elements - 1;
+        }
+    }
+
+    assert(retval == GDLLL_SUCCESS);
+    assert(check_sorted(gdllc_ptr) == num_elements);
+
+    gdlll_disable_lazy_deletion(gdllc_ptr);
+
+    // the order statistic index is right after every call
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    gdlll_enable_order_statistic_index(gdllc_ptr);
+
+    for (i = 0; i < 1000; i = i + 1) {
+        value = 999 - i;
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    while (gdlll_sort_incrementally(gdllc_ptr, &cont, compare, 300, 0) ==
+                                            GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        assert(gdlll_peek_element_at_position(gdllc_ptr, 0) ==
+                                                            gdllc_ptr->first);
+        assert(gdlll_peek_element_at_position(gdllc_ptr, 999) ==
+                                                            gdllc_ptr->last);
+    }
+
+    for (i = 0; i < 1000; i = i + 37) {
+        assert(*(long *)(gdlll_peek_element_at_position(gdllc_ptr,
+                                                    i)->data_ptr) == i);
+    }
+
+    // the readers of epoch based reclamation don't hold a lock
+    gdlll_enable_epoch_reclamation(gdllc_ptr, 1);
+    retval = gdlll_sort_incrementally(gdllc_ptr, &cont, compare, 0, 0);
+    assert(retval == GDLLL_CONTAINER_IS_SHARED);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return;
+
+} // end of test_sort() function
+
+static void test_scan(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_container *dest_gdllc_ptr = NULL;
+    struct gdll_continuation cont;
+    struct element *matching_elem_ptr = NULL;
+    long num_elements = 0;
+    long num_calls = 0;
+    long num_moved = 0;
+    long value = 0;
+    long from = 0;
+    long to = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    gdlll_init_continuation(&cont);
+
+    for (i = 0; i < 10000; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    num_elements = 10000;
+
+    // the last element is found in about (num_elements / 100) calls
+    value = num_elements - 1;
+
+    while ((retval = gdlll_peek_matching_element_incrementally(gdllc_ptr,
+                                &cont, &value, sizeof(value), compare, 100, 0,
+                                &matching_elem_ptr)) ==
+                                        GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        assert(matching_elem_ptr == NULL);
+        num_calls = num_calls + 1;
+    }
+
+    assert(retval == GDLLL_SUCCESS);
+    assert(matching_elem_ptr && (matching_elem_ptr == gdllc_ptr->last));
+    assert(num_calls >= ((num_elements / 100) - 1));
+
+    value = -5;
+
+    while ((retval = gdlll_peek_matching_element_incrementally(gdllc_ptr,
+                                &cont, &value, sizeof(value), compare, 100, 0,
+                                &matching_elem_ptr)) ==
+                                        GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        ;
+    }
+
+    assert(retval == GDLLL_SUCCESS);
+    assert(matching_elem_ptr == NULL);
+
+    // the element that the scan is on is deleted, and the continuation can't
+    // be used for another operation in the meantime
+    value = num_elements - 1;
+
+    retval = gdlll_peek_matching_element_incrementally(gdllc_ptr, &cont,
+                                &value, sizeof(value), compare, 10, 0,
+                                &matching_elem_ptr);
+    assert(retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+
+    retval = gdlll_sort_incrementally(gdllc_ptr, &cont, compare, 10, 0);
+    assert(retval == GDLLL_CONTINUATION_IS_INVALID);
+
+    retval = gdlll_sort_incrementally(gdllc_ptr, NULL, compare, 10, 0);
+    assert(retval == GDLLL_CONTINUATION_IS_INVALID);
+
+    assert(cont.cursors[0]);
+    delete_element(gdllc_ptr, cont.cursors[0]);
+
+    while ((retval = gdlll_peek_matching_element_incrementally(gdllc_ptr,
+                                &cont, &value, sizeof(value), compare, 1000,
+                                0, &matching_elem_ptr)) ==
+                                        GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        ;
+    }
+
+    assert(matching_elem_ptr &&
+           (*(long *)(matching_elem_ptr->data_ptr) == value));
+
+    // A range is moved to another container while the scan is paused before
+    // it. The scan goes on from where it was (and finds the element before
+    // the range).
+    dest_gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(dest_gdllc_ptr);
+
+    value = 3000;
+
+    retval = gdlll_peek_matching_element_incrementally(gdllc_ptr, &cont,
+                                &value, sizeof(value), compare, 10, 0,
+                                &matching_elem_ptr);
+    assert(retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+
+    from = 5000;
+    to = 5999;
+    num_moved = gdlll_get_range(gdllc_ptr, &from, sizeof(from), &to,
+                                sizeof(to), compare,
+                                GDLLL_SEARCH_SORTED_ASCENDING, dest_gdllc_ptr);
+    assert(num_moved == 1000);
+
+    while ((retval = gdlll_peek_matching_element_incrementally(gdllc_ptr,
+                                &cont, &value, sizeof(value), compare, 100,
+                                0, &matching_elem_ptr)) ==
+                                        GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        ;
+    }
+
+    assert(matching_elem_ptr &&
+           (*(long *)(matching_elem_ptr->data_ptr) == value));
+
+    // a scan that is paused in the range goes on from the element after it
+    value = 8000;
+    from = 7000;
+    to = 7999;
+
+    for (i = 0; i < 620; i = i + 1) {
+        retval = gdlll_peek_matching_element_incrementally(gdllc_ptr, &cont,
+                                &value, sizeof(value), compare, 10, 0,
+                                &matching_elem_ptr);
+        assert(retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+    }
+
+    assert(cont.cursors[0] &&
+           (*(long *)(cont.cursors[0]->data_ptr) >= from) &&
+           (*(long *)(cont.cursors[0]->data_ptr) <= to));
+
+    num_moved = gdlll_get_range(gdllc_ptr, &from, sizeof(from), &to,
+                                sizeof(to), compare,
+                                GDLLL_SEARCH_SORTED_ASCENDING, dest_gdllc_ptr);
+    assert(num_moved == 1000);
+    assert(*(long *)(cont.cursors[0]->data_ptr) == value);
+
+    while ((retval = gdlll_peek_matching_element_incrementally(gdllc_ptr,
+                                &cont, &value, sizeof(value), compare, 100,
+                                0, &matching_elem_ptr)) ==
+                                        GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        ;
+    }
+
+    assert(matching_elem_ptr &&
+           (*(long *)(matching_elem_ptr->data_ptr) == value));
+
+    gdlll_delete_gdll_container(dest_gdllc_ptr);
+
+    // a cancelled scan
+    retval = gdlll_peek_matching_element_incrementally(gdllc_ptr, &cont,
+                                &value, sizeof(value), compare, 10, 0,
+                                &matching_elem_ptr);
+    assert(retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+
+    gdlll_cancel_continuation(&cont);
+    assert(gdllc_ptr->continuations == NULL);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return;
+
+} // end of test_scan() function
+
+static void test_delete_all(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_continuation cont;
+    struct gdll_continuation scan_cont;
+    struct element *matching_elem_ptr = NULL;
+    long num_calls = 0;
+    long value = 5000;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    gdlll_init_continuation(&cont);
+    gdlll_init_continuation(&scan_cont);
+
+    for (i = 0; i < 10000; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    retval = gdlll_peek_matching_element_incrementally(gdllc_ptr, &scan_cont,
+                                &value, sizeof(value), compare, 10, 0,
+                                &matching_elem_ptr);
+    assert(retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+
+    // the container is empty after the first call
+    num_deleted = 0;
+
+    retval = gdlll_delete_all_elements_incrementally(gdllc_ptr, &cont, 500, 0);
+    assert(retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+    assert(gdllc_ptr->total_number_of_elements == 0);
+    assert(gdllc_ptr->first == NULL);
+    assert(num_deleted == 500);
+
+    // the scan that was on the removed elements finds nothing
+    retval = gdlll_peek_matching_element_incrementally(gdllc_ptr, &scan_cont,
+                                &value, sizeof(value), compare, 10, 0,
+                                &matching_elem_ptr);
+    assert(retval == GDLLL_SUCCESS);
+    assert(matching_elem_ptr == NULL);
+
+    // the elements added in between are not deleted
+    for (i = 0; i < 10; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    while ((retval = gdlll_delete_all_elements_incrementally(gdllc_ptr, &cont,
+                                                             500, 0)) ==
+                                        GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        ;
+    }
+
+    assert(retval == GDLLL_SUCCESS);
+    assert(num_deleted == 10000);
+    assert(gdllc_ptr->total_number_of_elements == 10);
+
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+
+    // with an index and lazy deletion, the elements are deleted from the front
+    gdlll_enable_integer_key_index(gdllc_ptr);
+    gdlll_enable_lazy_deletion(gdllc_ptr, 50);
+
+    for (i = 0; i < 3000; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    for (i = 5; i < 3000; i = i + 7) {
+        gdlll_delete_matching_element(gdllc_ptr, &i, sizeof(i), compare);
+    }
+
+    num_deleted = 0;
+
+    while ((retval = gdlll_delete_all_elements_incrementally(gdllc_ptr, &cont,
+                                                             100, 0)) ==
+                                        GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        num_calls = num_calls + 1;
+    }
+
+    assert(retval == GDLLL_SUCCESS);
+    assert(num_calls > 10);
+    assert(gdllc_ptr->total_number_of_elements == 0);
+    assert(gdllc_ptr->number_of_tombstones == 0);
+    assert(num_deleted == 3000);
+
+    gdlll_disable_lazy_deletion(gdllc_ptr);
+    gdlll_disable_integer_key_index(gdllc_ptr);
+
+    // an arena that is disabled while a delete is pending
+    gdlll_enable_arena_mode(gdllc_ptr, GDLLL_NO_NUMA_NODE);
+
+    for (i = 0; i < 5000; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    num_deleted = 0;
+
+    retval = gdlll_delete_all_elements_incrementally(gdllc_ptr, &cont, 100, 0);
+    assert(retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+
+    gdlll_disable_arena_mode(gdllc_ptr);
+    assert(num_deleted == 5000);
+
+    retval = gdlll_delete_all_elements_incrementally(gdllc_ptr, &cont, 100, 0);
+    assert(retval == GDLLL_SUCCESS);
+
+    // the container is deleted while a delete is pending
+    for (i = 0; i < 5000; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    num_deleted = 0;
+
+    retval = gdlll_delete_all_elements_incrementally(gdllc_ptr, &cont, 100, 0);
+    assert(retval == GDLLL_OPERATION_IS_NOT_COMPLETE);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+    assert(num_deleted == 5000);
+    assert(cont.operation == 0);
+
+    return;
+
+} // end of test_delete_all() function
+
+int main(void)
+{
+
+    test_sort();
+
+    test_scan();
+
+    test_delete_all();
+
+    printf("incremental operations test passed\n");
+
+    return 0;
+
+} // end of main() function
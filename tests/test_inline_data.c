@@ -0,0 +1,189 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests that payloads of up to GDLLL_INLINE_DATA_SIZE bytes are stored inside
+// the memory block of the element, that the memory block of an element with a
+// bigger payload has no inline area, and that the data of an element can move
+// between the inline area and a separate allocation.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+// the inline data area starts at 'struct element' rounded up to 16 bytes
+#define INLINE_DATA_OFFSET ((sizeof(struct element) + 15) & ~((size_t)(15)))
+
+struct big_data
+{
+    long key;
+    char pad[100];
+};
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static int is_inline(struct element *elem_ptr);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static int is_inline(struct element *elem_ptr)
+{
+
+    return (((char *)(elem_ptr->data_ptr)) ==
+                                (((char *)(elem_ptr)) + INLINE_DATA_OFFSET));
+
+} // end of is_inline() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    struct big_data big;
+    long key = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    memset(&big, 7, sizeof(big));
+
+    // every third element has a big payload
+    for (i = 0; i < 100; i = i + 1) {
+        if (i % 3) {
+            retval = gdlll_add_element_sorted_ascending(gdllc_ptr, &i,
+                                                        sizeof(i), compare);
+        } else {
+            big.key = i;
+            retval = gdlll_add_element_sorted_ascending(gdllc_ptr, &big,
+                                                        sizeof(big), compare);
+        }
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    i = 0;
+    elem_ptr = gdlll_peek_front_element(gdllc_ptr);
+
+    while (elem_ptr) {
+        assert(*(long *)(elem_ptr->data_ptr) == i);
+        assert((((size_t)(elem_ptr->data_ptr)) & 15) == 0);
+        assert(is_inline(elem_ptr) == ((i % 3) != 0));
+        if ((i % 3) == 0) {
+            assert(((char *)(elem_ptr->data_ptr))[sizeof(big) - 1] == 7);
+        }
+        i = i + 1;
+        elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr);
+    }
+
+    assert(i == 100);
+
+    // a payload of exactly GDLLL_INLINE_DATA_SIZE bytes is still inline
+    memset(&big, 9, sizeof(big));
+    big.key = 1000;
+    retval = gdlll_add_element_to_back(gdllc_ptr, &big,
+                                       GDLLL_INLINE_DATA_SIZE);
+    assert(retval == GDLLL_SUCCESS);
+    assert(is_inline(gdlll_peek_last_element(gdllc_ptr)));
+
+    retval = gdlll_add_element_to_back(gdllc_ptr, &big,
+                                       GDLLL_INLINE_DATA_SIZE + 1);
+    assert(retval == GDLLL_SUCCESS);
+    assert(!is_inline(gdlll_peek_last_element(gdllc_ptr)));
+
+    // small to small, small to big and big to small replacements
+    key = 4;
+    big.key = 4;
+
+    retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &key,
+                                                    sizeof(key), &key,
+                                                    sizeof(key), compare);
+    assert(retval == GDLLL_SUCCESS);
+
+    retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &key,
+                                                    sizeof(key), &big,
+                                                    sizeof(big), compare);
+    assert(retval == GDLLL_SUCCESS);
+
+    elem_ptr = gdlll_peek_matching_element(gdllc_ptr, &key, sizeof(key),
+                                           compare);
+    assert(elem_ptr->data_size == sizeof(big));
+    assert(!is_inline(elem_ptr));
+    assert(((char *)(elem_ptr->data_ptr))[sizeof(big) - 1] == 9);
+
+    retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &key,
+                                                    sizeof(key), &key,
+                                                    sizeof(key), compare);
+    assert(retval == GDLLL_SUCCESS);
+
+    elem_ptr = gdlll_peek_matching_element(gdllc_ptr, &key, sizeof(key),
+                                           compare);
+    assert(elem_ptr->data_size == sizeof(key));
+    assert(is_inline(elem_ptr));
+    assert(*(long *)(elem_ptr->data_ptr) == 4);
+
+    // the memory block of an element that was added with a big payload has no
+    // inline data area, so small new data is not inline in it
+    key = 3;
+
+    retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &key,
+                                                    sizeof(key), &key,
+                                                    sizeof(key), compare);
+    assert(retval == GDLLL_SUCCESS);
+
+    elem_ptr = gdlll_peek_matching_element(gdllc_ptr, &key, sizeof(key),
+                                           compare);
+    assert(elem_ptr->data_size == sizeof(key));
+    assert(!is_inline(elem_ptr));
+    assert(*(long *)(elem_ptr->data_ptr) == 3);
+
+    // a standalone element keeps its data (0 is big and 1 is inline)
+    elem_ptr = gdlll_get_front_element(gdllc_ptr);
+    assert(!is_inline(elem_ptr));
+    assert(*(long *)(elem_ptr->data_ptr) == 0);
+    gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+
+    elem_ptr = gdlll_get_front_element(gdllc_ptr);
+    assert(is_inline(elem_ptr));
+    assert(*(long *)(elem_ptr->data_ptr) == 1);
+    gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    printf("inline data test passed\n");
+
+    return 0;
+
+} // end of main() function
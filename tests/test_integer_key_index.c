@@ -0,0 +1,201 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the integer key index. Every lookup is checked against a scan of the
+// list.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void check_index(struct gdll_container *gdllc_ptr);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void check_index(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    struct element *lower_bound_elem_ptr = NULL;
+    long lower_bound = 0;
+    long value = 0;
+    long key = 0;
+    int found = 0;
+
+    for (key = -3; key < 2100; key = key + 7) {
+
+        elem_ptr = gdlll_peek_element_with_integer_key(gdllc_ptr, key);
+        if (elem_ptr) {
+            assert(*(long *)(elem_ptr->data_ptr) == key);
+        } else {
+            assert(!gdlll_peek_matching_element(gdllc_ptr, &key, sizeof(key),
+                                                compare));
+        }
+
+        // the smallest value >= key (elements smaller than a long are not
+        // in the index)
+        found = 0;
+        lower_bound = LONG_MAX;
+        for (elem_ptr = gdlll_peek_front_element(gdllc_ptr); elem_ptr;
+             elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr)) {
+            if (elem_ptr->data_size < (long)(sizeof(long))) {
+                continue;
+            }
+            value = *(long *)(elem_ptr->data_ptr);
+            if ((value >= key) && (value <= lower_bound)) {
+                lower_bound = value;
+                found = 1;
+            }
+        }
+
+        lower_bound_elem_ptr = gdlll_peek_lower_bound_element_with_integer_key(
+                                                            gdllc_ptr, key);
+        assert((lower_bound_elem_ptr != NULL) == found);
+        if (lower_bound_elem_ptr) {
+            assert(*(long *)(lower_bound_elem_ptr->data_ptr) == lower_bound);
+        }
+
+    }
+
+    return;
+
+} // end of check_index() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    long *long_ptr = NULL;
+    long num_elements = 0;
+    long new_value = 0;
+    long value = 0;
+    long i = 0;
+    char small = 'x';
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    srand(5);
+
+    for (i = 0; i < 300; i = i + 1) {
+        value = rand() % 2000;
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    // the index is not enabled yet
+    assert(gdlll_peek_element_with_integer_key(gdllc_ptr, value) == NULL);
+
+    retval = gdlll_enable_integer_key_index(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+    check_index(gdllc_ptr);
+
+    // the index follows adds, deletes and replacements
+    for (i = 0; i < 300; i = i + 1) {
+        value = rand() % 2000;
+        if ((i % 3) == 0) {
+            gdlll_add_element_sorted_ascending(gdllc_ptr, &value,
+                                               sizeof(value), compare);
+        } else if ((i % 3) == 1) {
+            gdlll_delete_matching_element(gdllc_ptr, &value, sizeof(value),
+                                          compare);
+        } else {
+            new_value = value + 1;
+            gdlll_replace_data_in_matching_element(gdllc_ptr, &value,
+                                                   sizeof(value), &new_value,
+                                                   sizeof(new_value), compare);
+        }
+    }
+
+    gdlll_add_element_to_front(gdllc_ptr, &small, sizeof(small));
+    check_index(gdllc_ptr);
+
+    // an emplaced element is found once its data has been written
+    long_ptr = gdlll_emplace_element_to_back(gdllc_ptr, sizeof(long));
+    assert(long_ptr);
+    *long_ptr = 2099;
+    assert(gdlll_peek_element_with_integer_key(gdllc_ptr, 2099) ==
+                                        gdlll_peek_last_element(gdllc_ptr));
+
+    value = LONG_MAX;
+    gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    assert(gdlll_peek_lower_bound_element_with_integer_key(gdllc_ptr,
+                        LONG_MAX - 5) == gdlll_peek_last_element(gdllc_ptr));
+
+    gdlll_delete_last_element(gdllc_ptr);
+    assert(gdlll_peek_lower_bound_element_with_integer_key(gdllc_ptr,
+                                                    LONG_MAX - 5) == NULL);
+
+    // an add that can't grow the full index array fails with GDLLL_NO_MEMORY
+    // and leaves the container and the index as they were
+    value = 3000;
+
+    while (gdllc_ptr->integer_key_index_size <
+                                    gdllc_ptr->integer_key_index_capacity) {
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+        value = value + 1;
+    }
+
+    num_elements = gdllc_ptr->total_number_of_elements;
+
+    gdlll_inject_allocation_failures(1, 1);
+    retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    gdlll_inject_allocation_failures(0, 0);
+    assert(retval == GDLLL_NO_MEMORY);
+    assert(gdllc_ptr->total_number_of_elements == num_elements);
+    assert(gdlll_peek_element_with_integer_key(gdllc_ptr, value) == NULL);
+    check_index(gdllc_ptr);
+
+    retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    assert(retval == GDLLL_SUCCESS);
+    assert(gdlll_peek_element_with_integer_key(gdllc_ptr, value) ==
+                                        gdlll_peek_last_element(gdllc_ptr));
+
+    check_index(gdllc_ptr);
+
+    gdlll_disable_integer_key_index(gdllc_ptr);
+    assert(gdlll_peek_element_with_integer_key(gdllc_ptr, 2099) == NULL);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    printf("integer key index test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,213 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests lazy deletion (tombstones and their purge).
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+static long num_deleted;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+static long count_live_elements(struct gdll_container *gdllc_ptr);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void call_back_func(void *data_ptr)
+{
+
+    (void)(data_ptr);
+
+    num_deleted = num_deleted + 1;
+
+    return;
+
+} // end of call_back_func() function
+
+// Walks the list in both directions (skipping the tombstones) and returns the
+// number of elements seen. The deleted keys are the even numbers in 10 to 88.
+static long count_live_elements(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    long forward_count = 0;
+    long backward_count = 0;
+    long key = 0;
+
+    for (elem_ptr = gdlll_peek_front_element(gdllc_ptr); elem_ptr;
+         elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr)) {
+        key = *(long *)(elem_ptr->data_ptr);
+        assert((key < 10) || (key >= 90) || (key % 2));
+        forward_count = forward_count + 1;
+    }
+
+    for (elem_ptr = gdlll_peek_last_element(gdllc_ptr); elem_ptr;
+         elem_ptr = gdlll_peek_prev_element(gdllc_ptr, elem_ptr)) {
+        backward_count = backward_count + 1;
+    }
+
+    assert(forward_count == backward_count);
+
+    return forward_count;
+
+} // end of count_live_elements() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long num_tombstones = 0;
+    long num_elements = 0;
+    long key = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_lazy_deletion(gdllc_ptr, 101);
+    assert(retval == GDLLL_PERCENT_IS_INVALID);
+
+    // 0 means that the tombstones are purged only by gdlll_purge_tombstones()
+    retval = gdlll_enable_lazy_deletion(gdllc_ptr, 0);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 100; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    retval = gdlll_enable_integer_key_index(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 10; i < 90; i = i + 2) {
+        gdlll_delete_matching_element(gdllc_ptr, &i, sizeof(i), compare);
+    }
+
+    // the data of a tombstone is not deleted till it is purged
+    assert(num_deleted == 0);
+    assert(gdllc_ptr->number_of_tombstones == 40);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                        60);
+    assert(count_live_elements(gdllc_ptr) == 60);
+
+    // a tombstone is not found by any search
+    key = 20;
+    assert(!gdlll_peek_matching_element(gdllc_ptr, &key, sizeof(key),
+                                        compare));
+    assert(!gdlll_peek_matching_element_using_strategy(gdllc_ptr, &key,
+                            sizeof(key), compare, GDLLL_SEARCH_BACKWARD));
+    assert(!gdlll_peek_matching_element_using_strategy(gdllc_ptr, &key,
+                            sizeof(key), compare, GDLLL_SEARCH_FROM_BOTH_ENDS));
+    assert(!gdlll_peek_matching_element_using_strategy(gdllc_ptr, &key,
+                        sizeof(key), compare, GDLLL_SEARCH_SORTED_ASCENDING));
+    assert(gdlll_count_matching_elements(gdllc_ptr, &key, sizeof(key),
+                                         compare) == 0);
+    assert(!gdlll_peek_element_with_integer_key(gdllc_ptr, key));
+
+    elem_ptr = gdlll_peek_lower_bound_element_with_integer_key(gdllc_ptr, key);
+    assert(*(long *)(elem_ptr->data_ptr) == 21);
+
+    key = 21;
+    assert(gdlll_count_matching_elements(gdllc_ptr, &key, sizeof(key),
+                                         compare) == 1);
+
+    // the first and the last elements are never tombstones
+    for (i = 0; i < 15; i = i + 1) {
+        gdlll_delete_front_element(gdllc_ptr);
+        gdlll_delete_last_element(gdllc_ptr);
+    }
+
+    assert(count_live_elements(gdllc_ptr) ==
+           gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr));
+
+    elem_ptr = gdlll_get_front_element(gdllc_ptr);
+    assert(*(long *)(elem_ptr->data_ptr) % 2);
+    gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+
+    num_tombstones = gdllc_ptr->number_of_tombstones;
+    num_elements =
+            gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr);
+
+    assert(num_tombstones > 0);
+    assert(gdlll_purge_tombstones(gdllc_ptr) == num_tombstones);
+    assert(gdllc_ptr->number_of_tombstones == 0);
+    assert(count_live_elements(gdllc_ptr) == num_elements);
+
+    // the tombstones are purged automatically when they are 50% of the list
+    gdlll_disable_lazy_deletion(gdllc_ptr);
+    retval = gdlll_enable_lazy_deletion(gdllc_ptr, 50);
+    assert(retval == GDLLL_SUCCESS);
+
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    assert(gdllc_ptr->number_of_tombstones == 0);
+    assert(num_deleted == 100);
+
+    for (i = 0; i < 100; i = i + 1) {
+        gdlll_add_element_sorted_ascending(gdllc_ptr, &i, sizeof(i), compare);
+    }
+
+    for (i = 1; i < 99; i = i + 2) {
+        gdlll_delete_matching_element(gdllc_ptr, &i, sizeof(i), compare);
+        assert(gdllc_ptr->number_of_tombstones <=
+               gdlll_get_total_number_of_elements_in_gdll_container(
+                                                                gdllc_ptr));
+    }
+
+    key = 51;
+    assert(!gdlll_peek_matching_element(gdllc_ptr, &key, sizeof(key),
+                                        compare));
+
+    for (i = 0; i < 100; i = i + 2) {
+        assert(gdlll_delete_all_matching_elements(gdllc_ptr, &i, sizeof(i),
+                                                  compare) == 1);
+    }
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                        1);
+    assert(*(long *)(gdlll_peek_front_element(gdllc_ptr)->data_ptr) == 99);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    assert(num_deleted == 200);
+
+    printf("lazy deletion test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,391 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests memory accounting (per container and process wide) and memory limits
+// with and without an eviction policy.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static struct element *choose_no_element(struct gdll_container *gdllc_ptr);
+static void assert_list_is_sorted(struct gdll_container *gdllc_ptr);
+static void test_accounting(void);
+static void test_memory_limit(void);
+static void test_hint_is_evicted(void);
+static void test_moved_range_is_accounted(void);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static struct element *choose_no_element(struct gdll_container *gdllc_ptr)
+{
+
+    (void)(gdllc_ptr);
+
+    return NULL;
+
+} // end of choose_no_element() function
+
+static void assert_list_is_sorted(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    long count = 0;
+
+    for (elem_ptr = gdllc_ptr->first; elem_ptr; elem_ptr = elem_ptr->next) {
+        if (elem_ptr->next) {
+            assert(compare(elem_ptr, elem_ptr->next) <= 0);
+        }
+        count = count + 1;
+    }
+
+    assert(count == gdllc_ptr->total_number_of_elements);
+
+    return;
+
+} // end of assert_list_is_sorted() function
+
+static void test_accounting(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_container *dest_gdllc_ptr = NULL;
+    struct gdll_continuation cont;
+    char big_data[200];
+    long global_memory = 0;
+    long element_memory = 0;
+    long memory = 0;
+    long num_moved = 0;
+    long from = 10;
+    long to = 20;
+    long key = 0;
+    long i = 0;
+    int retval = 0;
+
+    global_memory = gdlll_get_global_memory_in_use();
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+    assert(gdlll_get_memory_in_use(gdllc_ptr) == 0);
+
+    // every element with the same data size costs the same
+    gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    element_memory = gdlll_get_memory_in_use(gdllc_ptr);
+    assert(element_memory > (long)(sizeof(long)));
+
+    for (i = 1; i < 100; i = i + 1) {
+        retval = gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    assert(gdlll_get_memory_in_use(gdllc_ptr) == (100 * element_memory));
+    assert((gdlll_get_global_memory_in_use() - global_memory) ==
+                                            gdlll_get_memory_in_use(gdllc_ptr));
+
+    // a bigger payload costs at least its size
+    memset(big_data, 1, sizeof(big_data));
+    memory = gdlll_get_memory_in_use(gdllc_ptr);
+    gdlll_add_element_to_back(gdllc_ptr, big_data, sizeof(big_data));
+    assert((gdlll_get_memory_in_use(gdllc_ptr) - memory) >=
+                                                (long)(sizeof(big_data)));
+
+    gdlll_delete_last_element(gdllc_ptr);
+    assert(gdlll_get_memory_in_use(gdllc_ptr) == memory);
+
+    // a payload made bigger by a replace is counted
+    key = 0;
+    retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &key,
+                                                    sizeof(key), big_data,
+                                                    sizeof(big_data),
+                                                    compare);
+    assert(retval == GDLLL_SUCCESS);
+    assert((gdlll_get_memory_in_use(gdllc_ptr) - memory) ==
+                        ((long)(sizeof(big_data)) - GDLLL_INLINE_DATA_SIZE));
+
+    gdlll_delete_front_element(gdllc_ptr);
+    assert(gdlll_get_memory_in_use(gdllc_ptr) == (99 * element_memory));
+
+    // a tombstone is not in the list any more
+    gdlll_enable_lazy_deletion(gdllc_ptr, 0);
+    gdlll_delete_last_element(gdllc_ptr);
+    assert(gdlll_get_memory_in_use(gdllc_ptr) == (98 * element_memory));
+    gdlll_disable_lazy_deletion(gdllc_ptr);
+
+    // the elements removed by a gdlll_get_* function are not counted
+    dest_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(dest_gdllc_ptr);
+
+    num_moved = gdlll_get_range(gdllc_ptr, &from, sizeof(from), &to,
+                                sizeof(to), compare,
+                                GDLLL_SEARCH_SORTED_ASCENDING, dest_gdllc_ptr);
+    assert(num_moved == 11);
+    assert(gdlll_get_memory_in_use(gdllc_ptr) == (87 * element_memory));
+    assert(gdlll_get_memory_in_use(dest_gdllc_ptr) == (11 * element_memory));
+
+    // an incremental delete and a delete of all the elements
+    gdlll_init_continuation(&cont);
+
+    while (gdlll_delete_all_elements_incrementally(gdllc_ptr, &cont, 5, 0) ==
+                                            GDLLL_OPERATION_IS_NOT_COMPLETE) {
+        ;
+    }
+
+    assert(gdlll_get_memory_in_use(gdllc_ptr) == 0);
+
+    gdlll_delete_all_elements_in_gdll_container(dest_gdllc_ptr);
+    assert(gdlll_get_memory_in_use(dest_gdllc_ptr) == 0);
+
+    // the fast delete of all the elements of an arena
+    gdlll_enable_arena_mode(dest_gdllc_ptr, GDLLL_NO_NUMA_NODE);
+
+    for (i = 0; i < 50; i = i + 1) {
+        gdlll_add_element_to_back(dest_gdllc_ptr, &i, sizeof(i));
+    }
+
+    assert(gdlll_get_memory_in_use(dest_gdllc_ptr) == (50 * element_memory));
+
+    gdlll_delete_all_elements_in_gdll_container(dest_gdllc_ptr);
+    assert(gdlll_get_memory_in_use(dest_gdllc_ptr) == 0);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+    gdlll_delete_gdll_container(dest_gdllc_ptr);
+
+    assert(gdlll_get_global_memory_in_use() == global_memory);
+
+    return;
+
+} // end of test_accounting() function
+
+static void test_memory_limit(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    char big_data[1000];
+    char *huge_data = NULL;
+    long num_elements = 0;
+    long max_bytes = 0;
+    long value = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    for (i = 0; i < 100; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    num_elements = 100;
+    max_bytes = gdlll_get_memory_in_use(gdllc_ptr);
+
+    // no eviction policy
+    gdlll_set_memory_limit(gdllc_ptr, max_bytes, NULL);
+
+    value = 500;
+    retval = gdlll_add_element_to_front(gdllc_ptr, &value, sizeof(value));
+    assert(retval == GDLLL_MEMORY_LIMIT_IS_REACHED);
+
+    // an eviction policy that doesn't choose any element
+    gdlll_set_memory_limit(gdllc_ptr, max_bytes, choose_no_element);
+
+    retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    assert(retval == GDLLL_MEMORY_LIMIT_IS_REACHED);
+    assert(gdlll_emplace_element_to_back(gdllc_ptr, sizeof(value)) == NULL);
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                num_elements);
+
+    // the oldest element is evicted
+    gdlll_set_memory_limit(gdllc_ptr, max_bytes,
+                           gdlll_choose_front_element_to_evict);
+
+    retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    assert(retval == GDLLL_SUCCESS);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                num_elements);
+    assert(*(long *)(gdllc_ptr->first->data_ptr) == 1);
+    assert(*(long *)(gdllc_ptr->last->data_ptr) == 500);
+
+    // a big element evicts several
+    memset(big_data, 2, sizeof(big_data));
+
+    retval = gdlll_add_element_to_back(gdllc_ptr, big_data, sizeof(big_data));
+    assert(retval == GDLLL_SUCCESS);
+    assert(gdlll_get_memory_in_use(gdllc_ptr) <= max_bytes);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) <
+                                                                num_elements);
+
+    num_elements =
+            gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr);
+    retval = gdlll_add_element_at_position(gdllc_ptr, num_elements, big_data,
+                                           sizeof(big_data));
+    assert(retval == GDLLL_SUCCESS);
+    assert(gdlll_get_memory_in_use(gdllc_ptr) <= max_bytes);
+
+    // an element bigger than the limit can't be added
+    huge_data = calloc(1, (size_t)(max_bytes + 10));
+    assert(huge_data);
+
+    num_elements =
+            gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr);
+    retval = gdlll_add_element_to_back(gdllc_ptr, huge_data, max_bytes + 10);
+    assert(retval == GDLLL_MEMORY_LIMIT_IS_REACHED);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                num_elements);
+
+    free(huge_data);
+
+    // no limit
+    gdlll_set_memory_limit(gdllc_ptr, 0, NULL);
+
+    retval = gdlll_add_element_to_back(gdllc_ptr, big_data, sizeof(big_data));
+    assert(retval == GDLLL_SUCCESS);
+    assert(gdlll_get_memory_in_use(gdllc_ptr) > max_bytes);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return;
+
+} // end of test_memory_limit() function
+
+// The hint is the front element, which is evicted by the insertion that was
+// given the hint.
+static void test_hint_is_evicted(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *hint_elem_ptr = NULL;
+    long value = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    for (i = 10; i < 14; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    gdlll_set_memory_limit(gdllc_ptr, gdlll_get_memory_in_use(gdllc_ptr),
+                           gdlll_choose_front_element_to_evict);
+
+    for (i = 0; i < 20; i = i + 1) {
+        hint_elem_ptr = gdlll_peek_front_element(gdllc_ptr);
+        value = 5 + ((i * 7) % 20);
+        retval = gdlll_add_element_sorted_ascending_near_hint(gdllc_ptr,
+                                        &value, sizeof(value), compare,
+                                        hint_elem_ptr);
+        assert(retval == GDLLL_SUCCESS);
+        assert(gdlll_get_total_number_of_elements_in_gdll_container(
+                                                            gdllc_ptr) == 4);
+        assert_list_is_sorted(gdllc_ptr);
+    }
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return;
+
+} // end of test_hint_is_evicted() function
+
+// A range moved in O(1) by gdlll_get_range() takes its memory with it.
+static void test_moved_range_is_accounted(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_container *dest_gdllc_ptr = NULL;
+    char data[200];
+    long total_memory = 0;
+    long from = 10;
+    long to = 20;
+    long num_moved = 0;
+    long i = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    dest_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr && dest_gdllc_ptr);
+
+    memset(data, 0, sizeof(data));
+
+    // payloads of different sizes
+    for (i = 0; i < 50; i = i + 1) {
+        *(long *)(data) = i;
+        gdlll_add_element_sorted_ascending(gdllc_ptr, data,
+                                    (long)(sizeof(long)) + ((i % 3) * 90),
+                                    compare);
+    }
+
+    total_memory = gdlll_get_memory_in_use(gdllc_ptr);
+
+    num_moved = gdlll_get_range(gdllc_ptr, &from, sizeof(from), &to,
+                                sizeof(to), compare,
+                                GDLLL_SEARCH_SORTED_ASCENDING, dest_gdllc_ptr);
+    assert(num_moved == 11);
+
+    assert((gdlll_get_memory_in_use(gdllc_ptr) +
+            gdlll_get_memory_in_use(dest_gdllc_ptr)) == total_memory);
+
+    gdlll_delete_all_elements_in_gdll_container(dest_gdllc_ptr);
+    assert(gdlll_get_memory_in_use(dest_gdllc_ptr) == 0);
+
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    assert(gdlll_get_memory_in_use(gdllc_ptr) == 0);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+    gdlll_delete_gdll_container(dest_gdllc_ptr);
+
+    return;
+
+} // end of test_moved_range_is_accounted() function
+
+int main(void)
+{
+
+    test_accounting();
+
+    test_memory_limit();
+
+    test_hint_is_evicted();
+
+    test_moved_range_is_accounted();
+
+    printf("memory accounting test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,169 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the multimap/multiset functions (gdlll_count_matching_elements(),
+// gdlll_peek_equal_range(), gdlll_get_all_matching_elements() and
+// gdlll_delete_all_matching_elements()).
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_KEYS 10
+
+static long num_deleted;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void call_back_func(void *data_ptr)
+{
+
+    (void)(data_ptr);
+
+    num_deleted = num_deleted + 1;
+
+    return;
+
+} // end of call_back_func() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_container *dest_gdllc_ptr = NULL;
+    struct element *range_first_ptr = NULL;
+    struct element *range_last_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long counts[NUM_KEYS];
+    long key = 0;
+    long i = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    dest_gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr && dest_gdllc_ptr);
+
+    for (key = 0; key < NUM_KEYS; key = key + 1) {
+        counts[key] = 0;
+    }
+
+    srand(3);
+
+    for (i = 0; i < 400; i = i + 1) {
+        key = rand() % NUM_KEYS;
+        counts[key] = counts[key] + 1;
+        gdlll_add_element_sorted_ascending(gdllc_ptr, &key, sizeof(key),
+                                           compare);
+    }
+
+    for (key = 0; key < NUM_KEYS; key = key + 1) {
+
+        assert(gdlll_count_matching_elements(gdllc_ptr, &key, sizeof(key),
+                                             compare) == counts[key]);
+
+        assert(gdlll_peek_equal_range(gdllc_ptr, &key, sizeof(key), compare,
+                                      GDLLL_SEARCH_SORTED_ASCENDING,
+                                      &range_first_ptr, &range_last_ptr) ==
+                                                                counts[key]);
+
+        if (counts[key] == 0) {
+            assert(!range_first_ptr && !range_last_ptr);
+            continue;
+        }
+
+        // the range is exactly the elements with this key
+        assert(*(long *)(range_first_ptr->data_ptr) == key);
+        assert(*(long *)(range_last_ptr->data_ptr) == key);
+        assert((!range_first_ptr->prev) ||
+               (*(long *)(range_first_ptr->prev->data_ptr) < key));
+        assert((!range_last_ptr->next) ||
+               (*(long *)(range_last_ptr->next->data_ptr) > key));
+
+    }
+
+    key = 3;
+    assert(gdlll_get_all_matching_elements(gdllc_ptr, &key, sizeof(key),
+                                           compare, dest_gdllc_ptr) ==
+                                                                counts[3]);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(
+                                                dest_gdllc_ptr) == counts[3]);
+    assert(gdlll_count_matching_elements(gdllc_ptr, &key, sizeof(key),
+                                         compare) == 0);
+
+    elem_ptr = gdlll_peek_front_element(dest_gdllc_ptr);
+    while (elem_ptr) {
+        assert(*(long *)(elem_ptr->data_ptr) == 3);
+        elem_ptr = gdlll_peek_next_element(dest_gdllc_ptr, elem_ptr);
+    }
+
+    key = 4;
+    assert(gdlll_delete_all_matching_elements(gdllc_ptr, &key, sizeof(key),
+                                              compare) == counts[4]);
+    assert(num_deleted == counts[4]);
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                400 - counts[3] - counts[4]);
+
+    // the matching elements at both ends of the list
+    key = 0;
+    assert(gdlll_delete_all_matching_elements(gdllc_ptr, &key, sizeof(key),
+                                              compare) == counts[0]);
+
+    key = NUM_KEYS - 1;
+    assert(gdlll_delete_all_matching_elements(gdllc_ptr, &key, sizeof(key),
+                                              compare) == counts[NUM_KEYS - 1]);
+
+    assert(*(long *)(gdlll_peek_front_element(gdllc_ptr)->data_ptr) == 1);
+    assert(*(long *)(gdlll_peek_last_element(gdllc_ptr)->data_ptr) ==
+                                                                NUM_KEYS - 2);
+
+    // there is nothing to delete now
+    assert(gdlll_delete_all_matching_elements(gdllc_ptr, &key, sizeof(key),
+                                              compare) == 0);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+    gdlll_delete_gdll_container(dest_gdllc_ptr);
+
+    assert(num_deleted == 400);
+
+    printf("multimap test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,402 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the node cache and arena mode. Blocks are reused a lot here, so this
+// test relies on ASan to catch an element or payload that is used after its
+// block has been given to another element or back to the system.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+static long num_deleted;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+static void assert_list_is_consistent(struct gdll_container *gdllc_ptr);
+static void add_and_delete_elements(struct gdll_container *gdllc_ptr,
+                                    long num_elements);
+static void *node_cache_thread(void *arg);
+static void test_node_cache(void);
+static void test_arena_mode(void);
+static void test_no_moves_out_of_arena(void);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void call_back_func(void *data_ptr)
+{
+
+    (void)(data_ptr);
+
+    __atomic_fetch_add(&num_deleted, 1, __ATOMIC_RELAXED);
+
+    return;
+
+} // end of call_back_func() function
+
+static void assert_list_is_consistent(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    struct element *prev_elem_ptr = NULL;
+    long count = 0;
+
+    for (elem_ptr = gdllc_ptr->first; elem_ptr; elem_ptr = elem_ptr->next) {
+        assert(elem_ptr->prev == prev_elem_ptr);
+        prev_elem_ptr = elem_ptr;
+        count = count + 1;
+    }
+
+    assert(gdllc_ptr->last == prev_elem_ptr);
+    assert(count == gdllc_ptr->total_number_of_elements);
+
+    return;
+
+} // end of assert_list_is_consistent() function
+
+// Adds elements with payloads of many sizes, deletes every third one and
+// replaces some with data of another size.
+static void add_and_delete_elements(struct gdll_container *gdllc_ptr,
+                                    long num_elements)
+{
+
+    struct element *elem_ptr = NULL;
+    char data[600];
+    long new_data[40];
+    long data_size = 0;
+    long key = 0;
+    long i = 0;
+    int retval = 0;
+
+    for (i = 0; i < num_elements; i = i + 1) {
+        data_size = 8 + ((i * 37) % 590);
+        memset(data, (int)(i), sizeof(data));
+        *(long *)(data) = i;
+        retval = gdlll_add_element_to_back(gdllc_ptr, data, data_size);
+        assert(retval == GDLLL_SUCCESS);
+        if ((i % 3) == 2) {
+            elem_ptr = gdlll_get_front_element(gdllc_ptr);
+            assert(elem_ptr);
+            gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+        }
+    }
+
+    for (i = 0; i < num_elements; i = i + 7) {
+        key = i;
+        new_data[0] = i;
+        retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &key,
+                                            sizeof(key), new_data,
+                                            (long)(sizeof(long)) + (i % 300),
+                                            compare);
+        assert((retval == GDLLL_SUCCESS) ||
+               (retval == GDLLL_MATCHING_ELEMENT_NOT_FOUND));
+    }
+
+    assert_list_is_consistent(gdllc_ptr);
+
+    return;
+
+} // end of add_and_delete_elements() function
+
+static void *node_cache_thread(void *arg)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+
+    (void)(arg);
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    gdlll_enable_node_cache(gdllc_ptr);
+    add_and_delete_elements(gdllc_ptr, 20000);
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return NULL;
+
+} // end of node_cache_thread() function
+
+static void test_node_cache(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    pthread_t threads[4];
+    long i = 0;
+    int retval = 0;
+
+    retval = gdlll_enable_node_cache(NULL);
+    assert(retval == GDLLL_GDLLC_PTR_IS_NULL);
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_node_cache(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    add_and_delete_elements(gdllc_ptr, 20000);
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    add_and_delete_elements(gdllc_ptr, 5000);
+
+    // the elements freed by the reclaimer thread don't go to a node cache
+    retval = gdlll_enable_async_deletion(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+    add_and_delete_elements(gdllc_ptr, 5000);
+
+    gdlll_disable_node_cache(gdllc_ptr);
+    add_and_delete_elements(gdllc_ptr, 1000);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    // every thread has its own node cache
+    for (i = 0; i < 4; i = i + 1) {
+        retval = pthread_create(&(threads[i]), NULL, node_cache_thread, NULL);
+        assert(retval == 0);
+    }
+
+    for (i = 0; i < 4; i = i + 1) {
+        pthread_join(threads[i], NULL);
+    }
+
+    gdlll_free_node_cache_of_current_thread();
+
+    return;
+
+} // end of test_node_cache() function
+
+static void test_arena_mode(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_snapshot *snapshot_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long value = 1;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_arena_mode(gdllc_ptr, -2);
+    assert(retval == GDLLL_NUMA_NODE_IS_INVALID);
+
+    retval = gdlll_enable_arena_mode(gdllc_ptr, 5000);
+    assert(retval == GDLLL_NUMA_NODE_IS_INVALID);
+
+    gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+
+    retval = gdlll_enable_arena_mode(gdllc_ptr, GDLLL_NO_NUMA_NODE);
+    assert(retval == GDLLL_CONTAINER_IS_NOT_EMPTY);
+
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+
+    retval = gdlll_enable_arena_mode(gdllc_ptr, GDLLL_NO_NUMA_NODE);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (value = 0; value < 100000; value = value + 1) {
+        retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    assert(gdllc_ptr->arena_number_of_regions >= 4);
+
+    // the elements of a list that grows by appending are evenly spaced
+    elem_ptr = gdllc_ptr->first->next;
+    assert(((char *)(elem_ptr->next) - (char *)(elem_ptr)) ==
+           ((char *)(elem_ptr) - (char *)(elem_ptr->prev)));
+    assert((char *)(elem_ptr) > (char *)(elem_ptr->prev));
+
+    add_and_delete_elements(gdllc_ptr, 30000);
+
+    // the arena starts again from the beginning
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+    assert(gdllc_ptr->arena_number_of_regions == 1);
+
+    for (value = 0; value < 100000; value = value + 1) {
+        retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    retval = gdlll_enable_async_deletion(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+    add_and_delete_elements(gdllc_ptr, 3000);
+
+    snapshot_ptr = gdlll_take_snapshot(gdllc_ptr);
+    assert(snapshot_ptr);
+    gdlll_delete_front_element(gdllc_ptr);
+    gdlll_release_snapshot(snapshot_ptr);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    // an element removed by a gdlll_get_* function keeps its block after the
+    // arena mode has been disabled
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_arena_mode(gdllc_ptr, GDLLL_NO_NUMA_NODE);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (value = 0; value < 10; value = value + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    elem_ptr = gdlll_get_front_element(gdllc_ptr);
+    gdlll_disable_arena_mode(gdllc_ptr);
+    assert(*(long *)(elem_ptr->data_ptr) == 0);
+
+    retval = gdlll_enable_arena_mode(gdllc_ptr, GDLLL_NO_NUMA_NODE);
+    assert(retval == GDLLL_CONTAINER_IS_SHARED);
+
+    gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+
+    retval = gdlll_enable_arena_mode(gdllc_ptr, GDLLL_NO_NUMA_NODE);
+    assert(retval == GDLLL_SUCCESS);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    // the arena on NUMA node 0, if the system has NUMA support
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_arena_mode(gdllc_ptr, 0);
+    assert((retval == GDLLL_SUCCESS) ||
+           (retval == GDLLL_NUMA_NODE_IS_INVALID));
+
+    if (retval == GDLLL_SUCCESS) {
+        for (value = 0; value < 1000; value = value + 1) {
+            gdlll_add_element_to_front(gdllc_ptr, &value, sizeof(value));
+        }
+        gdlll_enable_node_cache(gdllc_ptr);
+        add_and_delete_elements(gdllc_ptr, 2000);
+    }
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    gdlll_free_node_cache_of_current_thread();
+
+    return;
+
+} // end of test_arena_mode() function
+
+// The elements of a container in arena mode are freed with its arena, so they
+// are not moved out of (or into) it, and neither are the elements still in
+// the arena of a disabled arena mode.
+static void test_no_moves_out_of_arena(void)
+{
+
+    struct gdll_container *arena_gdllc_ptr = NULL;
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long from = 10;
+    long to = 20;
+    long i = 0;
+    int retval = 0;
+
+    arena_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(arena_gdllc_ptr && gdllc_ptr);
+
+    retval = gdlll_enable_arena_mode(arena_gdllc_ptr, GDLLL_NO_NUMA_NODE);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 50; i = i + 1) {
+        gdlll_add_element_sorted_ascending(arena_gdllc_ptr, &i, sizeof(i),
+                                           compare);
+        gdlll_add_element_sorted_ascending(gdllc_ptr, &i, sizeof(i),
+                                           compare);
+    }
+
+    assert(gdlll_get_range(arena_gdllc_ptr, &from, sizeof(from), &to,
+                           sizeof(to), compare, GDLLL_SEARCH_SORTED_ASCENDING,
+                           gdllc_ptr) == 0);
+    assert(gdlll_get_all_matching_elements(arena_gdllc_ptr, &from,
+                                           sizeof(from), compare,
+                                           gdllc_ptr) == 0);
+
+    assert(gdlll_get_range(gdllc_ptr, &from, sizeof(from), &to, sizeof(to),
+                           compare, GDLLL_SEARCH_SORTED_ASCENDING,
+                           arena_gdllc_ptr) == 0);
+    assert(gdlll_get_all_matching_elements(gdllc_ptr, &from, sizeof(from),
+                                           compare, arena_gdllc_ptr) == 0);
+
+    // the arena mode is disabled but one element still has its block
+    elem_ptr = gdlll_get_front_element(arena_gdllc_ptr);
+    gdlll_disable_arena_mode(arena_gdllc_ptr);
+
+    for (i = 0; i < 50; i = i + 1) {
+        gdlll_add_element_sorted_ascending(arena_gdllc_ptr, &i, sizeof(i),
+                                           compare);
+    }
+
+    assert(gdlll_get_range(gdllc_ptr, &from, sizeof(from), &to, sizeof(to),
+                           compare, GDLLL_SEARCH_SORTED_ASCENDING,
+                           arena_gdllc_ptr) == 0);
+    assert(gdlll_get_all_matching_elements(gdllc_ptr, &from, sizeof(from),
+                                           compare, arena_gdllc_ptr) == 0);
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                        50);
+
+    // nothing in 'gdllc_ptr' points into the freed arena (ASan checks this)
+    gdlll_delete_standalone_element(arena_gdllc_ptr, elem_ptr);
+    gdlll_delete_gdll_container(arena_gdllc_ptr);
+    assert_list_is_consistent(gdllc_ptr);
+
+    for (elem_ptr = gdlll_peek_front_element(gdllc_ptr), i = 0; elem_ptr;
+         elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr), i = i + 1) {
+        assert(*(long *)(elem_ptr->data_ptr) == i);
+    }
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return;
+
+} // end of test_no_moves_out_of_arena() function
+
+int main(void)
+{
+
+    test_node_cache();
+
+    test_arena_mode();
+
+    test_no_moves_out_of_arena();
+
+    printf("node cache and arena mode test passed\n");
+
+    return 0;
+
+} // end of main() function
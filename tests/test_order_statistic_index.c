@@ -0,0 +1,274 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests positional access with and without the order statistic index (and
+// with and without lazy deletion) against a model of the list (an array).
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_ELEMENTS 5000
+
+static long model[MAX_ELEMENTS];
+static long model_num_elements;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void model_insert(long position, long value);
+static void model_delete(long position);
+static void check_positions(struct gdll_container *gdllc_ptr);
+static void run_random_operations(int indexed, int lazy);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void model_insert(long position, long value)
+{
+
+    long i = 0;
+
+    for (i = model_num_elements; i > position; i = i - 1) {
+        model[i] = model[i - 1];
+    }
+
+    model[position] = value;
+    model_num_elements = model_num_elements + 1;
+
+} // end of model_insert() function
+
+static void model_delete(long position)
+{
+
+    long i = 0;
+
+    for (i = position; i < (model_num_elements - 1); i = i + 1) {
+        model[i] = model[i + 1];
+    }
+
+    model_num_elements = model_num_elements - 1;
+
+} // end of model_delete() function
+
+static void check_positions(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    long i = 0;
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                        model_num_elements);
+
+    for (i = 0; i < model_num_elements; i = i + 1) {
+        elem_ptr = gdlll_peek_element_at_position(gdllc_ptr, i);
+        assert(elem_ptr && (*(long *)(elem_ptr->data_ptr) == model[i]));
+        assert(gdlll_get_position_of_element(gdllc_ptr, elem_ptr) == i);
+    }
+
+    assert(!gdlll_peek_element_at_position(gdllc_ptr, model_num_elements));
+    assert(!gdlll_peek_element_at_position(gdllc_ptr, -1));
+
+} // end of check_positions() function
+
+static void run_random_operations(int indexed, int lazy)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_container *other_gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long position = 0;
+    long value = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    model_num_elements = 0;
+
+    if (lazy) {
+        gdlll_enable_lazy_deletion(gdllc_ptr, 0);
+    }
+
+    srand((unsigned int)((indexed * 7) + lazy));
+
+    for (i = 0; i < 300; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+        model_insert(model_num_elements, i);
+    }
+
+    if (indexed) {
+        retval = gdlll_enable_order_statistic_index(gdllc_ptr);
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    check_positions(gdllc_ptr);
+
+    for (i = 0; i < 3000; i = i + 1) {
+
+        value = 1000 + i;
+
+        switch ((model_num_elements < 10) ? 0 : (rand() % 7)) {
+
+        case 0:
+            position = rand() % (model_num_elements + 1);
+            retval = gdlll_add_element_at_position(gdllc_ptr, position,
+                                                   &value, sizeof(value));
+            assert(retval == GDLLL_SUCCESS);
+            model_insert(position, value);
+            break;
+
+        case 1:
+            position = rand() % model_num_elements;
+            gdlll_delete_element_at_position(gdllc_ptr, position);
+            model_delete(position);
+            break;
+
+        case 2:
+            position = rand() % model_num_elements;
+            elem_ptr = gdlll_get_element_at_position(gdllc_ptr, position);
+            assert(*(long *)(elem_ptr->data_ptr) == model[position]);
+            gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+            model_delete(position);
+            break;
+
+        case 3:
+            gdlll_add_element_to_front(gdllc_ptr, &value, sizeof(value));
+            model_insert(0, value);
+            break;
+
+        case 4:
+            position = rand() % model_num_elements;
+            value = model[position];
+            gdlll_delete_matching_element(gdllc_ptr, &value, sizeof(value),
+                                          compare);
+            model_delete(position);
+            break;
+
+        case 5:
+            // an element that can't be allocated leaves the index as it was
+            gdlll_inject_allocation_failures(0, 1);
+            retval = gdlll_add_element_to_back(gdllc_ptr, &value,
+                                               sizeof(value));
+            gdlll_inject_allocation_failures(0, 0);
+            assert(retval == GDLLL_NO_MEMORY);
+            break;
+
+        default:
+            gdlll_delete_last_element(gdllc_ptr);
+            model_delete(model_num_elements - 1);
+            break;
+
+        }
+
+        if ((i % 97) == 0) {
+            check_positions(gdllc_ptr);
+        }
+
+    }
+
+    check_positions(gdllc_ptr);
+
+    retval = gdlll_add_element_at_position(gdllc_ptr, model_num_elements + 1,
+                                           &value, sizeof(value));
+    assert(retval == GDLLL_POSITION_IS_INVALID);
+
+    // an element of another container has no position in this one
+    other_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(other_gdllc_ptr);
+
+    if (indexed) {
+        gdlll_enable_order_statistic_index(other_gdllc_ptr);
+    }
+
+    gdlll_add_element_to_back(other_gdllc_ptr, &value, sizeof(value));
+    assert(gdlll_get_position_of_element(gdllc_ptr,
+                                gdlll_peek_front_element(other_gdllc_ptr)) ==
+                                            GDLLL_MATCHING_ELEMENT_NOT_FOUND);
+
+    gdlll_delete_gdll_container(other_gdllc_ptr);
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return;
+
+} // end of run_random_operations() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long value = 0;
+    long i = 0;
+
+    run_random_operations(0, 0);
+    run_random_operations(1, 0);
+    run_random_operations(1, 1);
+    run_random_operations(0, 1);
+
+    // the median of a sorted container
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+    gdlll_enable_order_statistic_index(gdllc_ptr);
+
+    for (i = 0; i < 1000; i = i + 1) {
+        value = (i * 7919) % 1000;
+        gdlll_add_element_sorted_ascending(gdllc_ptr, &value, sizeof(value),
+                                           compare);
+    }
+
+    assert(*(long *)(gdlll_peek_element_at_position(gdllc_ptr,
+                                                    500)->data_ptr) == 500);
+
+    // the nodes are in the memory blocks of the elements, so they move with
+    // the elements
+    assert(gdlll_relayout_container(gdllc_ptr) == GDLLL_SUCCESS);
+
+    for (elem_ptr = gdlll_peek_front_element(gdllc_ptr), i = 0; elem_ptr;
+         elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr), i = i + 1) {
+        assert(*(long *)(elem_ptr->data_ptr) == i);
+        assert(gdlll_get_position_of_element(gdllc_ptr, elem_ptr) == i);
+        assert(gdlll_peek_element_at_position(gdllc_ptr, i) == elem_ptr);
+    }
+
+    assert(i == 1000);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    printf("order statistic index test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,214 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests priority queue mode.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static long num_deleted;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+static long pop_all_in_order(struct gdll_container *gdllc_ptr);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void call_back_func(void *data_ptr)
+{
+
+    (void)(data_ptr);
+
+    num_deleted = num_deleted + 1;
+
+    return;
+
+} // end of call_back_func() function
+
+// Pops all the elements (with both gdlll_get_front_element() and
+// gdlll_delete_front_element()), checks that they come out in ascending order
+// and returns their number.
+static long pop_all_in_order(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    long previous = -1000;
+    long value = 0;
+    long count = 0;
+
+    while (gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr)) {
+
+        if (count % 2) {
+            elem_ptr = gdlll_get_front_element(gdllc_ptr);
+            value = *(long *)(elem_ptr->data_ptr);
+            gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+        } else {
+            value = *(long *)(gdlll_peek_front_element(gdllc_ptr)->data_ptr);
+            gdlll_delete_front_element(gdllc_ptr);
+        }
+
+        assert(value >= previous);
+        previous = value;
+        count = count + 1;
+
+    }
+
+    return count;
+
+} // end of pop_all_in_order() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long *long_ptr = NULL;
+    long num_elements = 0;
+    long value = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_priority_queue_mode(gdllc_ptr, NULL);
+    assert(retval == GDLLL_COMPARE_ELEMENTS_FUNC_PTR_IS_NULL);
+
+    retval = gdlll_enable_priority_queue_mode(gdllc_ptr, compare);
+    assert(retval == GDLLL_SUCCESS);
+    assert(gdlll_peek_front_element(gdllc_ptr) == NULL);
+
+    srand(5);
+
+    for (i = 0; i < 5000; i = i + 1) {
+        value = rand() % 100000;
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    // elements added while the mode is off are heapified when it is enabled
+    gdlll_disable_priority_queue_mode(gdllc_ptr);
+
+    for (i = 0; i < 3000; i = i + 1) {
+        value = rand() % 100000;
+        gdlll_add_element_to_front(gdllc_ptr, &value, sizeof(value));
+    }
+
+    retval = gdlll_enable_priority_queue_mode(gdllc_ptr, compare);
+    assert(retval == GDLLL_SUCCESS);
+
+    // decrease the key of an element
+    elem_ptr = gdlll_peek_last_element(gdllc_ptr);
+    *(long *)(elem_ptr->data_ptr) = -5;
+    gdlll_update_element_priority(gdllc_ptr, elem_ptr);
+    assert(gdlll_peek_front_element(gdllc_ptr) == elem_ptr);
+
+    // remove an element from the middle of the heap
+    elem_ptr = gdllc_ptr->first->next->next;
+    elem_ptr = gdlll_get_given_element(gdllc_ptr, elem_ptr);
+    gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+
+    // an emplaced element is ordered by the data written into it
+    long_ptr = gdlll_emplace_element_to_back(gdllc_ptr, sizeof(long));
+    assert(long_ptr);
+    *long_ptr = -10;
+    assert(*(long *)(gdlll_peek_front_element(gdllc_ptr)->data_ptr) == -10);
+
+    assert(pop_all_in_order(gdllc_ptr) == 8000);
+    assert(num_deleted == 8001);
+
+    // adds whose heap bookkeeping can't be allocated don't break the order
+    for (i = 0; i < 200; i = i + 1) {
+        value = rand() % 1000;
+        gdlll_inject_allocation_failures(i % 3, 1);
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+        gdlll_inject_allocation_failures(0, 0);
+    }
+
+    for (i = 0; i < 100; i = i + 1) {
+        value = rand() % 1000;
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    // an add that can't grow the full heap fails with GDLLL_NO_MEMORY and
+    // leaves the container and the heap as they were
+    while (gdllc_ptr->heap_size < gdllc_ptr->heap_capacity) {
+        value = rand() % 1000;
+        gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    }
+
+    num_elements = gdllc_ptr->total_number_of_elements;
+
+    value = -1;
+    gdlll_inject_allocation_failures(1, 1);
+    retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    gdlll_inject_allocation_failures(0, 0);
+    assert(retval == GDLLL_NO_MEMORY);
+    assert(gdllc_ptr->total_number_of_elements == num_elements);
+    assert(!gdllc_ptr->heap_is_stale);
+    assert(*(long *)(gdlll_peek_front_element(gdllc_ptr)->data_ptr) >= 0);
+
+    retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    assert(retval == GDLLL_SUCCESS);
+    assert(gdlll_peek_front_element(gdllc_ptr) ==
+                                        gdlll_peek_last_element(gdllc_ptr));
+
+    value = gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr);
+    assert(value >= 100);
+    assert(pop_all_in_order(gdllc_ptr) == value);
+
+    // the tombstones of lazy deletion are not in the heap
+    gdlll_enable_lazy_deletion(gdllc_ptr, 0);
+
+    for (i = 100; i > 0; i = i - 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    value = 1;
+    gdlll_delete_matching_element(gdllc_ptr, &value, sizeof(value), compare);
+    value = 2;
+    gdlll_delete_matching_element(gdllc_ptr, &value, sizeof(value), compare);
+
+    assert(*(long *)(gdlll_peek_front_element(gdllc_ptr)->data_ptr) == 3);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    printf("priority queue test passed\n");
+
+    return 0;
+
+} // end of main() function
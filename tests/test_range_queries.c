@@ -0,0 +1,337 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the lower and upper bounds and the range queries on ascending and
+// descending lists (with the order statistic index, with lazy deletion and
+// with neither) against a count of every key.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_KEY 100
+
+#define PLAIN 0
+#define INDEXED 1
+#define LAZY 2
+#define INDEXED_DESTINATION 3
+
+static long key_counts[MAX_KEY];
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static long value_of(struct element *elem_ptr);
+static long count_keys(long low, long high);
+static long next_key(long key, int descending);
+static void check_bounds(struct gdll_container *gdllc_ptr, long key,
+                         int descending);
+static void check_range(struct gdll_container *gdllc_ptr, long low, long high,
+                        int descending);
+static void run_range_queries(int mode, int descending);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static long value_of(struct element *elem_ptr)
+{
+
+    if (!elem_ptr) {
+        return -1;
+    }
+
+    return *(long *)(elem_ptr->data_ptr);
+
+} // end of value_of() function
+
+static long count_keys(long low, long high)
+{
+
+    long count = 0;
+    long key = 0;
+
+    for (key = low; (key <= high) && (key < MAX_KEY); key = key + 1) {
+        count = count + key_counts[key];
+    }
+
+    return count;
+
+} // end of count_keys() function
+
+// Returns the first key present in the list at or after 'key' in the sorting
+// order of the list, or -1 if there is none.
+static long next_key(long key, int descending)
+{
+
+    if (key >= MAX_KEY) {
+        key = descending ? (MAX_KEY - 1) : MAX_KEY;
+    }
+
+    while ((key >= 0) && (key < MAX_KEY) && (!key_counts[key])) {
+        key = descending ? (key - 1) : (key + 1);
+    }
+
+    if ((key < 0) || (key >= MAX_KEY)) {
+        return -1;
+    }
+
+    return key;
+
+} // end of next_key() function
+
+static void check_bounds(struct gdll_container *gdllc_ptr, long key,
+                         int descending)
+{
+
+    struct element *elem_ptr = NULL;
+    int search_strategy = GDLLL_SEARCH_SORTED_ASCENDING;
+
+    if (descending) {
+        search_strategy = GDLLL_SEARCH_SORTED_DESCENDING;
+    }
+
+    elem_ptr = gdlll_peek_lower_bound_element(gdllc_ptr, &key, sizeof(key),
+                                              compare, search_strategy);
+    assert(value_of(elem_ptr) == next_key(key, descending));
+
+    elem_ptr = gdlll_peek_upper_bound_element(gdllc_ptr, &key, sizeof(key),
+                                              compare, search_strategy);
+    assert(value_of(elem_ptr) ==
+                        next_key(descending ? (key - 1) : (key + 1),
+                                 descending));
+
+    return;
+
+} // end of check_bounds() function
+
+static void check_range(struct gdll_container *gdllc_ptr, long low, long high,
+                        int descending)
+{
+
+    struct element *range_first_ptr = NULL;
+    struct element *range_last_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long from = low;
+    long to = high;
+    long expected = count_keys(low, high);
+    long count = 0;
+    int search_strategy = GDLLL_SEARCH_SORTED_ASCENDING;
+
+    if (descending) {
+        search_strategy = GDLLL_SEARCH_SORTED_DESCENDING;
+        from = high;
+        to = low;
+    }
+
+    assert(gdlll_peek_range(gdllc_ptr, &from, sizeof(from), &to, sizeof(to),
+                            compare, search_strategy, &range_first_ptr,
+                            &range_last_ptr) == expected);
+
+    if (expected == 0) {
+        assert((range_first_ptr == NULL) && (range_last_ptr == NULL));
+        return;
+    }
+
+    for (elem_ptr = range_first_ptr; elem_ptr;
+         elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr)) {
+        assert((value_of(elem_ptr) >= low) && (value_of(elem_ptr) <= high));
+        count = count + 1;
+        if (elem_ptr == range_last_ptr) {
+            break;
+        }
+    }
+
+    assert(count == expected);
+
+    return;
+
+} // end of check_range() function
+
+static void run_range_queries(int mode, int descending)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_container *dest_gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long num_elements = 0;
+    long expected = 0;
+    long previous = 0;
+    long from = 0;
+    long to = 0;
+    long value = 0;
+    long low = 0;
+    long high = 0;
+    long i = 0;
+    int search_strategy = GDLLL_SEARCH_SORTED_ASCENDING;
+
+    if (descending) {
+        search_strategy = GDLLL_SEARCH_SORTED_DESCENDING;
+    }
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    dest_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr && dest_gdllc_ptr);
+
+    if (mode == INDEXED) {
+        gdlll_enable_order_statistic_index(gdllc_ptr);
+    } else if (mode == LAZY) {
+        gdlll_enable_lazy_deletion(gdllc_ptr, 0);
+    } else if (mode == INDEXED_DESTINATION) {
+        gdlll_enable_order_statistic_index(dest_gdllc_ptr);
+    }
+
+    for (i = 0; i < MAX_KEY; i = i + 1) {
+        key_counts[i] = 0;
+    }
+
+    srand((unsigned int)(mode + (descending * 10)));
+
+    // only even keys, so that half of the keys searched for are not present
+    for (i = 0; i < 2000; i = i + 1) {
+        value = (rand() % (MAX_KEY / 2)) * 2;
+        if (descending) {
+            gdlll_add_element_sorted_descending(gdllc_ptr, &value,
+                                                sizeof(value), compare);
+        } else {
+            gdlll_add_element_sorted_ascending(gdllc_ptr, &value,
+                                               sizeof(value), compare);
+        }
+        key_counts[value] = key_counts[value] + 1;
+        num_elements = num_elements + 1;
+    }
+
+    // the tombstones of lazy deletion are not in any range
+    if (mode == LAZY) {
+        for (i = 0; i < 300; i = i + 1) {
+            value = (rand() % (MAX_KEY / 2)) * 2;
+            if (key_counts[value]) {
+                gdlll_delete_matching_element_using_strategy(gdllc_ptr,
+                                &value, sizeof(value), compare,
+                                search_strategy);
+                key_counts[value] = key_counts[value] - 1;
+                num_elements = num_elements - 1;
+            }
+        }
+    }
+
+    for (i = 0; i < 200; i = i + 1) {
+        low = rand() % (MAX_KEY + 1);
+        high = rand() % (MAX_KEY + 1);
+        check_range(gdllc_ptr, low, high, descending);
+        check_bounds(gdllc_ptr, low, descending);
+    }
+
+    // move a range to another container
+    low = 20;
+    high = 40;
+    expected = count_keys(low, high);
+    from = descending ? high : low;
+    to = descending ? low : high;
+
+    assert(gdlll_get_range(gdllc_ptr, &from, sizeof(from), &to, sizeof(to),
+                           compare, search_strategy, dest_gdllc_ptr) ==
+                                                                    expected);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                    num_elements - expected);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(
+                                            dest_gdllc_ptr) == expected);
+
+    previous = descending ? MAX_KEY : -1;
+    for (elem_ptr = gdlll_peek_front_element(dest_gdllc_ptr); elem_ptr;
+         elem_ptr = gdlll_peek_next_element(dest_gdllc_ptr, elem_ptr)) {
+        assert((value_of(elem_ptr) >= low) && (value_of(elem_ptr) <= high));
+        if (descending) {
+            assert(value_of(elem_ptr) <= previous);
+        } else {
+            assert(value_of(elem_ptr) >= previous);
+        }
+        previous = value_of(elem_ptr);
+    }
+
+    for (i = low; i <= high; i = i + 1) {
+        key_counts[i] = 0;
+    }
+    num_elements = num_elements - expected;
+
+    // delete a range
+    low = 60;
+    high = 70;
+    expected = count_keys(low, high);
+    from = descending ? high : low;
+    to = descending ? low : high;
+
+    assert(gdlll_delete_range(gdllc_ptr, &from, sizeof(from), &to, sizeof(to),
+                              compare, search_strategy) == expected);
+
+    for (i = low; i <= high; i = i + 1) {
+        key_counts[i] = 0;
+    }
+    num_elements = num_elements - expected;
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                num_elements);
+    check_range(gdllc_ptr, 0, MAX_KEY, descending);
+
+    for (i = 0; i < 50; i = i + 1) {
+        check_range(gdllc_ptr, rand() % (MAX_KEY + 1),
+                    rand() % (MAX_KEY + 1), descending);
+    }
+
+    // an invalid search strategy finds nothing
+    assert(gdlll_peek_lower_bound_element(gdllc_ptr, &low, sizeof(low),
+                                          compare,
+                                          GDLLL_SEARCH_FORWARD) == NULL);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+    gdlll_delete_gdll_container(dest_gdllc_ptr);
+
+    return;
+
+} // end of run_range_queries() function
+
+int main(void)
+{
+
+    int mode = 0;
+
+    for (mode = PLAIN; mode <= INDEXED_DESTINATION; mode = mode + 1) {
+        run_range_queries(mode, 0);
+        run_range_queries(mode, 1);
+    }
+
+    printf("range queries test passed\n");
+
+    return 0;
+
+} // end of main() function
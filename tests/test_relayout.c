@@ -0,0 +1,378 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests relayout (complete and incremental passes, with the container being
+// changed between the steps of a pass) and that the indexes, the heap and the
+// tombstones still work after the elements have been moved.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_ELEMENTS 20000
+
+static long keys[2 * NUM_ELEMENTS];
+static long num_keys;
+static long num_deleted;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+static long data_size_of(long key);
+static void add_key(struct gdll_container *gdllc_ptr, long key);
+static void save_keys(struct gdll_container *gdllc_ptr);
+static void check_list(struct gdll_container *gdllc_ptr);
+static void check_indexes(struct gdll_container *gdllc_ptr, long step);
+static long count_layout_breaks(struct gdll_container *gdllc_ptr);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void call_back_func(void *data_ptr)
+{
+
+    (void)(data_ptr);
+
+    num_deleted = num_deleted + 1;
+
+    return;
+
+} // end of call_back_func() function
+
+// Mostly small payloads (moved into the arena), and some large ones (which
+// stay where they are).
+static long data_size_of(long key)
+{
+
+    long data_size = (long)(sizeof(long)) + ((key * 37) % 300);
+
+    if ((key % 97) == 0) {
+        data_size = data_size + 5000;
+    }
+
+    return data_size;
+
+} // end of data_size_of() function
+
+static void add_key(struct gdll_container *gdllc_ptr, long key)
+{
+
+    char data[6000];
+    long data_size = data_size_of(key);
+    int retval = 0;
+
+    memset(data, (int)(key), (size_t)(data_size));
+    *(long *)(data) = key;
+
+    retval = gdlll_add_element_to_back(gdllc_ptr, data, data_size);
+    assert(retval == GDLLL_SUCCESS);
+
+    return;
+
+} // end of add_key() function
+
+static void save_keys(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+
+    num_keys = 0;
+
+    for (elem_ptr = gdllc_ptr->first; elem_ptr; elem_ptr = elem_ptr->next) {
+        keys[num_keys] = *(long *)(elem_ptr->data_ptr);
+        num_keys = num_keys + 1;
+    }
+
+    return;
+
+} // end of save_keys() function
+
+// Checks that the list still has the saved keys in order, with their data.
+static void check_list(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    long key = 0;
+    long i = 0;
+
+    for (elem_ptr = gdllc_ptr->first; elem_ptr; elem_ptr = elem_ptr->next) {
+
+        assert(i < num_keys);
+        key = keys[i];
+
+        assert(*(long *)(elem_ptr->data_ptr) == key);
+        assert(elem_ptr->data_size == data_size_of(key));
+        assert(((unsigned char *)(elem_ptr->data_ptr))[
+                    elem_ptr->data_size - 1] == (unsigned char)(key));
+
+        if (elem_ptr->next) {
+            assert(elem_ptr->next->prev == elem_ptr);
+        } else {
+            assert(gdllc_ptr->last == elem_ptr);
+        }
+
+        i = i + 1;
+
+    }
+
+    assert(i == num_keys);
+    assert(gdllc_ptr->total_number_of_elements == num_keys);
+
+    return;
+
+} // end of check_list() function
+
+static void check_indexes(struct gdll_container *gdllc_ptr, long step)
+{
+
+    struct element *elem_ptr = NULL;
+    long i = 0;
+
+    for (i = 0; i < num_keys; i = i + step) {
+        elem_ptr = gdlll_peek_element_with_integer_key(gdllc_ptr, keys[i]);
+        assert(elem_ptr && (*(long *)(elem_ptr->data_ptr) == keys[i]));
+        elem_ptr = gdlll_peek_element_at_position(gdllc_ptr, i);
+        assert(elem_ptr && (*(long *)(elem_ptr->data_ptr) == keys[i]));
+    }
+
+    return;
+
+} // end of check_indexes() function
+
+// Returns the number of elements that are not followed in memory by their
+// arena payload and then by the next element (there should be about one per
+// region of the arena).
+static long count_layout_breaks(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    long num_breaks = 0;
+    char *data_ptr = NULL;
+
+    for (elem_ptr = gdllc_ptr->first; (elem_ptr) && (elem_ptr->next);
+         elem_ptr = elem_ptr->next) {
+
+        if ((char *)(elem_ptr->next) < (char *)(elem_ptr)) {
+            num_breaks = num_breaks + 1;
+            continue;
+        }
+
+        data_ptr = elem_ptr->data_ptr;
+
+        if ((elem_ptr->data_size <= GDLLL_ARENA_MAX_PAYLOAD_SIZE) &&
+            ((data_ptr < (char *)(elem_ptr)) ||
+             (data_ptr >= (char *)(elem_ptr->next)))) {
+            num_breaks = num_breaks + 1;
+        }
+
+    }
+
+    return num_breaks;
+
+} // end of count_layout_breaks() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_snapshot *snapshot_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long num_regions = 0;
+    long num_steps = 0;
+    long key = 0;
+    long i = 0;
+    int retval = 0;
+
+    retval = gdlll_relayout_container(NULL);
+    assert(retval == GDLLL_GDLLC_PTR_IS_NULL);
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    // the elements are scattered in memory (not in arena mode)
+    for (i = 0; i < NUM_ELEMENTS; i = i + 1) {
+        add_key(gdllc_ptr, i);
+    }
+
+    for (i = 0; i < NUM_ELEMENTS; i = i + 3) {
+        gdlll_delete_matching_element(gdllc_ptr, &i, sizeof(i), compare);
+    }
+
+    save_keys(gdllc_ptr);
+
+    retval = gdlll_enable_integer_key_index(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    retval = gdlll_enable_order_statistic_index(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    // the callback is not called for the old payloads
+    num_deleted = 0;
+
+    retval = gdlll_relayout_container(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+    assert(num_deleted == 0);
+    assert(gdllc_ptr->arena_mode_enabled);
+    assert(!gdlll_relayout_is_in_progress(gdllc_ptr));
+
+    check_list(gdllc_ptr);
+    check_indexes(gdllc_ptr, 101);
+    assert(count_layout_breaks(gdllc_ptr) <=
+                                        gdllc_ptr->arena_number_of_regions);
+
+    // the regions of the first pass are given back by the second pass
+    num_regions = gdllc_ptr->arena_number_of_regions;
+
+    retval = gdlll_relayout_container(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+    assert(gdllc_ptr->arena_number_of_regions <= (num_regions + 1));
+    check_list(gdllc_ptr);
+
+    // an incremental pass, with the next element to be moved and the front
+    // element deleted and a new element added between the steps
+    retval = gdlll_relayout_container_incrementally(gdllc_ptr, 0);
+    assert(retval == GDLLL_NUM_ELEMENTS_IS_INVALID);
+
+    do {
+
+        retval = gdlll_relayout_container_incrementally(gdllc_ptr, 500);
+        assert(retval == GDLLL_SUCCESS);
+        num_steps = num_steps + 1;
+
+        if (!gdlll_relayout_is_in_progress(gdllc_ptr)) {
+            break;
+        }
+
+        if (gdllc_ptr->relayout_next_element) {
+            key = *(long *)(gdllc_ptr->relayout_next_element->data_ptr);
+            gdlll_delete_matching_element(gdllc_ptr, &key, sizeof(key),
+                                          compare);
+        }
+
+        gdlll_delete_front_element(gdllc_ptr);
+        add_key(gdllc_ptr, NUM_ELEMENTS + num_steps);
+
+    } while (1);
+
+    assert(num_steps > 5);
+
+    save_keys(gdllc_ptr);
+    check_list(gdllc_ptr);
+    check_indexes(gdllc_ptr, 53);
+
+    gdlll_disable_integer_key_index(gdllc_ptr);
+    gdlll_disable_order_statistic_index(gdllc_ptr);
+
+    // the heap of priority queue mode
+    gdlll_delete_all_elements_in_gdll_container(gdllc_ptr);
+
+    retval = gdlll_enable_priority_queue_mode(gdllc_ptr, compare);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 1000; i > 0; i = i - 1) {
+        add_key(gdllc_ptr, i);
+    }
+
+    retval = gdlll_relayout_container_incrementally(gdllc_ptr, 300);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 1; i <= 1000; i = i + 1) {
+        elem_ptr = gdlll_peek_front_element(gdllc_ptr);
+        assert(*(long *)(elem_ptr->data_ptr) == i);
+        gdlll_delete_front_element(gdllc_ptr);
+        if (i == 100) {
+            retval = gdlll_relayout_container(gdllc_ptr);
+            assert(retval == GDLLL_SUCCESS);
+        }
+    }
+
+    gdlll_disable_priority_queue_mode(gdllc_ptr);
+
+    // the tombstones of lazy deletion
+    retval = gdlll_enable_lazy_deletion(gdllc_ptr, 90);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 100; i = i + 1) {
+        add_key(gdllc_ptr, i);
+    }
+
+    for (i = 1; i < 99; i = i + 2) {
+        gdlll_delete_matching_element(gdllc_ptr, &i, sizeof(i), compare);
+    }
+
+    retval = gdlll_relayout_container(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (elem_ptr = gdlll_peek_front_element(gdllc_ptr), i = 0; elem_ptr;
+         elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr), i = i + 1) {
+        assert(*(long *)(elem_ptr->data_ptr) == ((i < 50) ? (2 * i) : 99));
+    }
+
+    assert(i == 51);
+
+    gdlll_disable_lazy_deletion(gdllc_ptr);
+
+    // a container that readers may be using is not relaid out
+    snapshot_ptr = gdlll_take_snapshot(gdllc_ptr);
+    assert(snapshot_ptr);
+
+    retval = gdlll_relayout_container(gdllc_ptr);
+    assert(retval == GDLLL_CONTAINER_IS_SHARED);
+
+    gdlll_release_snapshot(snapshot_ptr);
+
+    retval = gdlll_relayout_container(gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_epoch_reclamation(gdllc_ptr, 2);
+    assert(retval == GDLLL_SUCCESS);
+
+    add_key(gdllc_ptr, 1);
+
+    retval = gdlll_relayout_container(gdllc_ptr);
+    assert(retval == GDLLL_CONTAINER_IS_SHARED);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    printf("relayout test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,317 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests ring mode (fixed capacity with preallocated element slots).
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void assert_list_is_sorted(struct gdll_container *gdllc_ptr);
+static void test_reject_when_full(void);
+static void test_overwrite_oldest_when_full(void);
+static void test_hint_is_overwritten(void);
+static void test_no_moves_out_of_ring(void);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void assert_list_is_sorted(struct gdll_container *gdllc_ptr)
+{
+
+    struct element *elem_ptr = NULL;
+    long count = 0;
+
+    for (elem_ptr = gdlll_peek_front_element(gdllc_ptr); elem_ptr;
+         elem_ptr = gdlll_peek_next_element(gdllc_ptr, elem_ptr)) {
+        if (elem_ptr->next) {
+            assert(compare(elem_ptr, elem_ptr->next) <= 0);
+        }
+        count = count + 1;
+    }
+
+    assert(count ==
+           gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr));
+
+    return;
+
+} // end of assert_list_is_sorted() function
+
+static void test_reject_when_full(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    char big_data[200];
+    char mid_data[90];
+    long value = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_ring_mode(gdllc_ptr, 4, 100, 9);
+    assert(retval == GDLLL_WHEN_FULL_IS_INVALID);
+
+    retval = gdlll_enable_ring_mode(gdllc_ptr, 4, 100,
+                                    GDLLL_RING_REJECT_WHEN_FULL);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 4; i = i + 1) {
+        retval = gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    value = 9;
+    retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    assert(retval == GDLLL_CONTAINER_IS_FULL);
+
+    // the data must fit in a slot
+    memset(big_data, 0, sizeof(big_data));
+    retval = gdlll_add_element_to_back(gdllc_ptr, big_data, sizeof(big_data));
+    assert(retval == GDLLL_DATA_SIZE_IS_INVALID);
+
+    retval = gdlll_enable_ring_mode(gdllc_ptr, 4, 8,
+                                    GDLLL_RING_REJECT_WHEN_FULL);
+    assert(retval == GDLLL_CONTAINER_IS_NOT_EMPTY);
+
+    // a standalone element still owns its slot
+    elem_ptr = gdlll_get_front_element(gdllc_ptr);
+    assert(*(long *)(elem_ptr->data_ptr) == 0);
+
+    value = 4;
+    retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    assert(retval == GDLLL_CONTAINER_IS_FULL);
+
+    gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+
+    retval = gdlll_add_element_to_back(gdllc_ptr, &value, sizeof(value));
+    assert(retval == GDLLL_SUCCESS);
+
+    // the new data is stored in the slot
+    memset(mid_data, 7, sizeof(mid_data));
+    value = 1;
+    retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &value,
+                                                    sizeof(value), mid_data,
+                                                    sizeof(mid_data), compare);
+    assert(retval == GDLLL_SUCCESS);
+
+    gdlll_disable_ring_mode(gdllc_ptr);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                        0);
+
+    // a queue in steady state never runs out of slots
+    retval = gdlll_enable_ring_mode(gdllc_ptr, 16, sizeof(long),
+                                    GDLLL_RING_REJECT_WHEN_FULL);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 100000; i = i + 1) {
+        retval = gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+        assert(retval == GDLLL_SUCCESS);
+        if (i >= 10) {
+            gdlll_delete_front_element(gdllc_ptr);
+        }
+    }
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                        10);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return;
+
+} // end of test_reject_when_full() function
+
+static void test_overwrite_oldest_when_full(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    void *data_ptrs[2];
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_ring_mode(gdllc_ptr, 3, sizeof(long),
+                                    GDLLL_RING_OVERWRITE_OLDEST_WHEN_FULL);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 10; i = i + 1) {
+        retval = gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                        3);
+    assert(*(long *)(gdlll_peek_front_element(gdllc_ptr)->data_ptr) == 7);
+
+    retval = gdlll_emplace_elements_to_back(gdllc_ptr, sizeof(long), 2,
+                                            data_ptrs);
+    assert(retval == GDLLL_SUCCESS);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                        3);
+
+    // a standalone element takes the slot of the oldest element
+    elem_ptr = gdlll_allocate_standalone_element(gdllc_ptr, sizeof(long));
+    assert(elem_ptr);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                        2);
+    gdlll_delete_standalone_element(gdllc_ptr, elem_ptr);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return;
+
+} // end of test_overwrite_oldest_when_full() function
+
+// The hint is the oldest element, which is overwritten by the insertion that
+// was given the hint.
+static void test_hint_is_overwritten(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct element *hint_elem_ptr = NULL;
+    long value = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdllc_ptr);
+
+    retval = gdlll_enable_ring_mode(gdllc_ptr, 4, sizeof(long),
+                                    GDLLL_RING_OVERWRITE_OLDEST_WHEN_FULL);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 10; i < 14; i = i + 1) {
+        retval = gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    for (i = 0; i < 20; i = i + 1) {
+        hint_elem_ptr = gdlll_peek_front_element(gdllc_ptr);
+        value = 5 + ((i * 7) % 20);
+        if (i % 2) {
+            retval = gdlll_add_element_sorted_ascending_near_hint(gdllc_ptr,
+                                &value, sizeof(value), compare,
+                                hint_elem_ptr);
+        } else {
+            retval = gdlll_add_element_sorted_ascending_near_hint(gdllc_ptr,
+                                &value, sizeof(value), compare, NULL);
+        }
+        assert(retval == GDLLL_SUCCESS);
+        assert(gdlll_get_total_number_of_elements_in_gdll_container(
+                                                            gdllc_ptr) == 4);
+        assert_list_is_sorted(gdllc_ptr);
+    }
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return;
+
+} // end of test_hint_is_overwritten() function
+
+// The slots of a ring are freed with the ring, so elements are not moved out
+// of (or into) a container in ring mode.
+static void test_no_moves_out_of_ring(void)
+{
+
+    struct gdll_container *ring_gdllc_ptr = NULL;
+    struct gdll_container *gdllc_ptr = NULL;
+    long from = 10;
+    long to = 20;
+    long i = 0;
+    int retval = 0;
+
+    ring_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(ring_gdllc_ptr && gdllc_ptr);
+
+    retval = gdlll_enable_ring_mode(ring_gdllc_ptr, 64, sizeof(long),
+                                    GDLLL_RING_REJECT_WHEN_FULL);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 50; i = i + 1) {
+        gdlll_add_element_sorted_ascending(ring_gdllc_ptr, &i, sizeof(i),
+                                           compare);
+        gdlll_add_element_sorted_ascending(gdllc_ptr, &i, sizeof(i),
+                                           compare);
+    }
+
+    assert(gdlll_get_range(ring_gdllc_ptr, &from, sizeof(from), &to,
+                           sizeof(to), compare, GDLLL_SEARCH_SORTED_ASCENDING,
+                           gdllc_ptr) == 0);
+    assert(gdlll_get_all_matching_elements(ring_gdllc_ptr, &from,
+                                           sizeof(from), compare,
+                                           gdllc_ptr) == 0);
+
+    assert(gdlll_get_range(gdllc_ptr, &from, sizeof(from), &to, sizeof(to),
+                           compare, GDLLL_SEARCH_SORTED_ASCENDING,
+                           ring_gdllc_ptr) == 0);
+    assert(gdlll_get_all_matching_elements(gdllc_ptr, &from, sizeof(from),
+                                           compare, ring_gdllc_ptr) == 0);
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr) ==
+                                                                        50);
+
+    // nothing in 'gdllc_ptr' points into the freed slots (ASan checks this)
+    gdlll_delete_gdll_container(ring_gdllc_ptr);
+    assert_list_is_sorted(gdllc_ptr);
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    return;
+
+} // end of test_no_moves_out_of_ring() function
+
+int main(void)
+{
+
+    test_reject_when_full();
+
+    test_overwrite_oldest_when_full();
+
+    test_hint_is_overwritten();
+
+    test_no_moves_out_of_ring();
+
+    printf("ring mode test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,166 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the gdlll_*_matching_element_using_strategy functions.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+int main(void)
+{
+
+    struct gdll_container *ascending_gdllc_ptr = NULL;
+    struct gdll_container *descending_gdllc_ptr = NULL;
+    struct element *forward_elem_ptr = NULL;
+    struct element *backward_elem_ptr = NULL;
+    struct element *both_ends_elem_ptr = NULL;
+    struct element *sorted_elem_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long num_elements = 0;
+    long key = 0;
+    long i = 0;
+
+    ascending_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    descending_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(ascending_gdllc_ptr && descending_gdllc_ptr);
+
+    // 500 values in 0 to 299, so there are duplicates and missing keys
+    srand(2);
+
+    for (i = 0; i < 500; i = i + 1) {
+        key = rand() % 300;
+        gdlll_add_element_sorted_ascending(ascending_gdllc_ptr, &key,
+                                           sizeof(key), compare);
+        gdlll_add_element_sorted_descending(descending_gdllc_ptr, &key,
+                                            sizeof(key), compare);
+    }
+
+    for (key = -5; key < 310; key = key + 1) {
+
+        forward_elem_ptr = gdlll_peek_matching_element_using_strategy(
+                                    ascending_gdllc_ptr, &key, sizeof(key),
+                                    compare, GDLLL_SEARCH_FORWARD);
+        backward_elem_ptr = gdlll_peek_matching_element_using_strategy(
+                                    ascending_gdllc_ptr, &key, sizeof(key),
+                                    compare, GDLLL_SEARCH_BACKWARD);
+        both_ends_elem_ptr = gdlll_peek_matching_element_using_strategy(
+                                    ascending_gdllc_ptr, &key, sizeof(key),
+                                    compare, GDLLL_SEARCH_FROM_BOTH_ENDS);
+        sorted_elem_ptr = gdlll_peek_matching_element_using_strategy(
+                                    ascending_gdllc_ptr, &key, sizeof(key),
+                                    compare, GDLLL_SEARCH_SORTED_ASCENDING);
+
+        assert(forward_elem_ptr == gdlll_peek_matching_element(
+                                            ascending_gdllc_ptr, &key,
+                                            sizeof(key), compare));
+
+        // all the strategies find a match or none of them does
+        assert((!forward_elem_ptr) == (!backward_elem_ptr));
+        assert((!forward_elem_ptr) == (!both_ends_elem_ptr));
+
+        // forward and sorted find the first match, backward finds the last
+        assert(sorted_elem_ptr == forward_elem_ptr);
+
+        if (forward_elem_ptr) {
+            assert(*(long *)(backward_elem_ptr->data_ptr) == key);
+            assert(*(long *)(both_ends_elem_ptr->data_ptr) == key);
+            assert((!forward_elem_ptr->prev) ||
+                   (*(long *)(forward_elem_ptr->prev->data_ptr) != key));
+            assert((!backward_elem_ptr->next) ||
+                   (*(long *)(backward_elem_ptr->next->data_ptr) != key));
+        }
+
+        assert(gdlll_peek_matching_element(descending_gdllc_ptr, &key,
+                                           sizeof(key), compare) ==
+               gdlll_peek_matching_element_using_strategy(
+                                    descending_gdllc_ptr, &key, sizeof(key),
+                                    compare, GDLLL_SEARCH_SORTED_DESCENDING));
+
+    }
+
+    // an unknown strategy finds nothing
+    key = 1;
+    assert(gdlll_peek_matching_element_using_strategy(ascending_gdllc_ptr,
+                                    &key, sizeof(key), compare, 99) == NULL);
+
+    // delete all the 7s, one at a time
+    key = 7;
+    num_elements = gdlll_get_total_number_of_elements_in_gdll_container(
+                                                        ascending_gdllc_ptr);
+
+    while (gdlll_peek_matching_element_using_strategy(ascending_gdllc_ptr,
+                                    &key, sizeof(key), compare,
+                                    GDLLL_SEARCH_SORTED_ASCENDING)) {
+        gdlll_delete_matching_element_using_strategy(ascending_gdllc_ptr, &key,
+                                                     sizeof(key), compare,
+                                                     GDLLL_SEARCH_BACKWARD);
+        num_elements = num_elements - 1;
+    }
+
+    assert(num_elements ==
+           gdlll_get_total_number_of_elements_in_gdll_container(
+                                                        ascending_gdllc_ptr));
+
+    // get the first 8 and then look for it again
+    key = 8;
+    forward_elem_ptr = gdlll_peek_matching_element(ascending_gdllc_ptr, &key,
+                                                   sizeof(key), compare);
+    elem_ptr = gdlll_get_matching_element_using_strategy(ascending_gdllc_ptr,
+                                    &key, sizeof(key), compare,
+                                    GDLLL_SEARCH_SORTED_ASCENDING);
+    assert(elem_ptr == forward_elem_ptr);
+
+    if (elem_ptr) {
+        assert(*(long *)(elem_ptr->data_ptr) == 8);
+        gdlll_delete_standalone_element(ascending_gdllc_ptr, elem_ptr);
+        assert(gdlll_get_total_number_of_elements_in_gdll_container(
+                                    ascending_gdllc_ptr) == num_elements - 1);
+    }
+
+    gdlll_delete_gdll_container(ascending_gdllc_ptr);
+    gdlll_delete_gdll_container(descending_gdllc_ptr);
+
+    printf("search strategies test passed\n");
+
+    return 0;
+
+} // end of main() function
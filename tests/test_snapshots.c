@@ -0,0 +1,272 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests snapshots: readers on other threads see the container as it was when
+// the snapshot was taken while the writer keeps changing it, and the elements
+// that a snapshot has are freed only after it has been released.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#define NUM_ELEMENTS 1000
+#define NUM_READERS 4
+
+static long num_deleted;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void call_back_func(void *data_ptr);
+static void *reader(void *arg);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+// Only the writer frees elements, so 'num_deleted' is not shared.
+static void call_back_func(void *data_ptr)
+{
+
+    (void)(data_ptr);
+
+    num_deleted = num_deleted + 1;
+
+    return;
+
+} // end of call_back_func() function
+
+// The snapshot was taken when the container had the keys 0 to
+// (NUM_ELEMENTS - 1) in order, and it must keep showing them.
+static void *reader(void *arg)
+{
+
+    struct gdll_snapshot *snapshot_ptr = arg;
+    struct element *elem_ptr = NULL;
+    long num_elements = 0;
+    long round = 0;
+    long i = 0;
+
+    num_elements = gdlll_snapshot_get_total_number_of_elements(snapshot_ptr);
+    assert(num_elements == NUM_ELEMENTS);
+
+    for (round = 0; round < 20; round = round + 1) {
+        for (i = 0; i < num_elements; i = i + 1) {
+            elem_ptr = gdlll_snapshot_peek_element_at_position(snapshot_ptr,
+                                                               i);
+            assert(*(long *)(elem_ptr->data_ptr) == i);
+        }
+    }
+
+    assert(!gdlll_snapshot_peek_element_at_position(snapshot_ptr,
+                                                    num_elements));
+
+    gdlll_release_snapshot(snapshot_ptr);
+
+    return NULL;
+
+} // end of reader() function
+
+int main(void)
+{
+
+    struct gdll_container *gdllc_ptr = NULL;
+    struct gdll_container *other_gdllc_ptr = NULL;
+    struct gdll_snapshot *snapshot_ptr = NULL;
+    pthread_t readers[NUM_READERS];
+    long num_elements = 0;
+    long old_value = 0;
+    long new_value = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+
+    for (i = 0; i < NUM_ELEMENTS; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    for (i = 0; i < NUM_READERS; i = i + 1) {
+        snapshot_ptr = gdlll_take_snapshot(gdllc_ptr);
+        assert(snapshot_ptr);
+        retval = pthread_create(&(readers[i]), NULL, reader, snapshot_ptr);
+        assert(retval == 0);
+    }
+
+    // the writer replaces, deletes and adds elements while the readers read
+    for (i = 0; i < 500; i = i + 1) {
+        old_value = i;
+        new_value = i + 100000;
+        retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &old_value,
+                                                sizeof(old_value), &new_value,
+                                                sizeof(new_value), compare);
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    for (i = 0; i < 300; i = i + 1) {
+        gdlll_delete_last_element(gdllc_ptr);
+        new_value = -i;
+        gdlll_add_element_to_front(gdllc_ptr, &new_value, sizeof(new_value));
+    }
+
+    for (i = 0; i < NUM_READERS; i = i + 1) {
+        pthread_join(readers[i], NULL);
+    }
+
+    // the 500 replaced versions and the 300 deleted elements
+    gdlll_reclaim_snapshots(gdllc_ptr);
+    assert(num_deleted == 800);
+    assert(gdllc_ptr->snapshot_number_of_retired_elements == 0);
+
+    // without snapshots the data is replaced in place and deletions free the
+    // element at once
+    old_value = 100000;
+    new_value = 7;
+    retval = gdlll_replace_data_in_matching_element(gdllc_ptr, &old_value,
+                                                    sizeof(old_value),
+                                                    &new_value,
+                                                    sizeof(new_value),
+                                                    compare);
+    assert(retval == GDLLL_SUCCESS);
+    assert(num_deleted == 801);
+
+    gdlll_delete_front_element(gdllc_ptr);
+    assert(num_deleted == 802);
+
+    // a snapshot that is never released is freed with the container
+    gdlll_enable_lazy_deletion(gdllc_ptr, 50);
+    gdlll_enable_order_statistic_index(gdllc_ptr);
+
+    snapshot_ptr = gdlll_take_snapshot(gdllc_ptr);
+    assert(snapshot_ptr);
+    num_elements = gdlll_snapshot_get_total_number_of_elements(snapshot_ptr);
+    assert(num_elements ==
+           gdlll_get_total_number_of_elements_in_gdll_container(gdllc_ptr));
+
+    for (i = 0; i < 200; i = i + 1) {
+        gdlll_delete_front_element(gdllc_ptr);
+    }
+
+    assert(gdlll_snapshot_get_total_number_of_elements(snapshot_ptr) ==
+                                                                num_elements);
+    assert(*(long *)(gdlll_snapshot_peek_element_at_position(snapshot_ptr,
+                                                    0)->data_ptr) == -298);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+    assert(num_deleted == (802 + num_elements));
+
+    // snapshots together with epoch based reclamation
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr);
+    num_deleted = 0;
+
+    gdlll_enable_epoch_reclamation(gdllc_ptr, 2);
+
+    for (i = 0; i < 100; i = i + 1) {
+        gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+    }
+
+    snapshot_ptr = gdlll_take_snapshot(gdllc_ptr);
+    assert(snapshot_ptr);
+
+    // the snapshot version is in the element itself, nothing is allocated for
+    // the elements
+    assert(gdllc_ptr->first->extension == NULL);
+    assert(gdllc_ptr->first->snapshot_version == snapshot_ptr->version);
+
+    for (i = 0; i < 100; i = i + 1) {
+        gdlll_delete_front_element(gdllc_ptr);
+    }
+
+    assert(num_deleted == 0);
+
+    gdlll_release_snapshot(snapshot_ptr);
+    gdlll_reclaim_snapshots(gdllc_ptr);
+    gdlll_epoch_reclaim(gdllc_ptr);
+    assert(num_deleted == 100);
+
+    // the array of the snapshot can't be allocated
+    gdlll_add_element_to_back(gdllc_ptr, &i, sizeof(i));
+
+    gdlll_inject_allocation_failures(0, -1);
+    snapshot_ptr = gdlll_take_snapshot(gdllc_ptr);
+    gdlll_inject_allocation_failures(0, 0);
+    assert(snapshot_ptr == NULL);
+
+    gdlll_delete_front_element(gdllc_ptr);
+    gdlll_epoch_reclaim(gdllc_ptr);
+    assert(num_deleted == 101);
+
+    gdlll_delete_gdll_container(gdllc_ptr);
+
+    // the elements that a snapshot has are not moved to another container,
+    // and the elements that are moved after it has been released are freed
+    // at once by the other container
+    gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    other_gdllc_ptr = gdlll_init_gdll_container(call_back_func);
+    assert(gdllc_ptr && other_gdllc_ptr);
+    num_deleted = 0;
+
+    for (i = 0; i < 100; i = i + 1) {
+        new_value = i % 2;
+        gdlll_add_element_to_back(gdllc_ptr, &new_value, sizeof(new_value));
+    }
+
+    snapshot_ptr = gdlll_take_snapshot(gdllc_ptr);
+    assert(snapshot_ptr);
+
+    new_value = 1;
+    assert(gdlll_get_all_matching_elements(gdllc_ptr, &new_value,
+                                sizeof(new_value), compare,
+                                other_gdllc_ptr) == 0);
+
+    gdlll_release_snapshot(snapshot_ptr);
+
+    assert(gdlll_get_all_matching_elements(gdllc_ptr, &new_value,
+                                sizeof(new_value), compare,
+                                other_gdllc_ptr) == 50);
+
+    gdlll_delete_all_elements_in_gdll_container(other_gdllc_ptr);
+    assert(num_deleted == 50);
+    assert(other_gdllc_ptr->snapshot_number_of_retired_elements == 0);
+
+    gdlll_delete_gdll_container(other_gdllc_ptr);
+    gdlll_delete_gdll_container(gdllc_ptr);
+    assert(num_deleted == 100);
+
+    printf("snapshots test passed\n");
+
+    return 0;
+
+} // end of main() function
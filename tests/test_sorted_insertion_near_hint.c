@@ -0,0 +1,171 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests gdlll_add_element_sorted_ascending_near_hint() and
+// gdlll_add_element_sorted_descending_near_hint().
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static long num_comparisons;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static int compare(struct element *first, struct element *second);
+static void assert_same_lists(struct gdll_container *first_gdllc_ptr,
+                              struct gdll_container *second_gdllc_ptr);
+
+static int compare(struct element *first, struct element *second)
+{
+
+    long i = *(long *)(first->data_ptr);
+    long j = *(long *)(second->data_ptr);
+
+    num_comparisons = num_comparisons + 1;
+
+    if (i < j) {
+        return -1;
+    } else if (i == j) {
+        return 0;
+    } else {
+        return 1;
+    }
+
+} // end of compare() function
+
+static void assert_same_lists(struct gdll_container *first_gdllc_ptr,
+                              struct gdll_container *second_gdllc_ptr)
+{
+
+    struct element *first_elem_ptr = first_gdllc_ptr->first;
+    struct element *second_elem_ptr = second_gdllc_ptr->first;
+
+    while (first_elem_ptr) {
+        assert(second_elem_ptr);
+        assert(*(long *)(first_elem_ptr->data_ptr) ==
+               *(long *)(second_elem_ptr->data_ptr));
+        first_elem_ptr = first_elem_ptr->next;
+        second_elem_ptr = second_elem_ptr->next;
+    }
+
+    assert(!second_elem_ptr);
+
+    return;
+
+} // end of assert_same_lists() function
+
+int main(void)
+{
+
+    struct gdll_container *plain_gdllc_ptr = NULL;
+    struct gdll_container *hint_gdllc_ptr = NULL;
+    struct element *hint_elem_ptr = NULL;
+    long descending = 0;
+    long value = 0;
+    long i = 0;
+    int retval = 0;
+
+    // The lists built with and without hints must be the same. The input is
+    // mostly increasing, with some random values and deletions in between.
+    for (descending = 0; descending < 2; descending = descending + 1) {
+
+        plain_gdllc_ptr = gdlll_init_gdll_container(NULL);
+        hint_gdllc_ptr = gdlll_init_gdll_container(NULL);
+        assert(plain_gdllc_ptr && hint_gdllc_ptr);
+
+        srand(1);
+
+        for (i = 0; i < 3000; i = i + 1) {
+
+            if ((i % 7) == 0) {
+                value = rand() % 5000;
+            } else {
+                value = i + (rand() % 5);
+            }
+
+            hint_elem_ptr = NULL;
+            if ((i % 5) == 0) {
+                hint_elem_ptr = gdlll_peek_front_element(hint_gdllc_ptr);
+            } else if ((i % 5) == 1) {
+                hint_elem_ptr = gdlll_peek_last_element(hint_gdllc_ptr);
+            }
+
+            if (descending) {
+                gdlll_add_element_sorted_descending(plain_gdllc_ptr, &value,
+                                                    sizeof(value), compare);
+                retval = gdlll_add_element_sorted_descending_near_hint(
+                                            hint_gdllc_ptr, &value,
+                                            sizeof(value), compare,
+                                            hint_elem_ptr);
+            } else {
+                gdlll_add_element_sorted_ascending(plain_gdllc_ptr, &value,
+                                                   sizeof(value), compare);
+                retval = gdlll_add_element_sorted_ascending_near_hint(
+                                            hint_gdllc_ptr, &value,
+                                            sizeof(value), compare,
+                                            hint_elem_ptr);
+            }
+            assert(retval == GDLLL_SUCCESS);
+
+            // the finger must not be left on a deleted element
+            if ((i % 11) == 0) {
+                gdlll_delete_front_element(plain_gdllc_ptr);
+                gdlll_delete_front_element(hint_gdllc_ptr);
+            }
+
+            if ((i % 13) == 0) {
+                gdlll_delete_last_element(plain_gdllc_ptr);
+                gdlll_delete_last_element(hint_gdllc_ptr);
+            }
+
+        }
+
+        assert_same_lists(plain_gdllc_ptr, hint_gdllc_ptr);
+
+        gdlll_delete_gdll_container(plain_gdllc_ptr);
+        gdlll_delete_gdll_container(hint_gdllc_ptr);
+
+    }
+
+    // nearly sorted input needs only a few comparisons per insertion
+    hint_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(hint_gdllc_ptr);
+
+    num_comparisons = 0;
+
+    for (i = 0; i < 100000; i = i + 1) {
+        value = i + (i % 3);
+        retval = gdlll_add_element_sorted_ascending_near_hint(hint_gdllc_ptr,
+                                                &value, sizeof(value), compare,
+                                                NULL);
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    assert(num_comparisons < (4 * 100000));
+
+    gdlll_delete_gdll_container(hint_gdllc_ptr);
+
+    printf("sorted insertion near hint test passed\n");
+
+    return 0;
+
+} // end of main() function
@@ -0,0 +1,248 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the timer wheel. Every timer must expire exactly once, in the advance
+// that passes its expiry time, unless it is cancelled.
+
+#include "generic_doubly_linked_list_library.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_TIMERS 20000
+#define START_TIME 100
+
+#define TIMER_IS_ARMED 0
+#define TIMER_IS_CANCELLED 1
+#define TIMER_HAS_EXPIRED 2
+
+static struct element *timers[NUM_TIMERS];
+static long expiry_times[NUM_TIMERS];
+static int timer_states[NUM_TIMERS];
+
+int main(void)
+{
+
+    struct gdll_timer_wheel *gdlltw_ptr = NULL;
+    struct gdll_container *expired_gdllc_ptr = NULL;
+    struct gdll_container *indexed_gdllc_ptr = NULL;
+    struct element *elem_ptr = NULL;
+    long num_armed = 0;
+    long num_expired = 0;
+    long expiry_time = 0;
+    long previous = 0;
+    long now = START_TIME;
+    long step = 0;
+    long id = 0;
+    long i = 0;
+    int retval = 0;
+
+    gdlltw_ptr = gdlll_timer_wheel_init(NULL, START_TIME);
+    expired_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(gdlltw_ptr && expired_gdllc_ptr);
+
+    srand(9);
+
+    // mostly near timers, and some that are far beyond the last level
+    for (i = 0; i < NUM_TIMERS; i = i + 1) {
+        if (rand() % 4) {
+            expiry_times[i] = START_TIME + (rand() % 5000);
+        } else {
+            expiry_times[i] = START_TIME + (((long)(rand()) * 64) % 40000000);
+        }
+        timers[i] = gdlll_timer_wheel_arm(gdlltw_ptr, &i, sizeof(i),
+                                          expiry_times[i]);
+        assert(timers[i]);
+        assert(gdlll_timer_wheel_get_expiry_time(timers[i]) ==
+                                                        expiry_times[i]);
+        timer_states[i] = TIMER_IS_ARMED;
+    }
+
+    for (i = 0; i < NUM_TIMERS; i = i + 7) {
+        expiry_times[i] = expiry_times[i] + (rand() % 300000);
+        retval = gdlll_timer_wheel_rearm(gdlltw_ptr, timers[i],
+                                         expiry_times[i]);
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    for (i = 3; i < NUM_TIMERS; i = i + 11) {
+        retval = gdlll_timer_wheel_cancel(gdlltw_ptr, timers[i]);
+        assert(retval == GDLLL_SUCCESS);
+        timer_states[i] = TIMER_IS_CANCELLED;
+    }
+
+    for (i = 0; i < NUM_TIMERS; i = i + 1) {
+        if (timer_states[i] == TIMER_IS_ARMED) {
+            num_armed = num_armed + 1;
+        }
+    }
+
+    assert(gdlll_timer_wheel_get_total_number_of_timers(gdlltw_ptr) ==
+                                                                num_armed);
+
+    while (gdlll_timer_wheel_get_total_number_of_timers(gdlltw_ptr)) {
+
+        step = 1 + (rand() % 200000);
+        now = now + step;
+
+        num_expired = num_expired +
+                gdlll_timer_wheel_advance(gdlltw_ptr, now, expired_gdllc_ptr);
+
+        // timers that were armed in the past expire at the first advance
+        for (elem_ptr = gdlll_peek_front_element(expired_gdllc_ptr); elem_ptr;
+             elem_ptr = gdlll_peek_next_element(expired_gdllc_ptr, elem_ptr)) {
+            id = *(long *)(elem_ptr->data_ptr);
+            assert(timer_states[id] == TIMER_IS_ARMED);
+            timer_states[id] = TIMER_HAS_EXPIRED;
+            expiry_time = expiry_times[id];
+            if (expiry_time <= START_TIME) {
+                expiry_time = START_TIME + 1;
+            }
+            assert((expiry_time <= now) && (expiry_time > (now - step)));
+        }
+
+        gdlll_delete_all_elements_in_gdll_container(expired_gdllc_ptr);
+
+    }
+
+    assert(num_expired == num_armed);
+
+    // the timers that expire in one advance are in the order of their expiry
+    // times
+    for (i = 0; i < 100; i = i + 1) {
+        expiry_time = now + 100 - i;
+        gdlll_timer_wheel_arm(gdlltw_ptr, &expiry_time, sizeof(expiry_time),
+                              expiry_time);
+    }
+
+    assert(gdlll_timer_wheel_advance(gdlltw_ptr, now + 1000,
+                                     expired_gdllc_ptr) == 100);
+
+    previous = 0;
+    for (elem_ptr = gdlll_peek_front_element(expired_gdllc_ptr); elem_ptr;
+         elem_ptr = gdlll_peek_next_element(expired_gdllc_ptr, elem_ptr)) {
+        assert(*(long *)(elem_ptr->data_ptr) >= previous);
+        previous = *(long *)(elem_ptr->data_ptr);
+    }
+
+    now = now + 1000;
+
+    // an expired timer can be armed again
+    elem_ptr = gdlll_get_front_element(expired_gdllc_ptr);
+    retval = gdlll_timer_wheel_cancel(gdlltw_ptr, elem_ptr);
+    assert(retval == GDLLL_ELEMENT_IS_NOT_ARMED);
+
+    retval = gdlll_timer_wheel_arm_element(gdlltw_ptr, elem_ptr, now + 5000);
+    assert(retval == GDLLL_SUCCESS);
+
+    gdlll_delete_all_elements_in_gdll_container(expired_gdllc_ptr);
+    assert(gdlll_timer_wheel_advance(gdlltw_ptr, now + 4999,
+                                     expired_gdllc_ptr) == 0);
+    assert(gdlll_timer_wheel_advance(gdlltw_ptr, now + 5000,
+                                     expired_gdllc_ptr) == 1);
+    assert(gdlll_peek_front_element(expired_gdllc_ptr) == elem_ptr);
+
+    // an expired timer that is in a container with an integer key index (so
+    // it has a slot in the index) is not armed
+    elem_ptr = gdlll_get_front_element(expired_gdllc_ptr);
+    assert(elem_ptr);
+
+    indexed_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(indexed_gdllc_ptr);
+    retval = gdlll_enable_integer_key_index(indexed_gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 10; i = i + 1) {
+        retval = gdlll_add_element_to_back(indexed_gdllc_ptr, &i, sizeof(i));
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    retval = gdlll_insert_standalone_element_before_element(indexed_gdllc_ptr,
+                                                            elem_ptr, NULL);
+    assert(retval == GDLLL_SUCCESS);
+
+    retval = gdlll_timer_wheel_rearm(gdlltw_ptr, elem_ptr, now + 10);
+    assert(retval == GDLLL_ELEMENT_IS_NOT_ARMED);
+    retval = gdlll_timer_wheel_cancel(gdlltw_ptr, elem_ptr);
+    assert(retval == GDLLL_ELEMENT_IS_NOT_ARMED);
+    retval = gdlll_timer_wheel_cancel(gdlltw_ptr,
+                                      gdlll_peek_front_element(
+                                                        indexed_gdllc_ptr));
+    assert(retval == GDLLL_ELEMENT_IS_NOT_ARMED);
+
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(
+                                                    indexed_gdllc_ptr) == 11);
+    assert(gdlll_timer_wheel_get_total_number_of_timers(gdlltw_ptr) == 0);
+
+    gdlll_delete_gdll_container(indexed_gdllc_ptr);
+
+    // the timer's state is in the memory block of the timer, so only that
+    // block is allocated
+    gdlll_inject_allocation_failures(0, 1);
+    elem_ptr = gdlll_timer_wheel_arm(gdlltw_ptr, &i, sizeof(i), now + 6000);
+    gdlll_inject_allocation_failures(0, 0);
+    assert(elem_ptr == NULL);
+    assert(gdlll_timer_wheel_get_total_number_of_timers(gdlltw_ptr) == 0);
+
+    // the timers that expire are moved only if the integer key index of the
+    // container of expired timers can grow for them (the 16 keys fill it)
+    indexed_gdllc_ptr = gdlll_init_gdll_container(NULL);
+    assert(indexed_gdllc_ptr);
+    retval = gdlll_enable_integer_key_index(indexed_gdllc_ptr);
+    assert(retval == GDLLL_SUCCESS);
+
+    for (i = 0; i < 16; i = i + 1) {
+        retval = gdlll_add_element_to_back(indexed_gdllc_ptr, &i, sizeof(i));
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    now = now + 5000;
+
+    for (i = 1000; i < 1003; i = i + 1) {
+        assert(gdlll_timer_wheel_arm(gdlltw_ptr, &i, sizeof(i), now + 100));
+    }
+
+    gdlll_inject_allocation_failures(0, 1);
+    assert(gdlll_timer_wheel_advance(gdlltw_ptr, now + 200,
+                                     indexed_gdllc_ptr) == 0);
+    gdlll_inject_allocation_failures(0, 0);
+    assert(gdlll_timer_wheel_get_total_number_of_timers(gdlltw_ptr) == 3);
+
+    assert(gdlll_timer_wheel_advance(gdlltw_ptr, now + 200,
+                                     indexed_gdllc_ptr) == 3);
+    assert(gdlll_get_total_number_of_elements_in_gdll_container(
+                                                    indexed_gdllc_ptr) == 19);
+
+    for (i = 1000; i < 1003; i = i + 1) {
+        elem_ptr = gdlll_peek_element_with_integer_key(indexed_gdllc_ptr, i);
+        assert(elem_ptr && (*(long *)(elem_ptr->data_ptr) == i));
+    }
+
+    gdlll_delete_gdll_container(indexed_gdllc_ptr);
+
+    gdlll_timer_wheel_delete(gdlltw_ptr);
+    gdlll_delete_gdll_container(expired_gdllc_ptr);
+
+    printf("timer wheel test passed\n");
+
+    return 0;
+
+} // end of main() function
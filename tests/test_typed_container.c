@@ -0,0 +1,206 @@
+/*
+ * License:
+ *
+ * This file has been released under "unlicense" license
+ * (https://unlicense.org).
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute
+ * this software, either in source code form or as a compiled binary, for any
+ * purpose, commercial or non-commercial, and by any means.
+ *
+ * For more information about this license, please visit - https://unlicense.org
+ */
+
+/*
+ * Author: Amit Choudhary
+ * Email: amitchoudhary0523 AT gmail DOT com
+ */
+
+// Tests the containers generated by GDLLL_DEFINE_TYPED_CONTAINER().
+
+#include "generic_doubly_linked_list_library_typed.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct strmap_entry
+{
+    char *key_str;
+    long val;
+};
+
+#define STRMAP_COMPARE(first, second)                                          \
+        strcmp((first)->key_str, (second)->key_str)
+
+GDLLL_DEFINE_TYPED_CONTAINER(gdll_long, long, GDLLL_TYPED_COMPARE_SCALARS)
+
+GDLLL_DEFINE_TYPED_CONTAINER(gdll_strmap, struct strmap_entry, STRMAP_COMPARE)
+
+static long num_deleted;
+
+// function prototypes for gcc flag -Werror-implicit-function-declaration
+static void free_key_str(struct strmap_entry *entry_ptr);
+static struct strmap_entry make_entry(const char *key_str, long val);
+static void test_long_container(void);
+static void test_strmap_container(void);
+
+static void free_key_str(struct strmap_entry *entry_ptr)
+{
+
+    free(entry_ptr->key_str);
+
+    num_deleted = num_deleted + 1;
+
+    return;
+
+} // end of free_key_str() function
+
+static struct strmap_entry make_entry(const char *key_str, long val)
+{
+
+    struct strmap_entry entry;
+
+    entry.key_str = (char *)malloc(strlen(key_str) + 1);
+    assert(entry.key_str);
+    strcpy(entry.key_str, key_str);
+    entry.val = val;
+
+    return entry;
+
+} // end of make_entry() function
+
+static void test_long_container(void)
+{
+
+    struct gdll_long_container *c_ptr = NULL;
+    struct gdll_long_element *elem_ptr = NULL;
+    long value = 0;
+    long new_value = 0;
+    long i = 0;
+    int retval = 0;
+
+    c_ptr = gdll_long_init_container(NULL);
+    assert(c_ptr);
+
+    // 0, 7, 14, ... wrapped around 100 gives every value in 0 to 99 once
+    for (i = 0; i < 100; i = i + 1) {
+        value = (i * 7) % 100;
+        retval = gdll_long_add_element_sorted_ascending(c_ptr, &value);
+        assert(retval == GDLLL_SUCCESS);
+    }
+
+    assert(gdll_long_get_total_number_of_elements_in_container(c_ptr) == 100);
+
+    i = 0;
+    for (elem_ptr = gdll_long_peek_front_element(c_ptr); elem_ptr;
+         elem_ptr = elem_ptr->next) {
+        assert(elem_ptr->data == i);
+        i = i + 1;
+    }
+    assert(i == 100);
+
+    assert(gdll_long_peek_last_element(c_ptr)->data == 99);
+
+    value = 42;
+    elem_ptr = gdll_long_peek_matching_element(c_ptr, &value);
+    assert(elem_ptr && (elem_ptr->data == 42));
+
+    new_value = 1000;
+    retval = gdll_long_replace_data_in_matching_element(c_ptr, &value,
+                                                        &new_value);
+    assert(retval == GDLLL_SUCCESS);
+    assert(!gdll_long_peek_matching_element(c_ptr, &value));
+    assert(elem_ptr->data == 1000);
+
+    gdll_long_delete_matching_element(c_ptr, &new_value);
+    gdll_long_delete_front_element(c_ptr);
+    gdll_long_delete_last_element(c_ptr);
+    assert(gdll_long_get_total_number_of_elements_in_container(c_ptr) == 97);
+    assert(gdll_long_peek_front_element(c_ptr)->data == 1);
+    assert(gdll_long_peek_last_element(c_ptr)->data == 98);
+
+    elem_ptr = gdll_long_get_front_element(c_ptr);
+    assert(elem_ptr->data == 1);
+    gdll_long_delete_standalone_element(c_ptr, elem_ptr);
+
+    value = -1;
+    gdll_long_add_element_to_front(c_ptr, &value);
+    value = 500;
+    gdll_long_add_element_to_back(c_ptr, &value);
+    assert(gdll_long_peek_front_element(c_ptr)->data == -1);
+    assert(gdll_long_peek_last_element(c_ptr)->data == 500);
+
+    gdll_long_delete_all_elements_in_container(c_ptr);
+    assert(gdll_long_get_total_number_of_elements_in_container(c_ptr) == 0);
+    assert(!gdll_long_peek_front_element(c_ptr));
+
+    // descending order
+    for (i = 0; i < 10; i = i + 1) {
+        gdll_long_add_element_sorted_descending(c_ptr, &i);
+    }
+    assert(gdll_long_peek_front_element(c_ptr)->data == 9);
+    assert(gdll_long_peek_last_element(c_ptr)->data == 0);
+
+    gdll_long_delete_container(c_ptr);
+
+    return;
+
+} // end of test_long_container() function
+
+static void test_strmap_container(void)
+{
+
+    struct gdll_strmap_container *c_ptr = NULL;
+    struct gdll_strmap_element *elem_ptr = NULL;
+    struct strmap_entry entry;
+    struct strmap_entry key;
+
+    c_ptr = gdll_strmap_init_container(free_key_str);
+    assert(c_ptr);
+
+    entry = make_entry("pear", 3);
+    gdll_strmap_add_element_sorted_ascending(c_ptr, &entry);
+    entry = make_entry("apple", 1);
+    gdll_strmap_add_element_sorted_ascending(c_ptr, &entry);
+    entry = make_entry("orange", 2);
+    gdll_strmap_add_element_sorted_ascending(c_ptr, &entry);
+
+    elem_ptr = gdll_strmap_peek_front_element(c_ptr);
+    assert(strcmp(elem_ptr->data.key_str, "apple") == 0);
+    assert(strcmp(elem_ptr->next->data.key_str, "orange") == 0);
+    assert(strcmp(gdll_strmap_peek_last_element(c_ptr)->data.key_str,
+                  "pear") == 0);
+
+    key.key_str = (char *)"orange";
+    key.val = 0;
+    elem_ptr = gdll_strmap_peek_matching_element(c_ptr, &key);
+    assert(elem_ptr && (elem_ptr->data.val == 2));
+
+    // the deleted element's string is freed by the callback
+    gdll_strmap_delete_matching_element(c_ptr, &key);
+    assert(num_deleted == 1);
+    assert(!gdll_strmap_peek_matching_element(c_ptr, &key));
+
+    gdll_strmap_delete_container(c_ptr);
+    assert(num_deleted == 3);
+
+    return;
+
+} // end of test_strmap_container() function
+
+int main(void)
+{
+
+    test_long_container();
+
+    test_strmap_container();
+
+    printf("typed container test passed\n");
+
+    return 0;
+
+} // end of main() function